@@ -69,6 +69,20 @@ Status StoreFactory::SetDbConfig(std::shared_ptr<DBStore> dbStore)
     return StoreUtil::ConvertStatus(status);
 }
 
+Status StoreFactory::SetResultSetCacheMode(std::shared_ptr<DBStore> dbStore, const Options &options)
+{
+    if (!options.isPagedResultSet) {
+        return SUCCESS;
+    }
+    auto mode = DistributedDB::ResultSetCacheMode::CACHE_ENTRY_PAGED;
+    PragmaData data = static_cast<DistributedDB::PragmaData>(&mode);
+    auto status = dbStore->Pragma(DistributedDB::RESULT_SET_CACHE_MODE, data);
+    if (status != DistributedDB::DBStatus::OK) {
+        ZLOGE("Failed to set result set cache mode! status:%{public}d", status);
+    }
+    return StoreUtil::ConvertStatus(status);
+}
+
 std::string StoreFactory::GenerateKey(const std::string &keyPrefix, const std::string &storeId) const
 {
     std::string key = "";
@@ -125,6 +139,7 @@ std::shared_ptr<SingleKvStore> StoreFactory::GetOrOpenStore(const AppId &appId,
                 auto release = [dbManager](auto *store) { dbManager->CloseKvStore(store); };
                 auto dbStore = std::shared_ptr<DBStore>(store, release);
                 SetDbConfig(dbStore);
+                SetResultSetCacheMode(dbStore, options);
                 const Convertor &convertor = *(convertors_[options.kvStoreType]);
                 kvStore = std::make_shared<SingleStoreImpl>(dbStore, appId, options, convertor);
             });
@@ -785,6 +785,57 @@ HWTEST_F(SingleStoreImplTest, GetResultSet_Query, TestSize.Level0)
     ASSERT_EQ(count, output->GetCount());
 }
 
+/**
+ * @tc.name: GetResultSet_Paged
+ * @tc.desc: get result set by prefix from the store opened with paged result set
+ * @tc.type: FUNC
+ */
+HWTEST_F(SingleStoreImplTest, GetResultSet_Paged, TestSize.Level0)
+{
+    AppId appId = { "SingleStoreImplTest" };
+    StoreId storeId = { "SingleKVStorePagedResultSet" };
+    Options options;
+    options.kvStoreType = SINGLE_VERSION;
+    options.securityLevel = S1;
+    options.area = EL1;
+    options.baseDir = "/data/service/el1/public/database/SingleStoreImplTest";
+    options.isPagedResultSet = true;
+    Status status = StoreManager::GetInstance().Delete(appId, storeId, options.baseDir);
+    auto kvStore = StoreManager::GetInstance().GetKVStore(appId, storeId, options, status);
+    ASSERT_NE(kvStore, nullptr);
+    std::vector<Entry> input;
+    std::vector<std::string> expectKeys;
+    for (int i = 0; i < 10; ++i) {
+        Entry entry;
+        entry.key = std::to_string(i).append("_k");
+        entry.value = std::to_string(i).append("_v");
+        expectKeys.push_back(entry.key.ToString());
+        input.push_back(entry);
+    }
+    status = kvStore->PutBatch(input);
+    ASSERT_EQ(status, SUCCESS);
+    std::shared_ptr<KvStoreResultSet> output;
+    status = kvStore->GetResultSet({ "" }, output);
+    ASSERT_EQ(status, SUCCESS);
+    ASSERT_NE(output, nullptr);
+    ASSERT_EQ(output->GetCount(), 10);
+    int count = 0;
+    while (output->MoveToNext()) {
+        Entry entry;
+        output->GetEntry(entry);
+        ASSERT_EQ(entry.key.ToString(), expectKeys[count]);
+        ASSERT_EQ(entry.value.ToString(), input[count].value.ToString());
+        count++;
+    }
+    ASSERT_EQ(count, 10);
+    status = kvStore->CloseResultSet(output);
+    ASSERT_EQ(status, SUCCESS);
+    status = StoreManager::GetInstance().CloseKVStore(appId, storeId);
+    ASSERT_EQ(status, SUCCESS);
+    status = StoreManager::GetInstance().Delete(appId, storeId, options.baseDir);
+    ASSERT_EQ(status, SUCCESS);
+}
+
 /**
  * @tc.name: CloseResultSet
  * @tc.desc: close the result set
@@ -18,12 +18,26 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <memory>
 #include <mutex>
 
 #include "db_types.h"
+#include "macro_utils.h"
 #include "types_export.h"
 
 namespace DistributedDB {
+// Compress the data piece by piece, the caller needn't gather all data into one buffer before compressing.
+class DataCompressionStream {
+public:
+    DataCompressionStream() = default;
+    virtual ~DataCompressionStream() = default;
+    DISABLE_COPY_ASSIGN_MOVE(DataCompressionStream);
+
+    virtual int Append(const uint8_t *data, uint32_t len) = 0;
+    // The result can be uncompressed by DataCompression::Uncompress of the same algorithm
+    virtual int Finish(std::vector<uint8_t> &destData) = 0;
+};
+
 class DataCompression {
 public:
     static DataCompression *GetInstance(CompressAlgorithm algo);
@@ -34,6 +48,8 @@ public:
     virtual int Compress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData) const = 0;
     virtual int Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData, uint32_t destLen)
         const = 0;
+    // srcLen is the total length of data to be appended, return nullptr if it is over limit
+    virtual std::unique_ptr<DataCompressionStream> CreateCompressionStream(uint32_t srcLen) const;
 
 protected:
     DataCompression() = default;
@@ -63,6 +63,10 @@ public:
 
     static int CalcValueHash(const std::vector<uint8_t> &Value, std::vector<uint8_t> &hashValue);
 
+    // Calc hash of *values[i] into hashValues[i] with one hash context, nullptr in values get empty hash value.
+    static int CalcValueHashBatch(const std::vector<const std::vector<uint8_t> *> &values,
+        std::vector<std::vector<uint8_t>> &hashValues);
+
     static int GetHashString(const std::string &str, std::string &dst);
 
     static int CreateStoreDirectory(const std::string &directory, const std::string &identifierName,
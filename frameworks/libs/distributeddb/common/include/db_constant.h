@@ -145,6 +145,8 @@ public:
 
     static constexpr const size_t MAX_SYNC_BLOCK_SIZE = 31457280; // 30MB
 
+    static constexpr const uint32_t MAX_WATERMARK_FLUSH_THRESHOLD = 128;
+
     static constexpr const int DOUBLE_PRECISION = 15;
     static constexpr const int MAX_DISTRIBUTED_TABLE_COUNT = 32;
 
@@ -178,7 +180,8 @@ public:
     static constexpr const char *LOG_TABLE_VERSION_5_8 = "5.08"; // migrate cursor to meta table
     static constexpr const char *LOG_TABLE_VERSION_5_9 = "5.09"; // insert retains the old version
     static constexpr const char *LOG_TABLE_VERSION_5_10 = "5.10"; // retain downloading asset in update trigger
-    static constexpr const char *LOG_TABLE_VERSION_CURRENT = LOG_TABLE_VERSION_5_10;
+    static constexpr const char *LOG_TABLE_VERSION_5_11 = "5.11"; // calculate hash key once in insert trigger
+    static constexpr const char *LOG_TABLE_VERSION_CURRENT = LOG_TABLE_VERSION_5_11;
 
     static constexpr const char *LOG_TABLE_VERSION_KEY = "log_table_version";
 
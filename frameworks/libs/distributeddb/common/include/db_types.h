@@ -187,7 +187,9 @@ using ObserverAction =
 
 enum class CompressAlgorithm : uint8_t {
     NONE = 0,
-    ZLIB = 1
+    ZLIB = 1,
+    LZ4 = 2,
+    ZSTD = 3
 };
 
 struct PermissionCheckRet {
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HASH_IDENTIFIER_CACHE_H
+#define HASH_IDENTIFIER_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "macro_utils.h"
+
+namespace DistributedDB {
+// Process wide cache of DBCommon::TransferHashString result, used for the identifiers which are hashed repeatedly
+// such as device name. Every item in a sync packet comes from the same device, so the sha256 is calculated once.
+class HashIdentifierCache final {
+public:
+    static HashIdentifierCache &GetInstance();
+
+    DISABLE_COPY_ASSIGN_MOVE(HashIdentifierCache);
+
+    // Same result as DBCommon::TransferHashString
+    std::string GetHashString(const std::string &identifier);
+
+    void GetStatistics(uint64_t &hitCount, uint64_t &missCount) const;
+
+    void Clear();
+
+private:
+    HashIdentifierCache() = default;
+    ~HashIdentifierCache() = default;
+
+    static constexpr size_t MAX_CACHE_ITEMS = 256;
+
+    mutable std::shared_mutex cacheLock_;
+    std::unordered_map<std::string, std::string> cache_;
+    std::atomic<uint64_t> hitCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+};
+} // namespace DistributedDB
+#endif // HASH_IDENTIFIER_CACHE_H
@@ -16,6 +16,7 @@
 #ifndef TASK_POOL_H
 #define TASK_POOL_H
 
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -24,6 +25,17 @@
 namespace DistributedDB {
 using Task = std::function<void(void)>;
 
+struct TaskPoolStatistic {
+    int curThreads = 0;
+    int idleThreads = 0;
+    int genericTaskDepth = 0; // generic tasks waiting to run.
+    int queuedTaskDepth = 0; // tasks with tag waiting to run.
+    uint64_t executedTaskCount = 0;
+    uint64_t stolenTaskCount = 0; // tasks ran by a thread which they were not dispatched to.
+    uint64_t totalWaitTimeUs = 0; // from schedule to start running, sum of all executed tasks.
+    uint64_t maxWaitTimeUs = 0;
+};
+
 class TaskPool {
 public:
     // Start the task pool.
@@ -41,6 +53,9 @@ public:
     // Shrink memory associated with the given tag if possible.
     virtual void ShrinkMemory(const std::string &tag) = 0;
 
+    // Get the queue depth and wait time counters.
+    virtual void GetStatistic(TaskPoolStatistic &statistic) const = 0;
+
     // Create/Destroy a task pool.
     static TaskPool *Create(int maxThreads, int minThreads, int &errCode);
     static void Release(TaskPool *&taskPool);
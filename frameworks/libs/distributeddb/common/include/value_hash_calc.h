@@ -28,35 +28,31 @@ namespace DistributedDB {
 class ValueHashCalc {
 public:
     ValueHashCalc() {};
-    ~ValueHashCalc()
-    {
-        if (context_ != nullptr) {
-            delete context_;
-            context_ = nullptr;
-        }
-    }
+    ~ValueHashCalc() {};
 
+    // The context lives in the object, calc hash do not need allocate memory
     int Initialize()
     {
-        context_ = new (std::nothrow) SHA256_CTX;
-        if (context_ == nullptr) {
-            return -E_OUT_OF_MEMORY;
-        }
-
-        int errCode = SHA256_Init(context_);
+        int errCode = SHA256_Init(&context_);
         if (errCode == 0) {
             LOGE("sha init failed:%d", errCode);
             return -E_CALC_HASH;
         }
+        isInitialized_ = true;
         return E_OK;
     }
 
     int Update(const std::vector<uint8_t> &value)
     {
-        if (context_ == nullptr) {
+        return Update(value.data(), value.size());
+    }
+
+    int Update(const uint8_t *data, size_t len)
+    {
+        if (!isInitialized_) {
             return -E_CALC_HASH;
         }
-        int errCode = SHA256_Update(context_, value.data(), value.size());
+        int errCode = SHA256_Update(&context_, data, len);
         if (errCode == 0) {
             LOGE("sha update failed:%d", errCode);
             return -E_CALC_HASH;
@@ -66,12 +62,14 @@ public:
 
     int GetResult(std::vector<uint8_t> &value)
     {
-        if (context_ == nullptr) {
+        if (!isInitialized_) {
             return -E_CALC_HASH;
         }
 
         value.resize(SHA256_DIGEST_LENGTH);
-        int errCode = SHA256_Final(value.data(), context_);
+        int errCode = SHA256_Final(value.data(), &context_);
+        // context is cleaned after final, need initialize again before next update
+        isInitialized_ = false;
         if (errCode == 0) {
             LOGE("sha get result failed:%d", errCode);
             return -E_CALC_HASH;
@@ -81,7 +79,8 @@ public:
     }
 
 private:
-    SHA256_CTX *context_ = nullptr;
+    SHA256_CTX context_ {};
+    bool isInitialized_ = false;
 };
 }
 
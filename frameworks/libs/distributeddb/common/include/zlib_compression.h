@@ -27,6 +27,7 @@ public:
     int Compress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData) const override;
     int Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData, uint32_t destLen) const
         override;
+    std::unique_ptr<DataCompressionStream> CreateCompressionStream(uint32_t srcLen) const override;
 
 protected:
     ZlibCompression(const ZlibCompression& compression) = delete;
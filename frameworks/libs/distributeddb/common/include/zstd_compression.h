@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ZSTD_COMPRESSION_H
+#define ZSTD_COMPRESSION_H
+#ifdef USE_DISTRIBUTEDDB_ZSTD
+#include <vector>
+#include "data_compression.h"
+
+namespace DistributedDB {
+// Compress data in zstd frame format, faster than zlib with a similar compression ratio
+class ZstdCompression final : public DataCompression {
+public:
+    ZstdCompression();
+    ~ZstdCompression() = default;
+
+    int Compress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData) const override;
+    int Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData, uint32_t destLen) const
+        override;
+    std::unique_ptr<DataCompressionStream> CreateCompressionStream(uint32_t srcLen) const override;
+
+protected:
+    ZstdCompression(const ZstdCompression& compression) = delete;
+    ZstdCompression& operator= (const ZstdCompression& compression) = delete;
+};
+}  // namespace DistributedDB
+#endif // USE_DISTRIBUTEDDB_ZSTD
+#endif // ZSTD_COMPRESSION_H
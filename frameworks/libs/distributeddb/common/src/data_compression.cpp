@@ -14,9 +14,44 @@
  */
 
 #include "data_compression.h"
+#include "db_constant.h"
 #include "db_errno.h"
+#include "log_print.h"
 
 namespace DistributedDB {
+namespace {
+// Used by the algorithm without streaming api, gather the data and compress it at once
+class BufferedCompressionStream final : public DataCompressionStream {
+public:
+    BufferedCompressionStream(const DataCompression *compression, uint32_t srcLen) : compression_(compression)
+    {
+        srcData_.reserve(srcLen);
+    }
+    ~BufferedCompressionStream() override = default;
+
+    int Append(const uint8_t *data, uint32_t len) override
+    {
+        if (len == 0) {
+            return E_OK;
+        }
+        if (data == nullptr || srcData_.size() + len > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+            return -E_INVALID_ARGS;
+        }
+        srcData_.insert(srcData_.end(), data, data + len);
+        return E_OK;
+    }
+
+    int Finish(std::vector<uint8_t> &destData) override
+    {
+        return compression_->Compress(srcData_, destData);
+    }
+
+private:
+    const DataCompression *compression_;
+    std::vector<uint8_t> srcData_;
+};
+}
+
 std::mutex DataCompression::algosLock_;
 
 void DataCompression::GetCompressionAlgo(std::set<CompressAlgorithm> &algorithmSet)
@@ -60,6 +95,15 @@ void DataCompression::Register(CompressAlgorithm algo, DataCompression *compress
     GetTransMap().insert({ static_cast<uint32_t>(algo), algo });
 }
 
+std::unique_ptr<DataCompressionStream> DataCompression::CreateCompressionStream(uint32_t srcLen) const
+{
+    if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+        LOGE("[DataCompression] Too long to compress, srcLen:%" PRIu32, srcLen);
+        return nullptr;
+    }
+    return std::make_unique<BufferedCompressionStream>(this, srcLen);
+}
+
 std::map<CompressAlgorithm, DataCompression *> &DataCompression::GetCompressionAlgos()
 {
     static std::map<CompressAlgorithm, DataCompression *> compressionAlgos;
@@ -33,6 +33,7 @@
 #include "platform_specific.h"
 #include "query_sync_object.h"
 #include "hash.h"
+#include "hash_identifier_cache.h"
 #include "runtime_context.h"
 #include "version.h"
 
@@ -300,7 +301,7 @@ std::string DBCommon::GetDistributedTableName(const std::string &device, const s
 
 std::string DBCommon::GetDistributedTableNameWithHash(const std::string &device, const std::string &tableName)
 {
-    std::string deviceHashHex = DBCommon::TransferStringToHex(DBCommon::TransferHashString(device));
+    std::string deviceHashHex = DBCommon::TransferStringToHex(HashIdentifierCache::GetInstance().GetHashString(device));
     return CalDistributedTableName(deviceHashHex, tableName);
 }
 
@@ -103,6 +103,31 @@ int DBCommon::CalcValueHash(const std::vector<uint8_t> &value, std::vector<uint8
     return E_OK;
 }
 
+int DBCommon::CalcValueHashBatch(const std::vector<const std::vector<uint8_t> *> &values,
+    std::vector<std::vector<uint8_t>> &hashValues)
+{
+    hashValues.clear();
+    hashValues.resize(values.size());
+    ValueHashCalc hashCalc;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i] == nullptr) {
+            continue;
+        }
+        int errCode = hashCalc.Initialize();
+        if (errCode == E_OK) {
+            errCode = hashCalc.Update(*values[i]);
+        }
+        if (errCode == E_OK) {
+            errCode = hashCalc.GetResult(hashValues[i]);
+        }
+        if (errCode != E_OK) {
+            hashValues.clear();
+            return -E_INTERNAL_ERROR;
+        }
+    }
+    return E_OK;
+}
+
 int DBCommon::GetHashString(const std::string &str, std::string &dst)
 {
     std::vector<uint8_t> strVec;
@@ -15,6 +15,7 @@
 
 #include "event_loop_impl.h"
 
+#include <algorithm>
 #include <ctime>
 
 #include "db_errno.h"
@@ -22,6 +23,11 @@
 #include "event_impl.h"
 
 namespace DistributedDB {
+namespace {
+    constexpr size_t MIN_TIMER_COMPACT_SIZE = 1024; // compact the stale timer nodes only when there are many
+    constexpr size_t MAX_TIMER_NODE_MULTIPLE = 2; // compact when the nodes are more than twice of the timers
+}
+
 class EventRequest {
 public:
     enum {
@@ -98,7 +104,7 @@ private:
 };
 
 EventLoopImpl::EventLoopImpl()
-    : pollingSetChanged_(false),
+    : timerSeq_(0),
       running_(true)
 {
     OnKill([this]() { OnKillLoop(); });
@@ -320,7 +326,7 @@ bool EventLoopImpl::EventFdExists(const EventImpl *event) const
     if (!event->IsValidFd()) {
         return false;
     }
-    for (auto ev : polling_) {
+    for (auto ev : fdEvents_) {
         if (ev->GetEventFd() == event->GetEventFd()) {
             return true;
         }
@@ -349,10 +355,13 @@ int EventLoopImpl::AddEventObject(EventImpl *event, EventTime now)
 
     if (errCode == E_OK) {
         polling_.insert(event);
+        if (!event->IsTimer()) {
+            fdEvents_.insert(event);
+        }
         event->SetStartTime(now);
         event->SetRevents(0);
+        ScheduleTimer(event);
         RefObject::IncObjRef(event);
-        pollingSetChanged_ = true;
     } else {
         LOGE("Add event failed. err: '%d'.", errCode);
     }
@@ -375,9 +384,10 @@ int EventLoopImpl::RemoveEventObject(EventImpl *event)
 
     if (errCode == E_OK) {
         polling_.erase(event);
+        fdEvents_.erase(event);
+        CancelTimer(event);
         event->SetLoop(nullptr);
         RefObject::DecObjRef(event);
-        pollingSetChanged_ = true;
     } else {
         LOGE("Remove event failed. err: '%d'.", errCode);
     }
@@ -403,6 +413,7 @@ int EventLoopImpl::ModifyEventObject(EventImpl *event, bool isAdd, EventsMask ev
 
     if (errCode == E_OK) {
         event->SetEvents(isAdd, events);
+        ScheduleTimer(event);
     } else {
         LOGE("Modify event' failed. err: '%d'.", errCode);
     }
@@ -418,6 +429,7 @@ int EventLoopImpl::ModifyEventObject(EventImpl *event, EventTime timeout)
         return -E_NO_SUCH_ENTRY;
     }
     event->SetTimeoutPeriod(timeout);
+    ScheduleTimer(event);
     return E_OK;
 }
 
@@ -491,64 +503,101 @@ int EventLoopImpl::ProcessRequest()
     return errCode;
 }
 
-EventTime EventLoopImpl::CalSleepTime() const
+void EventLoopImpl::ScheduleTimer(EventImpl *event)
 {
-    EventTime now = GetTime();
-    EventTime minInterval = EventImpl::MAX_TIME_VALUE;
+    EventTime timePoint = 0;
+    if (!event->GetTimeoutPoint(timePoint)) {
+        CancelTimer(event);
+        return;
+    }
+    uint64_t seq = ++timerSeq_;
+    timerSeqs_[event] = seq;
+    timers_.push({timePoint, seq, event});
+    if (timers_.size() > MIN_TIMER_COMPACT_SIZE && timers_.size() > MAX_TIMER_NODE_MULTIPLE * timerSeqs_.size()) {
+        CompactTimers();
+    }
+}
 
-    for (auto event : polling_) {
-        if (event == nullptr) {
-            continue;
-        }
+void EventLoopImpl::CancelTimer(EventImpl *event)
+{
+    // The node in heap is dropped when it reaches the top.
+    timerSeqs_.erase(event);
+}
 
-        EventTime t;
-        bool valid = event->GetTimeoutPoint(t);
-        if (!valid) {
-            continue;
-        }
+bool EventLoopImpl::IsTimerNodeValid(const TimerNode &node) const
+{
+    auto iter = timerSeqs_.find(node.event);
+    return iter != timerSeqs_.end() && iter->second == node.seq;
+}
 
-        if (t <= now) {
-            return 0;
+void EventLoopImpl::PopExpiredTimers(EventTime now, std::set<EventImpl *> &expiredEvents)
+{
+    while (!timers_.empty() && timers_.top().timePoint <= now) {
+        TimerNode node = timers_.top();
+        timers_.pop();
+        if (IsTimerNodeValid(node)) {
+            timerSeqs_.erase(node.event); // scheduled again after dispatched
+            expiredEvents.insert(node.event);
         }
+    }
+}
 
-        EventTime interval = t - now;
-        if (interval < minInterval) {
-            minInterval = interval;
-        }
+void EventLoopImpl::CompactTimers()
+{
+    std::vector<TimerNode> nodes;
+    nodes.reserve(timerSeqs_.size());
+    for (const auto &item : timerSeqs_) {
+        EventTime timePoint = 0;
+        (void)item.first->GetTimeoutPoint(timePoint);
+        nodes.push_back({timePoint, item.second, item.first});
+    }
+    timers_ = TimerQueue(std::greater<TimerNode>(), std::move(nodes));
+}
+
+EventTime EventLoopImpl::CalSleepTime()
+{
+    while (!timers_.empty() && !IsTimerNodeValid(timers_.top())) {
+        timers_.pop();
+    }
+    if (timers_.empty()) {
+        return EventImpl::MAX_TIME_VALUE;
     }
 
-    return minInterval;
+    EventTime now = GetTime();
+    EventTime t = timers_.top().timePoint;
+    if (t <= now) {
+        return 0;
+    }
+    return std::min<EventTime>(t - now, EventImpl::MAX_TIME_VALUE);
 }
 
 int EventLoopImpl::DispatchAll()
 {
-    do {
-        EventTime now = GetTime();
-        pollingSetChanged_ = false;
-
-        for (auto event : polling_) {
-            if (IsKilled()) {
-                return -E_OBJ_IS_KILLED;
-            }
-            if (event == nullptr) {
-                continue;
-            }
+    EventTime now = GetTime();
+    std::set<EventImpl *> dispatchEvents = fdEvents_;
+    PopExpiredTimers(now, dispatchEvents);
 
-            RefObject::IncObjRef(event);
-            event->UpdateElapsedTime(now);
-            int errCode = event->Dispatch();
-            if (errCode != E_OK) {
-                RemoveEventObject(event);
-            } else {
-                event->SetRevents(0);
-            }
-            RefObject::DecObjRef(event);
+    for (auto event : dispatchEvents) {
+        if (IsKilled()) {
+            return -E_OBJ_IS_KILLED;
+        }
+        if (event == nullptr || !EventObjectExists(event)) {
+            continue;
+        }
 
-            if (pollingSetChanged_) {
-                break;
+        RefObject::IncObjRef(event);
+        event->UpdateElapsedTime(now);
+        int errCode = event->Dispatch();
+        if (errCode != E_OK) {
+            RemoveEventObject(event);
+        } else {
+            event->SetRevents(0);
+            if (timerSeqs_.find(event) == timerSeqs_.end()) {
+                ScheduleTimer(event); // the expired timer starts a new period
             }
         }
-    } while (pollingSetChanged_);
+        RefObject::DecObjRef(event);
+    }
     return E_OK;
 }
 
@@ -560,6 +609,9 @@ void EventLoopImpl::CleanLoop()
 
     ProcessRequest();
     std::set<EventImpl *> polling = std::move(polling_);
+    fdEvents_.clear();
+    timers_ = TimerQueue();
+    timerSeqs_.clear();
     int errCode = Exit(polling);
     if (errCode != E_OK) {
         LOGE("Exit loop failed when cleanup, err:'%d'.", errCode);
@@ -16,9 +16,13 @@
 #ifndef EVENT_LOOP_IMPL_H
 #define EVENT_LOOP_IMPL_H
 
+#include <functional>
 #include <list>
+#include <queue>
 #include <set>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 #include "platform_specific.h"
 #include "ievent_loop.h"
 #include "ievent.h"
@@ -60,6 +64,18 @@ private:
     virtual int ModifyEvent(EventImpl *event, bool isAdd, EventsMask events) = 0;
     virtual EventTime GetTime() const;
 
+    // The node is stale if the timer is rescheduled or canceled after it is pushed.
+    struct TimerNode {
+        EventTime timePoint;
+        uint64_t seq;
+        EventImpl *event;
+        bool operator>(const TimerNode &other) const
+        {
+            return timePoint > other.timePoint;
+        }
+    };
+    using TimerQueue = std::priority_queue<TimerNode, std::vector<TimerNode>, std::greater<TimerNode>>;
+
     template<typename T>
     int QueueRequest(int type, EventImpl *event, T argument);
     int SendRequestToLoop(EventRequest *eventRequest);
@@ -71,14 +87,22 @@ private:
     int ModifyEventObject(EventImpl *event, EventTime timeout);
     void ProcessRequest(std::list<EventRequest *> &requests);
     int ProcessRequest();
-    EventTime CalSleepTime() const;
+    void ScheduleTimer(EventImpl *event);
+    void CancelTimer(EventImpl *event);
+    bool IsTimerNodeValid(const TimerNode &node) const;
+    void PopExpiredTimers(EventTime now, std::set<EventImpl *> &expiredEvents);
+    void CompactTimers();
+    EventTime CalSleepTime();
     int DispatchAll();
     void CleanLoop();
     void OnKillLoop();
 
     std::list<EventRequest *> requests_;
     std::set<EventImpl *> polling_;
-    bool pollingSetChanged_;
+    std::set<EventImpl *> fdEvents_; // only the events with fd may be woken up by poll
+    TimerQueue timers_; // min-heap of the timeout points, only the expired timers are dispatched
+    std::unordered_map<EventImpl *, uint64_t> timerSeqs_; // the seq of the valid node of each timer
+    uint64_t timerSeq_;
     std::thread::id loopThread_;
     volatile bool running_;
 };
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hash_identifier_cache.h"
+
+#include <mutex>
+
+#include "db_common.h"
+
+namespace DistributedDB {
+HashIdentifierCache &HashIdentifierCache::GetInstance()
+{
+    static HashIdentifierCache instance;
+    return instance;
+}
+
+std::string HashIdentifierCache::GetHashString(const std::string &identifier)
+{
+    if (identifier.empty()) {
+        return "";
+    }
+    {
+        std::shared_lock<std::shared_mutex> readLock(cacheLock_);
+        auto iter = cache_.find(identifier);
+        if (iter != cache_.end()) {
+            hitCount_.fetch_add(1, std::memory_order_relaxed);
+            return iter->second;
+        }
+    }
+    missCount_.fetch_add(1, std::memory_order_relaxed);
+    std::string hashString = DBCommon::TransferHashString(identifier);
+    if (hashString.empty()) {
+        // calc hash failed, do not cache it
+        return hashString;
+    }
+    std::unique_lock<std::shared_mutex> writeLock(cacheLock_);
+    if (cache_.size() >= MAX_CACHE_ITEMS && cache_.find(identifier) == cache_.end()) {
+        // identifiers are few in practice, drop all when it is full to keep the cache bounded
+        cache_.clear();
+    }
+    cache_[identifier] = hashString;
+    return hashString;
+}
+
+void HashIdentifierCache::GetStatistics(uint64_t &hitCount, uint64_t &missCount) const
+{
+    hitCount = hitCount_.load(std::memory_order_relaxed);
+    missCount = missCount_.load(std::memory_order_relaxed);
+}
+
+void HashIdentifierCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> writeLock(cacheLock_);
+    cache_.clear();
+    hitCount_.store(0, std::memory_order_relaxed);
+    missCount_.store(0, std::memory_order_relaxed);
+}
+} // namespace DistributedDB
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lz4_compression.h"
+#ifdef USE_DISTRIBUTEDDB_LZ4
+#include <lz4frame.h>
+
+#include "db_constant.h"
+#include "db_errno.h"
+#include "log_print.h"
+#include "types_export.h"
+
+namespace DistributedDB {
+namespace {
+int CheckLz4Result(size_t ret, const char *step)
+{
+    if (LZ4F_isError(ret)) {
+        LOGE("[Lz4Compression] %s failed, %s", step, LZ4F_getErrorName(ret));
+        return -E_SYSTEM_API_FAIL;
+    }
+    return E_OK;
+}
+
+class Lz4CompressionStream final : public DataCompressionStream {
+public:
+    Lz4CompressionStream() = default;
+    ~Lz4CompressionStream() override
+    {
+        if (context_ != nullptr) {
+            (void)LZ4F_freeCompressionContext(context_);
+            context_ = nullptr;
+        }
+    }
+
+    int Init(uint32_t srcLen)
+    {
+        size_t destLen = LZ4F_compressFrameBound(srcLen, nullptr);
+        if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+            LOGE("[Lz4Compression] Too long to compress, srcLen:%" PRIu32 ", destLen:%zu.", srcLen, destLen);
+            return -E_INVALID_ARGS;
+        }
+        int errCode = CheckLz4Result(LZ4F_createCompressionContext(&context_, LZ4F_VERSION), "create context");
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        destData_.resize(destLen);
+        size_t ret = LZ4F_compressBegin(context_, destData_.data(), destData_.size(), nullptr);
+        return UpdateDestPos(ret, "compress begin");
+    }
+
+    int Append(const uint8_t *data, uint32_t len) override
+    {
+        if (len == 0) {
+            return E_OK;
+        }
+        int errCode = Reserve(LZ4F_compressBound(len, nullptr));
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        size_t ret = LZ4F_compressUpdate(context_, destData_.data() + destPos_, destData_.size() - destPos_, data,
+            len, nullptr);
+        return UpdateDestPos(ret, "compress update");
+    }
+
+    int Finish(std::vector<uint8_t> &destData) override
+    {
+        int errCode = Reserve(LZ4F_compressBound(0, nullptr));
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        size_t ret = LZ4F_compressEnd(context_, destData_.data() + destPos_, destData_.size() - destPos_, nullptr);
+        errCode = UpdateDestPos(ret, "compress end");
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        destData_.resize(destPos_);
+        destData_.shrink_to_fit();
+        destData = std::move(destData_);
+        return E_OK;
+    }
+
+private:
+    // The frame bound is enough in general, the buffer is only extended for the worst case of each update
+    int Reserve(size_t len)
+    {
+        if (context_ == nullptr) {
+            return -E_INVALID_ARGS;
+        }
+        if (destPos_ + len <= destData_.size()) {
+            return E_OK;
+        }
+        if (destPos_ + len > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+            LOGE("[Lz4Compression] Too long to compress, destLen:%zu.", destPos_ + len);
+            return -E_INVALID_ARGS;
+        }
+        destData_.resize(destPos_ + len);
+        return E_OK;
+    }
+
+    int UpdateDestPos(size_t ret, const char *step)
+    {
+        int errCode = CheckLz4Result(ret, step);
+        if (errCode == E_OK) {
+            destPos_ += ret;
+        }
+        return errCode;
+    }
+
+    LZ4F_cctx *context_ = nullptr;
+    std::vector<uint8_t> destData_;
+    size_t destPos_ = 0;
+};
+}
+
+static Lz4Compression g_lz4Instance;
+
+Lz4Compression::Lz4Compression()
+{
+    DataCompression::Register(CompressAlgorithm::LZ4, this);
+}
+
+int Lz4Compression::Compress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData) const
+{
+    auto srcLen = srcData.size();
+    auto destLen = LZ4F_compressFrameBound(srcLen, nullptr);
+    if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+        LOGE("[Lz4Compression] Too long to compress, srcLen:%zu, destLen:%zu.", srcLen, destLen);
+        return -E_INVALID_ARGS;
+    }
+
+    destData.resize(destLen);
+    size_t ret = LZ4F_compressFrame(destData.data(), destLen, srcData.data(), srcLen, nullptr);
+    int errCode = CheckLz4Result(ret, "compress frame");
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    destData.resize(ret);
+    destData.shrink_to_fit();
+    return E_OK;
+}
+
+int Lz4Compression::Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData,
+    uint32_t destLen) const
+{
+    auto srcLen = srcData.size();
+    if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+        LOGE("[Lz4Compression] Too long to uncompress, srcLen:%zu, destLen:%" PRIu32 ".", srcLen, destLen);
+        return -E_INVALID_ARGS;
+    }
+    LZ4F_dctx *context = nullptr;
+    int errCode = CheckLz4Result(LZ4F_createDecompressionContext(&context, LZ4F_VERSION), "create context");
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    destData.resize(destLen);
+    size_t srcPos = 0;
+    size_t destPos = 0;
+    size_t ret = 1; // 0 means the frame is fully decoded
+    while (ret != 0 && srcPos < srcLen) {
+        size_t srcSize = srcLen - srcPos;
+        size_t destSize = destLen - destPos;
+        ret = LZ4F_decompress(context, destData.data() + destPos, &destSize, srcData.data() + srcPos, &srcSize,
+            nullptr);
+        errCode = CheckLz4Result(ret, "decompress");
+        if (errCode != E_OK) {
+            break;
+        }
+        if (srcSize == 0 && destSize == 0) {
+            break; // no progress, the dest buffer is not enough
+        }
+        srcPos += srcSize;
+        destPos += destSize;
+    }
+    (void)LZ4F_freeDecompressionContext(context);
+    if (errCode != E_OK || ret != 0) {
+        LOGE("[Lz4Compression] Uncompress failed, errCode = %d, hint = %zu", errCode, ret);
+        return -E_SYSTEM_API_FAIL;
+    }
+
+    destData.resize(destPos);
+    destData.shrink_to_fit();
+    return E_OK;
+}
+
+std::unique_ptr<DataCompressionStream> Lz4Compression::CreateCompressionStream(uint32_t srcLen) const
+{
+    auto stream = std::make_unique<Lz4CompressionStream>();
+    if (stream->Init(srcLen) != E_OK) {
+        return nullptr;
+    }
+    return stream;
+}
+}  // namespace DistributedDB
+#endif // USE_DISTRIBUTEDDB_LZ4
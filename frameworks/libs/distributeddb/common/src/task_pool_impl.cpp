@@ -17,20 +17,41 @@
 #include "log_print.h"
 
 namespace DistributedDB {
+namespace {
+    // The worker slot of current thread, used to put the tasks scheduled inside a task to the local slot.
+    struct WorkerContext {
+        const TaskPool *pool = nullptr;
+        size_t slotIndex = 0;
+    };
+    thread_local WorkerContext g_workerContext;
+}
+
 constexpr int TaskPoolImpl::IDLE_WAIT_PERIOD;
+constexpr size_t TaskPoolImpl::QUEUE_SHARD_COUNT;
 
 TaskPoolImpl::TaskPoolImpl(int maxThreads, int minThreads)
-    : genericTasks_(false),
+    : isStarted_(false),
+      isStopping_(false),
+      nextSlot_(0),
+      genericThread_(std::thread::id()),
       genericTaskCount_(0),
       queuedTaskCount_(0),
-      isStarted_(false),
-      isStopping_(false),
+      pendingGenericItems_(0),
+      pendingQueuedItems_(0),
+      executedTaskCount_(0),
+      stolenTaskCount_(0),
+      totalWaitTimeUs_(0),
+      maxWaitTimeUs_(0),
       maxThreads_(maxThreads),
       minThreads_(minThreads),
       curThreads_(0),
       idleThreads_(0),
       exitingThreads_(0)
-{}
+{
+    for (int i = 0; i < maxThreads_; ++i) {
+        slots_.push_back(std::make_unique<WorkerSlot>());
+    }
+}
 
 TaskPoolImpl::~TaskPoolImpl()
 {}
@@ -51,9 +72,10 @@ int TaskPoolImpl::Start()
         return -E_INVALID_ARGS;
     }
     LOGI("Start task pool min:%d, max:%d", minThreads_, maxThreads_);
-    std::lock_guard<std::mutex> guard(tasksMutex_);
+    std::unique_lock<std::shared_mutex> stateLock(stateMutex_);
     isStarted_ = true; // parameters checked ok.
     isStopping_ = false;
+    std::lock_guard<std::mutex> guard(threadsMutex_);
     int errCode = SpawnThreads(true);
     if (errCode != E_OK) {
         LOGW("Spawn threads failed when starting the task pool.");
@@ -64,15 +86,21 @@ int TaskPoolImpl::Start()
 
 void TaskPoolImpl::Stop()
 {
-    std::unique_lock<std::mutex> lock(tasksMutex_);
-    if (!isStarted_) {
-        return;
+    {
+        std::unique_lock<std::shared_mutex> stateLock(stateMutex_);
+        if (!isStarted_) {
+            return;
+        }
+        isStopping_ = true;
     }
-    isStopping_ = true;
-    hasTasks_.notify_all();
-    allThreadsExited_.wait(lock, [this]() {
-        return this->curThreads_ <= 0 && this->exitingThreads_ <= 0;
-    });
+    {
+        std::unique_lock<std::mutex> lock(threadsMutex_);
+        hasTasks_.notify_all();
+        allThreadsExited_.wait(lock, [this]() {
+            return this->curThreads_ <= 0 && this->exitingThreads_ <= 0;
+        });
+    }
+    std::unique_lock<std::shared_mutex> stateLock(stateMutex_);
     isStarted_ = false;
 }
 
@@ -81,7 +109,7 @@ int TaskPoolImpl::Schedule(const Task &task)
     if (!task) {
         return -E_INVALID_ARGS;
     }
-    std::lock_guard<std::mutex> guard(tasksMutex_);
+    std::shared_lock<std::shared_mutex> stateLock(stateMutex_);
     if (!isStarted_) {
         LOGE("Schedule failed, the task pool is not started.");
         return -E_NOT_PERMIT;
@@ -90,10 +118,9 @@ int TaskPoolImpl::Schedule(const Task &task)
         LOGI("Schedule failed, the task pool is stopping.");
         return -E_STALE;
     }
-    genericTasks_.PutTask(task);
     ++genericTaskCount_;
-    hasTasks_.notify_one();
-    TryToSpawnThreads();
+    PushItem({{task, std::chrono::steady_clock::now()}, nullptr, 0}, false);
+    NotifyOrSpawn(false);
     return E_OK;
 }
 
@@ -102,7 +129,7 @@ int TaskPoolImpl::Schedule(const std::string &queueTag, const Task &task)
     if (!task) {
         return -E_INVALID_ARGS;
     }
-    std::lock_guard<std::mutex> guard(tasksMutex_);
+    std::shared_lock<std::shared_mutex> stateLock(stateMutex_);
     if (!isStarted_) {
         LOGE("Schedule failed, the task pool is not started.");
         return -E_NOT_PERMIT;
@@ -111,101 +138,231 @@ int TaskPoolImpl::Schedule(const std::string &queueTag, const Task &task)
         LOGI("Schedule failed, the task pool is stopping.");
         return -E_STALE;
     }
-    queuedTasks_[queueTag].PutTask(task);
     ++queuedTaskCount_;
-    hasTasks_.notify_all();
-    TryToSpawnThreads();
+    size_t shardIndex = std::hash<std::string>{}(queueTag) % QUEUE_SHARD_COUNT;
+    TaskQueue *queue = nullptr;
+    bool needRun = false;
+    {
+        std::lock_guard<std::mutex> shardGuard(shards_[shardIndex].shardMutex);
+        queue = &shards_[shardIndex].queues[queueTag];
+        needRun = queue->PutTask(task);
+    }
+    // The queue is running in some thread otherwise, the task will be ran after the previous one finished.
+    if (needRun) {
+        PushItem({{}, queue, shardIndex}, true);
+        NotifyOrSpawn(true);
+    }
     return E_OK;
 }
 
 void TaskPoolImpl::ShrinkMemory(const std::string &tag)
 {
-    std::lock_guard<std::mutex> guard(tasksMutex_);
-    auto iter = queuedTasks_.find(tag);
-    if (iter != queuedTasks_.end()) {
-        if (iter->second.IsEmptyAndUnlocked()) {
-            queuedTasks_.erase(iter);
+    QueueShard &shard = shards_[std::hash<std::string>{}(tag) % QUEUE_SHARD_COUNT];
+    std::lock_guard<std::mutex> shardGuard(shard.shardMutex);
+    auto iter = shard.queues.find(tag);
+    if (iter != shard.queues.end()) {
+        if (iter->second.IsEmptyAndIdle()) {
+            shard.queues.erase(iter);
         }
     }
 }
 
-bool TaskPoolImpl::IdleExit(std::unique_lock<std::mutex> &lock)
+void TaskPoolImpl::GetStatistic(TaskPoolStatistic &statistic) const
 {
-    if (isStopping_) {
-        return true;
+    statistic.curThreads = curThreads_;
+    statistic.idleThreads = idleThreads_;
+    statistic.genericTaskDepth = pendingGenericItems_;
+    statistic.queuedTaskDepth = 0;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> shardGuard(const_cast<std::mutex &>(shard.shardMutex));
+        for (const auto &pair : shard.queues) {
+            statistic.queuedTaskDepth += static_cast<int>(pair.second.GetTaskCount());
+        }
     }
+    statistic.executedTaskCount = executedTaskCount_;
+    statistic.stolenTaskCount = stolenTaskCount_;
+    statistic.totalWaitTimeUs = totalWaitTimeUs_;
+    statistic.maxWaitTimeUs = maxWaitTimeUs_;
+}
+
+bool TaskPoolImpl::IdleExit(std::unique_lock<std::mutex> &lock, size_t slotIndex)
+{
     ++idleThreads_;
+    // Check again after idle counted, a task scheduled from now on will notify this thread.
+    if (HasRunnableTask()) {
+        --idleThreads_;
+        return false;
+    }
+    bool isExit = isStopping_;
     bool isGenericWorker = IsGenericWorker();
-    if (!isGenericWorker && (curThreads_ > minThreads_)) {
+    if (isExit) {
+        // All tasks can be ran by this thread are finished.
+    } else if (!isGenericWorker && (curThreads_ > minThreads_)) {
         std::cv_status status = hasTasks_.wait_for(lock,
             std::chrono::seconds(IDLE_WAIT_PERIOD));
-        if (status == std::cv_status::timeout && IsExecutingTasksEmpty()) {
-            --idleThreads_;
-            return true;
-        }
+        isExit = (status == std::cv_status::timeout && !HasRunnableTask());
     } else {
-        if (isGenericWorker) {
+        if (isGenericWorker && pendingQueuedItems_ > 0) {
             hasTasks_.notify_all();
         }
         hasTasks_.wait(lock);
     }
     --idleThreads_;
-    return false;
+    if (!isExit) {
+        return false;
+    }
+    // Idle thread exit, the items left in its slot will be stolen by others.
+    if (isGenericWorker) {
+        genericThread_ = std::thread::id();
+    }
+    slots_[slotIndex]->isOccupied = false;
+    g_workerContext = WorkerContext();
+    --curThreads_;
+    ++exitingThreads_;
+    // The generic worker may become the last thread and has to run the queued tasks.
+    hasTasks_.notify_all();
+    return true;
 }
 
-void TaskPoolImpl::SetThreadFree()
+bool TaskPoolImpl::HasRunnableTask() const
 {
-    for (auto &pair : queuedTasks_) {
-        TaskQueue *tq = &pair.second;
-        tq->ReleaseLock();
+    if (pendingGenericItems_ > 0) {
+        return true;
     }
+    if (IsGenericWorker() && (curThreads_ > 1)) { // 1 indicates self.
+        return false;
+    }
+    return pendingQueuedItems_ > 0;
 }
 
-Task TaskPoolImpl::ReapTask(TaskQueue *&queue)
+void TaskPoolImpl::PushItem(WorkItem &&item, bool isQueued)
 {
-    Task task = genericTasks_.GetTaskAutoLock();
-    if (task != nullptr) {
-        queue = nullptr;
-        return task;
+    size_t slotIndex = (g_workerContext.pool == this) ? g_workerContext.slotIndex :
+        (nextSlot_.fetch_add(1, std::memory_order_relaxed) % slots_.size());
+    WorkerSlot &slot = *slots_[slotIndex];
+    {
+        std::lock_guard<std::mutex> slotGuard(slot.slotMutex);
+        if (isQueued) {
+            slot.queuedItems.push_back(std::move(item));
+            ++slot.queuedCount;
+        } else {
+            slot.genericItems.push_back(std::move(item));
+            ++slot.genericCount;
+        }
     }
+    // Count after the item is visible, a thread sees the count can always find the item.
+    if (isQueued) {
+        ++pendingQueuedItems_;
+    } else {
+        ++pendingGenericItems_;
+    }
+}
 
-    queue = nullptr;
-    if (IsGenericWorker() && (curThreads_ > 1)) { // 1 indicates self.
-        SetThreadFree();
-        return nullptr;
-    }
-    for (auto &pair : queuedTasks_) {
-        TaskQueue *tq = &pair.second;
-        task = tq->GetTaskAutoLock();
-        if (task != nullptr) {
-            queue = tq;
-            return task;
+bool TaskPoolImpl::PopItem(size_t slotIndex, WorkItem &item)
+{
+    bool canRunQueued = !IsGenericWorker() || (curThreads_ <= 1); // 1 indicates self.
+    if (pendingGenericItems_ <= 0 && (!canRunQueued || pendingQueuedItems_ <= 0)) {
+        return false;
+    }
+    WorkerSlot &ownSlot = *slots_[slotIndex];
+    if (PopItemFromSlot(ownSlot, false, item) || (canRunQueued && PopItemFromSlot(ownSlot, true, item))) {
+        return true;
+    }
+    for (size_t i = 1; i < slots_.size(); ++i) {
+        WorkerSlot &slot = *slots_[(slotIndex + i) % slots_.size()];
+        if (PopItemFromSlot(slot, false, item) || (canRunQueued && PopItemFromSlot(slot, true, item))) {
+            ++stolenTaskCount_;
+            return true;
         }
     }
-    return nullptr;
+    return false;
 }
 
-void TaskPoolImpl::GetTask(Task &task, TaskQueue *&queue)
+bool TaskPoolImpl::PopItemFromSlot(WorkerSlot &slot, bool isQueued, WorkItem &item)
 {
-    std::unique_lock<std::mutex> lock(tasksMutex_);
+    std::atomic<int> &itemCount = isQueued ? slot.queuedCount : slot.genericCount;
+    if (itemCount <= 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> slotGuard(slot.slotMutex);
+    std::deque<WorkItem> &items = isQueued ? slot.queuedItems : slot.genericItems;
+    if (items.empty()) {
+        return false;
+    }
+    item = std::move(items.front());
+    items.pop_front();
+    --itemCount;
+    if (isQueued) {
+        --pendingQueuedItems_;
+    } else {
+        --pendingGenericItems_;
+    }
+    return true;
+}
 
-    while (true) {
-        task = ReapTask(queue);
-        if (task != nullptr) {
-            return;
+void TaskPoolImpl::NotifyOrSpawn(bool isQueued)
+{
+    if (idleThreads_ > 0) {
+        std::lock_guard<std::mutex> guard(threadsMutex_);
+        if (isQueued) {
+            // The generic worker may not run queued tasks, wake up all to make sure someone takes it.
+            hasTasks_.notify_all();
+        } else {
+            hasTasks_.notify_one();
         }
+    }
+    TryToSpawnThreads();
+}
 
-        if (IdleExit(lock)) {
-            break;
-        }
+void TaskPoolImpl::ExecuteItem(WorkItem &item)
+{
+    if (item.queue == nullptr) {
+        RecordWaitTime(item.pending.scheduleTime);
+        item.pending.task();
+        --genericTaskCount_;
+        return;
     }
-    if (task == nullptr) {
-        // Idle thread exit.
-        if (IsGenericWorker()) {
-            genericThread_ = std::thread::id();
-        }
-        --curThreads_;
-        ++exitingThreads_;
+    ExecuteQueuedItem(item);
+}
+
+void TaskPoolImpl::ExecuteQueuedItem(WorkItem &item)
+{
+    QueueShard &shard = shards_[item.shardIndex];
+    PendingTask pending;
+    {
+        std::lock_guard<std::mutex> shardGuard(shard.shardMutex);
+        pending = item.queue->GetTask();
+    }
+    if (pending.task) {
+        RecordWaitTime(pending.scheduleTime);
+        pending.task();
+        --queuedTaskCount_;
+    }
+    bool needRun = false;
+    {
+        std::lock_guard<std::mutex> shardGuard(shard.shardMutex);
+        needRun = item.queue->FinishTask();
+    }
+    if (!needRun) {
+        return;
+    }
+    // Put the queue back to the tail, so other queues in this slot get the chance to run.
+    PushItem(std::move(item), true);
+    if (idleThreads_ > 0) {
+        std::lock_guard<std::mutex> guard(threadsMutex_);
+        hasTasks_.notify_all();
+    }
+}
+
+void TaskPoolImpl::RecordWaitTime(const std::chrono::steady_clock::time_point &scheduleTime)
+{
+    auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - scheduleTime).count();
+    uint64_t waitTimeUs = (waitTime > 0) ? static_cast<uint64_t>(waitTime) : 0;
+    ++executedTaskCount_;
+    totalWaitTimeUs_ += waitTimeUs;
+    uint64_t maxWaitTimeUs = maxWaitTimeUs_;
+    while (waitTimeUs > maxWaitTimeUs && !maxWaitTimeUs_.compare_exchange_weak(maxWaitTimeUs, waitTimeUs)) {
     }
 }
 
@@ -226,7 +383,7 @@ int TaskPoolImpl::SpawnThreads(bool isStart)
         std::thread thread([this]() {
             TaskWorker();
         });
-        LOGI("Task pool spawn cur:%d idle:%d.", curThreads_, idleThreads_);
+        LOGI("Task pool spawn cur:%d idle:%d.", curThreads_.load(), idleThreads_.load());
         thread.detach();
     }
     return E_OK;
@@ -237,74 +394,61 @@ bool TaskPoolImpl::IsGenericWorker() const
     return genericThread_ == std::this_thread::get_id();
 }
 
-void TaskPoolImpl::BecomeGenericWorker()
+size_t TaskPoolImpl::BecomeWorker()
 {
-    std::lock_guard<std::mutex> guard(tasksMutex_);
+    std::lock_guard<std::mutex> guard(threadsMutex_);
     if (genericThread_ == std::thread::id()) {
         genericThread_ = std::this_thread::get_id();
     }
+    // The count of threads never exceeds the count of slots, there is always a free one.
+    size_t slotIndex = 0;
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        if (!slots_[i]->isOccupied) {
+            slotIndex = i;
+            break;
+        }
+    }
+    slots_[slotIndex]->isOccupied = true;
+    g_workerContext = { this, slotIndex };
+    return slotIndex;
 }
 
 void TaskPoolImpl::ExitWorker()
 {
-    std::lock_guard<std::mutex> guard(tasksMutex_);
+    std::lock_guard<std::mutex> guard(threadsMutex_);
     allThreadsExited_.notify_all();
     --exitingThreads_;
     LOGI("Task pool thread exit, cur:%d idle:%d, genericTaskCount:%d, queuedTaskCount:%d.",
-        curThreads_, idleThreads_, genericTaskCount_, queuedTaskCount_);
+        curThreads_.load(), idleThreads_.load(), genericTaskCount_.load(), queuedTaskCount_.load());
 }
 
 void TaskPoolImpl::TaskWorker()
 {
-    BecomeGenericWorker();
+    size_t slotIndex = BecomeWorker();
 
     while (true) {
-        TaskQueue *taskQueue = nullptr;
-        Task task = nullptr;
-
-        GetTask(task, taskQueue);
-        if (task == nullptr) {
+        WorkItem item;
+        if (PopItem(slotIndex, item)) {
+            ExecuteItem(item);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(threadsMutex_);
+        if (IdleExit(lock, slotIndex)) {
             // Idle thread exit.
             break;
         }
-
-        task();
-        FinishExecuteTask(taskQueue);
     }
 
     ExitWorker();
 }
 
-void TaskPoolImpl::FinishExecuteTask(TaskQueue *taskQueue)
-{
-    std::lock_guard<std::mutex> guard(tasksMutex_);
-    if (taskQueue != nullptr) {
-        taskQueue->ReleaseLock();
-        --queuedTaskCount_;
-    } else {
-        --genericTaskCount_;
-    }
-}
-
 void TaskPoolImpl::TryToSpawnThreads()
 {
     if ((curThreads_ >= maxThreads_) ||
         (curThreads_ >= (queuedTaskCount_ + genericTaskCount_))) {
         return;
     }
+    std::lock_guard<std::mutex> guard(threadsMutex_);
     (void)(SpawnThreads(false));
 }
-
-bool TaskPoolImpl::IsExecutingTasksEmpty() const
-{
-    if (genericTaskCount_ > 0) {
-        return false;
-    }
-    for (const auto &item: queuedTasks_) {
-        if (item.second.CanGetTask()) {
-            return false;
-        }
-    }
-    return true;
-}
 } // namespace DistributedDB
@@ -16,11 +16,16 @@
 #ifndef TASK_POOL_IMPL_H
 #define TASK_POOL_IMPL_H
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "task_pool.h"
 #include "task_queue.h"
@@ -46,41 +51,86 @@ public:
     // Shrink memory associated with the given tag if possible.
     void ShrinkMemory(const std::string &tag) override;
 
+    // Get the queue depth and wait time counters.
+    void GetStatistic(TaskPoolStatistic &statistic) const override;
+
 protected:
     ~TaskPoolImpl();
 
 private:
+    // A generic task, or a tagged queue whose front task is ready to run.
+    struct WorkItem {
+        PendingTask pending;
+        TaskQueue *queue = nullptr;
+        size_t shardIndex = 0;
+    };
+
+    // Each worker thread owns a slot, it runs the items of its own slot first and steals from others when empty.
+    struct WorkerSlot {
+        std::mutex slotMutex;
+        std::deque<WorkItem> genericItems;
+        std::deque<WorkItem> queuedItems;
+        std::atomic<int> genericCount {0}; // size of genericItems, checked before taking the lock.
+        std::atomic<int> queuedCount {0}; // size of queuedItems, checked before taking the lock.
+        bool isOccupied = false; // guarded by threadsMutex_.
+    };
+
+    // Tagged queues are split into shards, so queues with different tags seldom contend for one lock.
+    struct QueueShard {
+        std::mutex shardMutex;
+        std::map<std::string, TaskQueue> queues;
+    };
+
     int SpawnThreads(bool isStart);
-    bool IdleExit(std::unique_lock<std::mutex> &lock);
-    void SetThreadFree();
-    Task ReapTask(TaskQueue *&queue);
-    void GetTask(Task &task, TaskQueue *&queue);
+    bool IdleExit(std::unique_lock<std::mutex> &lock, size_t slotIndex);
+    bool HasRunnableTask() const;
+    void PushItem(WorkItem &&item, bool isQueued);
+    bool PopItem(size_t slotIndex, WorkItem &item);
+    bool PopItemFromSlot(WorkerSlot &slot, bool isQueued, WorkItem &item);
+    void NotifyOrSpawn(bool isQueued);
+    void ExecuteItem(WorkItem &item);
+    void ExecuteQueuedItem(WorkItem &item);
+    void RecordWaitTime(const std::chrono::steady_clock::time_point &scheduleTime);
     bool IsGenericWorker() const;
-    void BecomeGenericWorker();
+    size_t BecomeWorker();
     void ExitWorker();
     void TaskWorker();
-    void FinishExecuteTask(TaskQueue *taskQueue);
     void TryToSpawnThreads();
-    bool IsExecutingTasksEmpty() const;
 
     // Member Variables.
     static constexpr int IDLE_WAIT_PERIOD = 1;  // wait 1 second before exiting.
-    std::mutex tasksMutex_;
-    std::condition_variable hasTasks_;
-    std::map<std::string, TaskQueue> queuedTasks_;
-    TaskQueue genericTasks_;
-    std::thread::id genericThread_;  // execute generic task only.
-    int genericTaskCount_;
-    int queuedTaskCount_;
+    static constexpr size_t QUEUE_SHARD_COUNT = 16;
+
+    // Guard the start and stop state, Schedule only takes it shared.
+    mutable std::shared_mutex stateMutex_;
     bool isStarted_;
-    bool isStopping_;   // Stop() invoked.
+    std::atomic<bool> isStopping_;   // Stop() invoked, workers read it without the state lock.
+
+    std::vector<std::unique_ptr<WorkerSlot>> slots_;
+    std::atomic<size_t> nextSlot_;
+    QueueShard shards_[QUEUE_SHARD_COUNT];
+
+    // Guard the thread counters, only used when threads spawn, exit or sleep.
+    std::mutex threadsMutex_;
+    std::condition_variable hasTasks_;
     std::condition_variable allThreadsExited_;
+    std::atomic<std::thread::id> genericThread_;  // execute generic task only.
+
+    // Task counters.
+    std::atomic<int> genericTaskCount_; // generic tasks not finished.
+    std::atomic<int> queuedTaskCount_; // tagged tasks not finished.
+    std::atomic<int> pendingGenericItems_; // generic items waiting in slots.
+    std::atomic<int> pendingQueuedItems_; // tagged queue items waiting in slots.
+    std::atomic<uint64_t> executedTaskCount_;
+    std::atomic<uint64_t> stolenTaskCount_;
+    std::atomic<uint64_t> totalWaitTimeUs_;
+    std::atomic<uint64_t> maxWaitTimeUs_;
 
     // Thread counter.
     int maxThreads_;
     int minThreads_;
-    int curThreads_;
-    int idleThreads_;
+    std::atomic<int> curThreads_;
+    std::atomic<int> idleThreads_;
     int exitingThreads_;
 };
 } // namespace DistributedDB
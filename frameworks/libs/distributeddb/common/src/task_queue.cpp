@@ -16,70 +16,53 @@
 #include "task_queue.h"
 
 namespace DistributedDB {
-TaskQueue::TaskQueue(bool lockable)
-    :lockable_(lockable)
+TaskQueue::TaskQueue()
+    : isRunning_(false)
 {}
 
 TaskQueue::~TaskQueue()
 {}
 
-void TaskQueue::PutTask(const Task &task)
+bool TaskQueue::PutTask(const Task &task)
 {
     if (!task) {
-        return;
+        return false;
     }
-    tasks_.push(task);
+    tasks_.push({task, std::chrono::steady_clock::now()});
+    if (isRunning_) {
+        return false;
+    }
+    isRunning_ = true;
+    return true;
 }
 
-Task TaskQueue::GetTaskAutoLock()
+PendingTask TaskQueue::GetTask()
 {
-    if (lockable_) {
-        std::thread::id thisId = std::this_thread::get_id();
-        if (thisId != lockThread_) {
-            if (lockThread_ == std::thread::id()) {
-                lockThread_ = thisId;
-            } else {
-                return nullptr;
-            }
-        }
-    }
     if (tasks_.empty()) {
-        ReleaseLock();
-        return nullptr;
+        return {nullptr, {}};
     }
     // copy and return
-    Task task = tasks_.front();
+    PendingTask task = tasks_.front();
     tasks_.pop();
     return task;
 }
 
-void TaskQueue::ReleaseLock()
+bool TaskQueue::FinishTask()
 {
-    if (!lockable_) {
-        return;
-    }
-    if (lockThread_ == std::this_thread::get_id()) {
-        lockThread_ = std::thread::id();
+    if (tasks_.empty()) {
+        isRunning_ = false;
+        return false;
     }
+    return true;
 }
 
-bool TaskQueue::IsEmptyAndUnlocked() const
+bool TaskQueue::IsEmptyAndIdle() const
 {
-    if (lockable_) {
-        if (lockThread_ != std::thread::id()) {
-            return false;
-        }
-    }
-    return tasks_.empty();
+    return !isRunning_ && tasks_.empty();
 }
 
-bool TaskQueue::CanGetTask() const
+size_t TaskQueue::GetTaskCount() const
 {
-    if (lockable_) {
-        if (lockThread_ != std::thread::id()) {
-            return false;
-        }
-    }
-    return !tasks_.empty();
+    return tasks_.size();
 }
 } // namespace DistributedDB
@@ -16,24 +16,32 @@
 #ifndef TASK_QUEUE_H
 #define TASK_QUEUE_H
 
-#include <thread>
+#include <chrono>
 #include <queue>
 #include "task_pool.h"
 
 namespace DistributedDB {
+struct PendingTask {
+    Task task;
+    std::chrono::steady_clock::time_point scheduleTime;
+};
+
+// Tasks with the same tag, run one by one in FIFO order. Not thread safe, guarded by the caller.
 class TaskQueue {
 public:
-    explicit TaskQueue(bool lockable = true);
+    TaskQueue();
     ~TaskQueue();
-    void PutTask(const Task &task);
-    Task GetTaskAutoLock();
-    void ReleaseLock();
-    bool IsEmptyAndUnlocked() const;
-    bool CanGetTask() const;
+    // Return true if the queue is idle, the caller should schedule the queue to run then.
+    bool PutTask(const Task &task);
+    // Get the front task and keep the queue running until FinishTask.
+    PendingTask GetTask();
+    // Return true if the queue still has tasks and should be scheduled again, or the queue become idle.
+    bool FinishTask();
+    bool IsEmptyAndIdle() const;
+    size_t GetTaskCount() const;
 private:
-    bool lockable_;
-    std::thread::id lockThread_;
-    std::queue<Task> tasks_;
+    bool isRunning_;
+    std::queue<PendingTask> tasks_;
 };
 } // namespace DistributedDB
 
@@ -23,6 +23,81 @@
 #include "types_export.h"
 
 namespace DistributedDB {
+namespace {
+class ZlibCompressionStream final : public DataCompressionStream {
+public:
+    ZlibCompressionStream() = default;
+    ~ZlibCompressionStream() override
+    {
+        if (isInit_) {
+            (void)deflateEnd(&stream_);
+        }
+    }
+
+    int Init(uint32_t srcLen)
+    {
+        auto destLen = compressBound(srcLen);
+        if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+            LOGE("Too long to compress, srcLen:%" PRIu32 ", destLen:%lu.", srcLen, destLen);
+            return -E_INVALID_ARGS;
+        }
+        // Same level as compress, the result is the same format
+        int errCode = deflateInit(&stream_, Z_DEFAULT_COMPRESSION);
+        if (errCode != Z_OK) {
+            LOGE("Init deflate stream failed, errCode = %d", errCode);
+            return -E_SYSTEM_API_FAIL;
+        }
+        isInit_ = true;
+        destData_.resize(destLen);
+        stream_.next_out = destData_.data();
+        stream_.avail_out = static_cast<uInt>(destLen);
+        return E_OK;
+    }
+
+    int Append(const uint8_t *data, uint32_t len) override
+    {
+        if (len == 0) {
+            return E_OK;
+        }
+        return Deflate(data, len, Z_NO_FLUSH);
+    }
+
+    int Finish(std::vector<uint8_t> &destData) override
+    {
+        int errCode = Deflate(nullptr, 0, Z_FINISH);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        destData_.resize(stream_.total_out);
+        destData_.shrink_to_fit();
+        destData = std::move(destData_);
+        return E_OK;
+    }
+
+private:
+    int Deflate(const uint8_t *data, uint32_t len, int flush)
+    {
+        if (!isInit_) {
+            return -E_INVALID_ARGS;
+        }
+        stream_.next_in = const_cast<Bytef *>(data);
+        stream_.avail_in = len;
+        // The out buffer is the bound of total data, so all input is consumed at once
+        int errCode = deflate(&stream_, flush);
+        bool isSuccess = (flush == Z_FINISH) ? (errCode == Z_STREAM_END) : (errCode == Z_OK && stream_.avail_in == 0);
+        if (!isSuccess) {
+            LOGE("Deflate stream failed, errCode = %d", errCode);
+            return -E_SYSTEM_API_FAIL;
+        }
+        return E_OK;
+    }
+
+    bool isInit_ = false;
+    z_stream stream_ {};
+    std::vector<uint8_t> destData_;
+};
+}
+
 static ZlibCompression g_zlibInstance;
 
 ZlibCompression::ZlibCompression()
@@ -54,6 +129,15 @@ int ZlibCompression::Compress(const std::vector<uint8_t> &srcData, std::vector<u
     return E_OK;
 }
 
+std::unique_ptr<DataCompressionStream> ZlibCompression::CreateCompressionStream(uint32_t srcLen) const
+{
+    auto stream = std::make_unique<ZlibCompressionStream>();
+    if (stream->Init(srcLen) != E_OK) {
+        return nullptr;
+    }
+    return stream;
+}
+
 int ZlibCompression::Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData,
     uint32_t destLen) const
 {
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "zstd_compression.h"
+#ifdef USE_DISTRIBUTEDDB_ZSTD
+#include <zstd.h>
+
+#include "db_constant.h"
+#include "db_errno.h"
+#include "log_print.h"
+#include "types_export.h"
+
+namespace DistributedDB {
+namespace {
+constexpr int ZSTD_COMPRESSION_LEVEL = 1; // Sync packet is compressed on sync thread, prefer the speed
+
+int CheckZstdResult(size_t ret, const char *step)
+{
+    if (ZSTD_isError(ret)) {
+        LOGE("[ZstdCompression] %s failed, %s", step, ZSTD_getErrorName(ret));
+        return -E_SYSTEM_API_FAIL;
+    }
+    return E_OK;
+}
+
+class ZstdCompressionStream final : public DataCompressionStream {
+public:
+    ZstdCompressionStream() = default;
+    ~ZstdCompressionStream() override
+    {
+        if (context_ != nullptr) {
+            (void)ZSTD_freeCCtx(context_);
+            context_ = nullptr;
+        }
+    }
+
+    int Init(uint32_t srcLen)
+    {
+        size_t destLen = ZSTD_compressBound(srcLen);
+        if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+            LOGE("[ZstdCompression] Too long to compress, srcLen:%" PRIu32 ", destLen:%zu.", srcLen, destLen);
+            return -E_INVALID_ARGS;
+        }
+        context_ = ZSTD_createCCtx();
+        if (context_ == nullptr) {
+            LOGE("[ZstdCompression] Create context failed.");
+            return -E_OUT_OF_MEMORY;
+        }
+        int errCode = CheckZstdResult(ZSTD_CCtx_setParameter(context_, ZSTD_c_compressionLevel,
+            ZSTD_COMPRESSION_LEVEL), "set level");
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        destData_.resize(destLen);
+        return E_OK;
+    }
+
+    int Append(const uint8_t *data, uint32_t len) override
+    {
+        if (len == 0) {
+            return E_OK;
+        }
+        ZSTD_inBuffer input = { data, len, 0 };
+        while (input.pos < input.size) {
+            size_t ret = 0;
+            int errCode = CompressStream(input, ZSTD_e_continue, ret);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+        }
+        return E_OK;
+    }
+
+    int Finish(std::vector<uint8_t> &destData) override
+    {
+        ZSTD_inBuffer input = { nullptr, 0, 0 };
+        size_t ret = 1; // 0 means the frame is fully flushed
+        while (ret != 0) {
+            int errCode = CompressStream(input, ZSTD_e_end, ret);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+        }
+        destData_.resize(destPos_);
+        destData_.shrink_to_fit();
+        destData = std::move(destData_);
+        return E_OK;
+    }
+
+private:
+    int CompressStream(ZSTD_inBuffer &input, ZSTD_EndDirective endOp, size_t &ret)
+    {
+        if (context_ == nullptr) {
+            return -E_INVALID_ARGS;
+        }
+        if (destPos_ == destData_.size()) {
+            // The compress bound is enough in general, extend it for the worst case
+            size_t destLen = destData_.size() + ZSTD_CStreamOutSize();
+            if (destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+                LOGE("[ZstdCompression] Too long to compress, destLen:%zu.", destLen);
+                return -E_INVALID_ARGS;
+            }
+            destData_.resize(destLen);
+        }
+        ZSTD_outBuffer output = { destData_.data(), destData_.size(), destPos_ };
+        ret = ZSTD_compressStream2(context_, &output, &input, endOp);
+        int errCode = CheckZstdResult(ret, "compress stream");
+        if (errCode == E_OK) {
+            destPos_ = output.pos;
+        }
+        return errCode;
+    }
+
+    ZSTD_CCtx *context_ = nullptr;
+    std::vector<uint8_t> destData_;
+    size_t destPos_ = 0;
+};
+}
+
+static ZstdCompression g_zstdInstance;
+
+ZstdCompression::ZstdCompression()
+{
+    DataCompression::Register(CompressAlgorithm::ZSTD, this);
+}
+
+int ZstdCompression::Compress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData) const
+{
+    auto srcLen = srcData.size();
+    auto destLen = ZSTD_compressBound(srcLen);
+    if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+        LOGE("[ZstdCompression] Too long to compress, srcLen:%zu, destLen:%zu.", srcLen, destLen);
+        return -E_INVALID_ARGS;
+    }
+
+    destData.resize(destLen);
+    size_t ret = ZSTD_compress(destData.data(), destLen, srcData.data(), srcLen, ZSTD_COMPRESSION_LEVEL);
+    int errCode = CheckZstdResult(ret, "compress");
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    destData.resize(ret);
+    destData.shrink_to_fit();
+    return E_OK;
+}
+
+int ZstdCompression::Uncompress(const std::vector<uint8_t> &srcData, std::vector<uint8_t> &destData,
+    uint32_t destLen) const
+{
+    auto srcLen = srcData.size();
+    if (srcLen > DBConstant::MAX_SYNC_BLOCK_SIZE || destLen > DBConstant::MAX_SYNC_BLOCK_SIZE) {
+        LOGE("[ZstdCompression] Too long to uncompress, srcLen:%zu, destLen:%" PRIu32 ".", srcLen, destLen);
+        return -E_INVALID_ARGS;
+    }
+
+    destData.resize(destLen);
+    size_t ret = ZSTD_decompress(destData.data(), destLen, srcData.data(), srcLen);
+    int errCode = CheckZstdResult(ret, "decompress");
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    destData.resize(ret);
+    destData.shrink_to_fit();
+    return E_OK;
+}
+
+std::unique_ptr<DataCompressionStream> ZstdCompression::CreateCompressionStream(uint32_t srcLen) const
+{
+    auto stream = std::make_unique<ZstdCompressionStream>();
+    if (stream->Init(srcLen) != E_OK) {
+        return nullptr;
+    }
+    return stream;
+}
+}  // namespace DistributedDB
+#endif // USE_DISTRIBUTEDDB_ZSTD
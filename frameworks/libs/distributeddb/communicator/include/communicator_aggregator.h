@@ -23,6 +23,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "frame_combiner.h"
 #include "frame_retainer.h"
 #include "iadapter.h"
@@ -101,10 +102,12 @@ public:
 
     int32_t GetRetryCount(const std::string &dev, bool isRetryTask) const;
 private:
-    // Working in a dedicated thread
+    // Working in each dedicated send lane thread
     void SendDataRoutine();
-    void SendPacketsAndDisposeTask(const SendTask &inTask, uint32_t mtu,
-        const std::vector<std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>>> &eachPacket, uint32_t totalLength);
+    void SendPacketsAndDisposeTask(const SendTask &inTask, uint32_t mtu, uint16_t fragCount, uint32_t totalLength);
+    // fragCount equal zero means not split, in this case, the packet is the ori buff, else built into fragPacket
+    static int GetPacketToSend(const SendTask &inTask, uint16_t fragCount, uint32_t index,
+        std::vector<uint8_t> &fragPacket, std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>> &outPacket);
 
     int RetryUntilTimeout(SendTask &inTask, uint32_t timeout, Priority inPrio);
     void TaskFinalizer(const SendTask &inTask, int result);
@@ -190,8 +193,8 @@ private:
     FrameCombiner combiner_;
     FrameRetainer retainer_;
     
-    // Thread related
-    std::thread exclusiveThread_;
+    // Thread related, each thread is a send lane and lanes never send to the same target at the same time
+    std::vector<std::thread> exclusiveThreads_;
     bool wakingSignal_ = false;
     mutable std::mutex wakingMutex_;
     std::condition_variable wakingCv_;
@@ -217,7 +220,7 @@ private:
     std::shared_ptr<DBStatusAdapter> dbStatusAdapter_;
 
     std::atomic<bool> useExclusiveThread_ = false;
-    bool sendTaskStart_ = false;
+    uint32_t activeSendLaneCount_ = 0;
     mutable std::mutex scheduleSendTaskMutex_;
     std::condition_variable finalizeCv_;
 
@@ -73,6 +73,15 @@ public:
     // This method for consumer, call ScheduleOutSendTask at least one time before each calling this
     int FinalizeLastScheduleTask();
 
+    // These methods for parallel send lanes, support multiple thread. At most one task of each target is scheduled
+    // out by lanes at the same time, so tasks of the same target are still sent in order.
+    int ScheduleOutSendTaskByLane(SendTask &outTask, uint32_t &totalLength);
+    // Remove the task scheduled out by lane from schedule, returns as FinalizeLastScheduleTask
+    int FinalizeLaneScheduleTask(const std::string &target);
+    // Keep the task scheduled out by lane in schedule, it will be scheduled out again later
+    void ReleaseLaneScheduleTask(const std::string &target);
+    bool HasLaneSchedulableTask() const;
+
     // These two mothods influence the task that will be schedule out next time
     int DelayTaskByTarget(const std::string &inTarget);
     int NoDelayTaskByTarget(const std::string &inTarget);
@@ -97,6 +106,9 @@ public:
 private:
     int ScheduleDelayTask(SendTask &outTask, SendTaskInfo &outTaskInfo);
     int ScheduleNoDelayTask(SendTask &outTask, SendTaskInfo &outTaskInfo);
+    int FinalizeScheduleTaskNoMutex(const std::string &target, Priority prio);
+    bool FindLaneSchedulableTaskNoMutex(std::string &outTarget, Priority &outPrio) const;
+    const SendTask *GetFirstTaskByTargetNoMutex(const std::string &target) const;
 
     mutable std::mutex overallMutex_;
     uint32_t curTotalSizeByByte_ = 0;
@@ -116,6 +128,7 @@ private:
     bool scheduledFlag_ = false;
     std::string lastScheduleTarget_;
     Priority lastSchedulePriority_ = Priority::LOW;
+    std::map<std::string, Priority> laneScheduledTargets_;
 
     std::map<std::string, int> deviceCommErrCodeMap_;
 
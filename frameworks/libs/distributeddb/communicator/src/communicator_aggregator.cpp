@@ -28,6 +28,7 @@ namespace DistributedDB {
 #ifdef USE_DISTRIBUTEDDB_DEVICE
 namespace {
 constexpr int RETRY_TIME_SPLIT = 4;
+constexpr uint32_t MAX_SEND_LANE_NUM = 4; // At most 4 targets are sent to in parallel
 inline std::string GetThreadId()
 {
     std::stringstream stream;
@@ -113,16 +114,19 @@ void CommunicatorAggregator::Finalize()
     {
         std::lock_guard<std::mutex> wakingLockGuard(wakingMutex_);
         wakingSignal_ = true;
-        wakingCv_.notify_one();
+        wakingCv_.notify_all();
     }
     if (useExclusiveThread_) {
-        exclusiveThread_.join(); // Waiting thread to thoroughly quit
+        for (auto &laneThread : exclusiveThreads_) {
+            laneThread.join(); // Waiting thread to thoroughly quit
+        }
+        exclusiveThreads_.clear();
         LOGI("[CommAggr][Final] Sub Thread Exit.");
     } else {
         LOGI("[CommAggr][Final] Begin wait send task exit.");
         std::unique_lock<std::mutex> scheduleSendTaskLock(scheduleSendTaskMutex_);
         finalizeCv_.wait(scheduleSendTaskLock, [this]() {
-            return !sendTaskStart_;
+            return activeSendLaneCount_ == 0;
         });
         LOGI("[CommAggr][Final] End wait send task exit.");
     }
@@ -363,7 +367,7 @@ int CommunicatorAggregator::GetRemoteCommunicatorVersion(const std::string &targ
 void CommunicatorAggregator::SendDataRoutine()
 {
     while (!shutdown_) {
-        if (scheduler_.GetNoDelayTaskCount() == 0) {
+        if (!scheduler_.HasLaneSchedulableTask()) {
             std::unique_lock<std::mutex> wakingUniqueLock(wakingMutex_);
             LOGI("[CommAggr][Routine] Send done and sleep.");
             wakingCv_.wait(wakingUniqueLock, [this] { return this->wakingSignal_; });
@@ -375,8 +379,8 @@ void CommunicatorAggregator::SendDataRoutine()
     }
 }
 
-void CommunicatorAggregator::SendPacketsAndDisposeTask(const SendTask &inTask, uint32_t mtu,
-    const std::vector<std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>>> &eachPacket, uint32_t totalLength)
+void CommunicatorAggregator::SendPacketsAndDisposeTask(const SendTask &inTask, uint32_t mtu, uint16_t fragCount,
+    uint32_t totalLength)
 {
     bool taskNeedFinalize = true;
     int errCode = E_OK;
@@ -388,8 +392,18 @@ void CommunicatorAggregator::SendPacketsAndDisposeTask(const SendTask &inTask, u
     }
     uint64_t currentSendSequenceId = IncreaseSendSequenceId(inTask.dstTarget);
     DeviceInfos deviceInfos = {inTask.dstTarget, inTask.infos, inTask.isRetryTask};
-    for (uint32_t index = startIndex; index < static_cast<uint32_t>(eachPacket.size()) && inTask.isValid; ++index) {
-        auto &entry = eachPacket[index];
+    // Case that no need to split a frame, just use original buffer as a packet
+    uint32_t packetCount = (fragCount == 0) ? 1u : fragCount;
+    // Fragments are built right before sent, SendBytes does not hold the bytes after return so one packet is reused
+    std::vector<uint8_t> fragPacket;
+    for (uint32_t index = startIndex; index < packetCount && inTask.isValid; ++index) {
+        // <addr, <extendHeadSize, totalLen>>
+        std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>> entry;
+        errCode = GetPacketToSend(inTask, fragCount, index, fragPacket, entry);
+        if (errCode != E_OK) {
+            LOGE("[CommAggr][SendPackets] Build packet fail, index=%" PRIu32 ", errCode=%d.", index, errCode);
+            break;
+        }
         LOGI("[CommAggr][SendPackets] DoSendBytes, dstTarget=%s{private}, extendHeadLength=%" PRIu32
             ", packetLength=%" PRIu32 ".", inTask.dstTarget.c_str(), entry.second.first, entry.second.second);
         ProtocolProto::DisplayPacketInformation(entry.first + entry.second.first, entry.second.second);
@@ -412,6 +426,8 @@ void CommunicatorAggregator::SendPacketsAndDisposeTask(const SendTask &inTask, u
     }
     if (errCode == -E_WAIT_RETRY) {
         RetrySendTaskIfNeed(inTask.dstTarget, currentSendSequenceId, inTask.isRetryTask);
+        // Task stay in scheduler, let it be scheduled out again by any lane after target sendable
+        scheduler_.ReleaseLaneScheduleTask(inTask.dstTarget);
     }
     if (taskNeedFinalize) {
         TaskFinalizer(inTask, errCode);
@@ -420,6 +436,26 @@ void CommunicatorAggregator::SendPacketsAndDisposeTask(const SendTask &inTask, u
     }
 }
 
+int CommunicatorAggregator::GetPacketToSend(const SendTask &inTask, uint16_t fragCount, uint32_t index,
+    std::vector<uint8_t> &fragPacket, std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>> &outPacket)
+{
+    uint32_t extendHeadLength = inTask.buffer->GetExtendHeadLength();
+    if (fragCount == 0) {
+        std::pair<const uint8_t *, uint32_t> tmpEntry = inTask.buffer->GetReadOnlyBytesForEntireBuffer();
+        outPacket.first = tmpEntry.first - extendHeadLength;
+        outPacket.second.first = extendHeadLength;
+        outPacket.second.second = tmpEntry.second + extendHeadLength;
+        return E_OK;
+    }
+    int errCode = ProtocolProto::BuildFragmentPacket(inTask.buffer, fragCount, static_cast<uint16_t>(index),
+        fragPacket);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    outPacket = {fragPacket.data(), {extendHeadLength, static_cast<uint32_t>(fragPacket.size())}};
+    return E_OK;
+}
+
 int CommunicatorAggregator::RetryUntilTimeout(SendTask &inTask, uint32_t timeout, Priority inPrio)
 {
     int errCode = scheduler_.AddSendTaskIntoSchedule(inTask, inPrio);
@@ -464,7 +500,7 @@ void CommunicatorAggregator::TaskFinalizer(const SendTask &inTask, int result)
         inTask.onEnd(result, true);
     }
     // Finalize the task that just scheduled
-    int errCode = scheduler_.FinalizeLastScheduleTask();
+    int errCode = scheduler_.FinalizeLaneScheduleTask(inTask.dstTarget);
     // Notify Sendable To All Communicator If Need
     if (errCode == -E_CONTAINER_FULL_TO_NOTFULL) {
         retryCv_.notify_all();
@@ -1017,7 +1053,9 @@ void CommunicatorAggregator::InitSendThread()
     if (RuntimeContext::GetInstance()->GetThreadPool() != nullptr) {
         return;
     }
-    exclusiveThread_ = std::thread([this] { SendDataRoutine(); });
+    for (uint32_t i = 0; i < MAX_SEND_LANE_NUM; ++i) {
+        exclusiveThreads_.emplace_back([this] { SendDataRoutine(); });
+    }
     useExclusiveThread_ = true;
 }
 
@@ -1025,42 +1063,27 @@ void CommunicatorAggregator::SendOnceData()
 {
     SendTask taskToSend;
     uint32_t totalLength = 0;
-    int errCode = scheduler_.ScheduleOutSendTask(taskToSend, totalLength);
+    int errCode = scheduler_.ScheduleOutSendTaskByLane(taskToSend, totalLength);
     if (errCode != E_OK) {
-        return; // Not possible to happen
+        return; // Other lanes has taken the task
+    }
+    if (scheduler_.HasLaneSchedulableTask()) {
+        TriggerSendData(); // Wake up another lane for other target
     }
-    // <vector, extendHeadSize>
-    std::vector<std::pair<std::vector<uint8_t>, uint32_t>> piecePackets;
     uint32_t mtu = adapterHandle_->GetMtuSize(taskToSend.dstTarget);
     if (taskToSend.buffer == nullptr) {
         LOGE("[CommAggr] buffer of taskToSend is nullptr.");
+        scheduler_.ReleaseLaneScheduleTask(taskToSend.dstTarget);
         return;
     }
-    errCode = ProtocolProto::SplitFrameIntoPacketsIfNeed(taskToSend.buffer, mtu, piecePackets);
+    uint16_t fragCount = 0;
+    errCode = ProtocolProto::GetFragmentCount(taskToSend.buffer, mtu, fragCount);
     if (errCode != E_OK) {
         LOGE("[CommAggr] Split frame fail, errCode=%d.", errCode);
         TaskFinalizer(taskToSend, errCode);
         return;
     }
-    // <addr, <extendHeadSize, totalLen>>
-    std::vector<std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>>> eachPacket;
-    if (piecePackets.empty()) {
-        // Case that no need to split a frame, just use original buffer as a packet
-        std::pair<const uint8_t *, uint32_t> tmpEntry = taskToSend.buffer->GetReadOnlyBytesForEntireBuffer();
-        std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>> entry;
-        entry.first = tmpEntry.first - taskToSend.buffer->GetExtendHeadLength();
-        entry.second.first = taskToSend.buffer->GetExtendHeadLength();
-        entry.second.second = tmpEntry.second + entry.second.first;
-        eachPacket.push_back(entry);
-    } else {
-        for (auto &entry : piecePackets) {
-            std::pair<const uint8_t *, std::pair<uint32_t, uint32_t>> tmpEntry = {&(entry.first[0]),
-                {entry.second, entry.first.size()}};
-            eachPacket.push_back(tmpEntry);
-        }
-    }
-
-    SendPacketsAndDisposeTask(taskToSend, mtu, eachPacket, totalLength);
+    SendPacketsAndDisposeTask(taskToSend, mtu, fragCount, totalLength);
 }
 
 void CommunicatorAggregator::TriggerSendData()
@@ -1073,30 +1096,37 @@ void CommunicatorAggregator::TriggerSendData()
     }
     {
         std::lock_guard<std::mutex> autoLock(scheduleSendTaskMutex_);
-        if (sendTaskStart_) {
+        // Running lanes will pick up the task if no other target is waiting
+        if (activeSendLaneCount_ >= MAX_SEND_LANE_NUM ||
+            (activeSendLaneCount_ != 0 && !scheduler_.HasLaneSchedulableTask())) {
             return;
         }
-        sendTaskStart_ = true;
+        activeSendLaneCount_++;
     }
     RefObject::IncObjRef(this);
     int errCode = RuntimeContext::GetInstance()->ScheduleTask([this]() {
-        LOGI("[CommAggr] Send thread start.");
-        while (!shutdown_ && scheduler_.GetNoDelayTaskCount() != 0) {
+        LOGI("[CommAggr] Send lane start.");
+        while (!shutdown_ && scheduler_.HasLaneSchedulableTask()) {
             SendOnceData();
         }
         {
             std::lock_guard<std::mutex> autoLock(scheduleSendTaskMutex_);
-            sendTaskStart_ = false;
+            activeSendLaneCount_--;
         }
-        if (!shutdown_ && scheduler_.GetNoDelayTaskCount() != 0) {
-            TriggerSendData(); // avoid sendTaskStart_ was mark false after trigger thread check it
+        if (!shutdown_ && scheduler_.HasLaneSchedulableTask()) {
+            TriggerSendData(); // avoid lane exit after trigger thread check it
         }
-        finalizeCv_.notify_one();
+        finalizeCv_.notify_all();
         RefObject::DecObjRef(this);
-        LOGI("[CommAggr] Send thread end.");
+        LOGI("[CommAggr] Send lane end.");
     });
     if (errCode != E_OK) {
         LOGW("[CommAggr] Trigger send data failed %d", errCode);
+        {
+            std::lock_guard<std::mutex> autoLock(scheduleSendTaskMutex_);
+            activeSendLaneCount_--;
+        }
+        finalizeCv_.notify_all();
         RefObject::DecObjRef(this);
     }
 }
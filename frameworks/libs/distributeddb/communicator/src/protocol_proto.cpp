@@ -15,6 +15,7 @@
 
 #ifdef USE_DISTRIBUTEDDB_DEVICE
 #include "protocol_proto.h"
+#include <algorithm>
 #include <iterator>
 #include <mutex>
 #include <new>
@@ -295,9 +296,9 @@ SerialBuffer *ProtocolProto::BuildLabelExchangeAck(uint64_t inDistinctValue, uin
     return buffer;
 }
 
-int ProtocolProto::SplitFrameIntoPacketsIfNeed(const SerialBuffer *inBuff, uint32_t inMtuSize,
-    std::vector<std::pair<std::vector<uint8_t>, uint32_t>> &outPieces)
+int ProtocolProto::GetFragmentCount(const SerialBuffer *inBuff, uint32_t inMtuSize, uint16_t &outFragCount)
 {
+    outFragCount = 0;
     auto bufferBytesLen = inBuff->GetReadOnlyBytesForEntireBuffer();
     if ((bufferBytesLen.second + inBuff->GetExtendHeadLength()) <= inMtuSize) {
         return E_OK;
@@ -313,11 +314,27 @@ int ProtocolProto::SplitFrameIntoPacketsIfNeed(const SerialBuffer *inBuff, uint3
     uint16_t quotient = lengthToSplit / maxFragmentLen;
     uint32_t remainder = lengthToSplit % maxFragmentLen;
     // Finally we get the fragCount for this frame
-    uint16_t fragCount = ((remainder == 0) ? quotient : (quotient + 1));
+    outFragCount = ((remainder == 0) ? quotient : (quotient + 1));
+    if (outFragCount < MIN_FRAGMENT_COUNT) {
+        // It can be guaranteed that fragCount >= 2 and also won't be too large
+        return -E_INVALID_ARGS;
+    }
+    return E_OK;
+}
+
+int ProtocolProto::BuildFragmentPacket(const SerialBuffer *inBuff, uint16_t fragCount, uint16_t fragNo,
+    std::vector<uint8_t> &outPacket)
+{
+    if (inBuff == nullptr || fragCount < MIN_FRAGMENT_COUNT || fragNo >= fragCount) {
+        return -E_INVALID_ARGS;
+    }
+    auto frameBytesLen = inBuff->GetReadOnlyBytesForEntireFrame();
     // Get CommPhyHeader of this frame to be modified for each packets (Header in network endian)
     auto oriPhyHeader = reinterpret_cast<const CommPhyHeader *>(frameBytesLen.first);
-    FrameFragmentInfo fragInfo = {inBuff->GetOringinalAddr(), inBuff->GetExtendHeadLength(), lengthToSplit, fragCount};
-    return FrameFragmentation(frameBytesLen.first + sizeof(CommPhyHeader), fragInfo, *oriPhyHeader, outPieces);
+    FrameFragmentInfo fragInfo = {inBuff->GetOringinalAddr(), inBuff->GetExtendHeadLength(),
+        static_cast<uint32_t>(frameBytesLen.second - sizeof(CommPhyHeader)), fragCount};
+    return FillFragmentByIndex(frameBytesLen.first + sizeof(CommPhyHeader), fragInfo, *oriPhyHeader, fragNo,
+        outPacket);
 }
 
 int ProtocolProto::AnalyzeSplitStructure(const ParseResult &inResult, uint32_t &outFragLen, uint32_t &outLastFragLen)
@@ -952,70 +969,57 @@ int ProtocolProto::ParseLabelExchangeAck(const uint8_t *bytes, uint32_t length,
 }
 
 // Note: framePhyHeader is in network endian
-// This function aims at calculating and preparing each part of each packets
-int ProtocolProto::FrameFragmentation(const uint8_t *splitStartBytes, const FrameFragmentInfo &fragmentInfo,
-    const CommPhyHeader &framePhyHeader, std::vector<std::pair<std::vector<uint8_t>, uint32_t>> &outPieces)
+// This function aims at calculating and preparing each part of the fragNo packet. The outPacket may be reused
+// among fragments of a frame, so that only one packet of memory is held whatever the frame size is.
+int ProtocolProto::FillFragmentByIndex(const uint8_t *splitStartBytes, const FrameFragmentInfo &fragmentInfo,
+    const CommPhyHeader &framePhyHeader, uint16_t fragNo, std::vector<uint8_t> &outPacket)
 {
-    // It can be guaranteed that fragCount >= 2 and also won't be too large
-    if (fragmentInfo.fragCount < MIN_FRAGMENT_COUNT) {
-        return -E_INVALID_ARGS;
-    }
-    outPieces.resize(fragmentInfo.fragCount); // Note: should use resize other than reserve
     uint32_t quotient = fragmentInfo.splitLength / fragmentInfo.fragCount;
     uint16_t remainder = fragmentInfo.splitLength % fragmentInfo.fragCount;
-    uint16_t fragNo = 0; // Fragment index start from 0
-    uint32_t byteOffset = 0;
-
-    for (auto &entry : outPieces) {
-        // subtract 1 for index
-        uint32_t pieceFragLen = (fragNo != fragmentInfo.fragCount - 1) ? quotient : (quotient + remainder);
-        uint32_t alignedFragLen = BYTE_8_ALIGN(pieceFragLen); // Add padding length
-        uint32_t pieceTotalLen = alignedFragLen + sizeof(CommPhyHeader) + sizeof(CommPhyOptHeader);
-
-        // Since exception is disabled, we have to check the vector size to assure that memory is truly allocated
-        entry.first.resize(pieceTotalLen + fragmentInfo.extendHeadSize); // Note: should use resize other than reserve
-        if (entry.first.size() != (pieceTotalLen + fragmentInfo.extendHeadSize)) {
-            LOGE("[Proto][FrameFrag] Resize failed for length=%" PRIu32, pieceTotalLen);
-            return -E_OUT_OF_MEMORY;
-        }
-
-        CommPhyHeader pktPhyHeader;
-        HeaderConverter::ConvertNetToHost(framePhyHeader, pktPhyHeader); // Restore to host endian
-
-        // The sum value need to be recalculated, and the packet is fragmented.
-        // The alignedFragLen is always larger than pieceFragLen
-        FillPhyHeaderLenInfo(pieceTotalLen, 0, PACKET_TYPE_FRAGMENTED, alignedFragLen - pieceFragLen, pktPhyHeader);
-        HeaderConverter::ConvertHostToNet(pktPhyHeader, pktPhyHeader);
-
-        CommPhyOptHeader pktPhyOptHeader = {static_cast<uint32_t>(fragmentInfo.splitLength + sizeof(CommPhyHeader)),
-            fragmentInfo.fragCount, fragNo};
-        HeaderConverter::ConvertHostToNet(pktPhyOptHeader, pktPhyOptHeader);
-        int err;
-        FragmentPacket packet;
-        uint8_t *ptrPacket = &(entry.first[0]);
-        if (fragmentInfo.extendHeadSize > 0) {
-            packet = {ptrPacket, fragmentInfo.extendHeadSize};
-            err = FillFragmentPacketExtendHead(fragmentInfo.oringinalBytesAddr, fragmentInfo.extendHeadSize, packet);
-            if (err != E_OK) {
-                return err;
-            }
-            ptrPacket += fragmentInfo.extendHeadSize;
-        }
-        packet = {ptrPacket, static_cast<uint32_t>(entry.first.size()) - fragmentInfo.extendHeadSize};
-        err = FillFragmentPacket(pktPhyHeader, pktPhyOptHeader, splitStartBytes + byteOffset,
-            pieceFragLen, packet);
-        entry.second = fragmentInfo.extendHeadSize;
+    // subtract 1 for index
+    uint32_t pieceFragLen = (fragNo != fragmentInfo.fragCount - 1) ? quotient : (quotient + remainder);
+    uint32_t alignedFragLen = BYTE_8_ALIGN(pieceFragLen); // Add padding length
+    uint32_t pieceTotalLen = alignedFragLen + sizeof(CommPhyHeader) + sizeof(CommPhyOptHeader);
+    uint32_t byteOffset = quotient * fragNo;
+
+    // Since exception is disabled, we have to check the vector size to assure that memory is truly allocated
+    outPacket.resize(pieceTotalLen + fragmentInfo.extendHeadSize); // Note: should use resize other than reserve
+    if (outPacket.size() != (pieceTotalLen + fragmentInfo.extendHeadSize)) {
+        LOGE("[Proto][FrameFrag] Resize failed for length=%" PRIu32, pieceTotalLen);
+        return -E_OUT_OF_MEMORY;
+    }
+    // Padding is covered by sum, and must not carry bytes of the former fragment
+    std::fill(outPacket.end() - (alignedFragLen - pieceFragLen), outPacket.end(), 0);
+
+    CommPhyHeader pktPhyHeader;
+    HeaderConverter::ConvertNetToHost(framePhyHeader, pktPhyHeader); // Restore to host endian
+
+    // The sum value need to be recalculated, and the packet is fragmented.
+    // The alignedFragLen is always larger than pieceFragLen
+    FillPhyHeaderLenInfo(pieceTotalLen, 0, PACKET_TYPE_FRAGMENTED, alignedFragLen - pieceFragLen, pktPhyHeader);
+    HeaderConverter::ConvertHostToNet(pktPhyHeader, pktPhyHeader);
+
+    CommPhyOptHeader pktPhyOptHeader = {static_cast<uint32_t>(fragmentInfo.splitLength + sizeof(CommPhyHeader)),
+        fragmentInfo.fragCount, fragNo};
+    HeaderConverter::ConvertHostToNet(pktPhyOptHeader, pktPhyOptHeader);
+    int err;
+    FragmentPacket packet;
+    uint8_t *ptrPacket = outPacket.data();
+    if (fragmentInfo.extendHeadSize > 0) {
+        packet = {ptrPacket, fragmentInfo.extendHeadSize};
+        err = FillFragmentPacketExtendHead(fragmentInfo.oringinalBytesAddr, fragmentInfo.extendHeadSize, packet);
         if (err != E_OK) {
-            LOGE("[Proto][FrameFrag] Fill packet fail, fragCount=%" PRIu16 ", fragNo=%" PRIu16, fragmentInfo.fragCount,
-                fragNo);
             return err;
         }
-
-        fragNo++;
-        byteOffset += pieceFragLen;
+        ptrPacket += fragmentInfo.extendHeadSize;
     }
-
-    return E_OK;
+    packet = {ptrPacket, static_cast<uint32_t>(outPacket.size()) - fragmentInfo.extendHeadSize};
+    err = FillFragmentPacket(pktPhyHeader, pktPhyOptHeader, splitStartBytes + byteOffset, pieceFragLen, packet);
+    if (err != E_OK) {
+        LOGE("[Proto][FrameFrag] Fill packet fail, fragCount=%" PRIu16 ", fragNo=%" PRIu16, fragmentInfo.fragCount,
+            fragNo);
+    }
+    return err;
 }
 
 int ProtocolProto::FillFragmentPacketExtendHead(uint8_t *headBytesAddr, uint32_t headLen, FragmentPacket &outPacket)
@@ -69,9 +69,12 @@ public:
         const std::set<LabelType> &inLabels, int &outErrorNo);
     static SerialBuffer *BuildLabelExchangeAck(uint64_t inDistinctValue, uint64_t inSequenceId, int &outErrorNo);
 
-    // Return E_OK if no error happened. outPieces.size equal zero means not split, in this case, use ori buff.
-    static int SplitFrameIntoPacketsIfNeed(const SerialBuffer *inBuff, uint32_t inMtuSize,
-        std::vector<std::pair<std::vector<uint8_t>, uint32_t>> &outPieces);
+    // Return E_OK if no error happened. outFragCount equal zero means not split, in this case, use ori buff.
+    static int GetFragmentCount(const SerialBuffer *inBuff, uint32_t inMtuSize, uint16_t &outFragCount);
+    // Build the fragNo packet of the frame into outPacket, extend head included. Packets are built one by one on
+    // sending, so outPacket can be reused and the whole split frame is never held in memory.
+    static int BuildFragmentPacket(const SerialBuffer *inBuff, uint16_t fragCount, uint16_t fragNo,
+        std::vector<uint8_t> &outPacket);
     static int AnalyzeSplitStructure(const ParseResult &inResult, uint32_t &outFragLen, uint32_t &outLastFragLen);
 
     // inFrame is the destination, pktBytes and pktLength are the source, fragOffset and fragLength give the boundary
@@ -124,8 +127,8 @@ private:
     static int ParseLabelExchange(const uint8_t *bytes, uint32_t length, ParseResult &inResult);
     static int ParseLabelExchangeAck(const uint8_t *bytes, uint32_t length, ParseResult &inResult);
 
-    static int FrameFragmentation(const uint8_t *splitStartBytes, const FrameFragmentInfo &fragmentInfo,
-        const CommPhyHeader &framePhyHeader, std::vector<std::pair<std::vector<uint8_t>, uint32_t>> &outPieces);
+    static int FillFragmentByIndex(const uint8_t *splitStartBytes, const FrameFragmentInfo &fragmentInfo,
+        const CommPhyHeader &framePhyHeader, uint16_t fragNo, std::vector<uint8_t> &outPacket);
     static int FillFragmentPacket(const CommPhyHeader &phyHeader, const CommPhyOptHeader &phyOptHeader,
         const uint8_t *fragBytes, uint32_t fragLen, FragmentPacket &outPacket);
     static int FillFragmentPacketExtendHead(uint8_t *headBytesAddr, uint32_t headLen, FragmentPacket &outPacket);
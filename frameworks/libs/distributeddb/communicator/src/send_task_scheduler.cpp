@@ -142,36 +142,89 @@ int SendTaskScheduler::FinalizeLastScheduleTask()
     if (!scheduledFlag_) {
         return -E_NOT_PERMIT;
     }
+    scheduledFlag_ = false;
+    return FinalizeScheduleTaskNoMutex(lastScheduleTarget_, lastSchedulePriority_);
+}
+
+int SendTaskScheduler::ScheduleOutSendTaskByLane(SendTask &outTask, uint32_t &totalLength)
+{
+    std::lock_guard<std::mutex> overallLockGuard(overallMutex_);
+    std::string dstTarget;
+    Priority prio = Priority::LOW;
+    if (!FindLaneSchedulableTaskNoMutex(dstTarget, prio)) {
+        return -E_CONTAINER_EMPTY;
+    }
+    outTask = taskGroupByPrio_[prio][dstTarget].front();
+    totalLength = totalBytesByTarget_[dstTarget];
+    laneScheduledTargets_[dstTarget] = prio;
+    LOGI("[Scheduler][LaneOutTask] dstTarget=%s{private}, taskPrio=%d, lanes=%zu", dstTarget.c_str(),
+        static_cast<int>(prio), laneScheduledTargets_.size());
+    return E_OK;
+}
+
+int SendTaskScheduler::FinalizeLaneScheduleTask(const std::string &target)
+{
+    std::lock_guard<std::mutex> overallLockGuard(overallMutex_);
+    auto iter = laneScheduledTargets_.find(target);
+    if (iter == laneScheduledTargets_.end()) {
+        return -E_NOT_PERMIT;
+    }
+    Priority prio = iter->second;
+    laneScheduledTargets_.erase(iter);
+    if (curTotalSizeByTask_ == 0) {
+        return -E_CONTAINER_EMPTY;
+    }
+    return FinalizeScheduleTaskNoMutex(target, prio);
+}
+
+void SendTaskScheduler::ReleaseLaneScheduleTask(const std::string &target)
+{
+    std::lock_guard<std::mutex> overallLockGuard(overallMutex_);
+    laneScheduledTargets_.erase(target);
+}
 
-    // Retrieve last scheduled task
-    SendTask task = taskGroupByPrio_[lastSchedulePriority_][lastScheduleTarget_].front();
+bool SendTaskScheduler::HasLaneSchedulableTask() const
+{
+    std::lock_guard<std::mutex> overallLockGuard(overallMutex_);
+    std::string dstTarget;
+    Priority prio = Priority::LOW;
+    return FindLaneSchedulableTaskNoMutex(dstTarget, prio);
+}
+
+int SendTaskScheduler::FinalizeScheduleTaskNoMutex(const std::string &target, Priority prio)
+{
+    auto &taskList = taskGroupByPrio_[prio][target];
+    if (taskList.empty()) {
+        LOGE("[Scheduler][FinalizeTask] INTERNAL ERROR : NO TASK.");
+        return -E_INTERNAL_ERROR;
+    }
+    // Retrieve scheduled task
+    SendTask task = taskList.front();
 
     bool isFullBefore = (curTotalSizeByByte_ >= MAX_CAPACITY);
     uint32_t taskSize = task.buffer->GetSize();
     curTotalSizeByByte_ -= taskSize;
     bool isFullAfter = (curTotalSizeByByte_ >= MAX_CAPACITY);
 
-    totalBytesByTarget_[lastScheduleTarget_] -= taskSize;
+    totalBytesByTarget_[target] -= taskSize;
 
     curTotalSizeByTask_--;
-    taskCountByPrio_[lastSchedulePriority_]--;
-    if (policyMap_[lastScheduleTarget_] == TargetPolicy::DELAY) {
+    taskCountByPrio_[prio]--;
+    if (policyMap_[target] == TargetPolicy::DELAY) {
         delayTaskCount_--;
-        taskDelayCountByPrio_[lastSchedulePriority_]--;
+        taskDelayCountByPrio_[prio]--;
     }
 
-    for (auto iter = taskOrderByPrio_[lastSchedulePriority_].begin();
-        iter != taskOrderByPrio_[lastSchedulePriority_].end(); ++iter) {
-        if (*iter == lastScheduleTarget_) {
-            taskOrderByPrio_[lastSchedulePriority_].erase(iter);
+    for (auto iter = taskOrderByPrio_[prio].begin(); iter != taskOrderByPrio_[prio].end(); ++iter) {
+        if (*iter == target) {
+            taskOrderByPrio_[prio].erase(iter);
             break;
         }
     }
 
-    taskGroupByPrio_[lastSchedulePriority_][lastScheduleTarget_].pop_front();
+    taskList.pop_front();
     delete task.buffer;
     task.buffer = nullptr;
-    scheduledFlag_ = false;
 
     if (isFullBefore && !isFullAfter) {
         return -E_CONTAINER_FULL_TO_NOTFULL;
@@ -186,6 +239,51 @@ int SendTaskScheduler::FinalizeLastScheduleTask()
     return E_OK;
 }
 
+bool SendTaskScheduler::FindLaneSchedulableTaskNoMutex(std::string &outTarget, Priority &outPrio) const
+{
+    for (const auto &prio : priorityOrder_) {
+        auto countIter = taskCountByPrio_.find(prio);
+        auto delayCountIter = taskDelayCountByPrio_.find(prio);
+        auto orderIter = taskOrderByPrio_.find(prio);
+        if (countIter == taskCountByPrio_.end() || delayCountIter == taskDelayCountByPrio_.end() ||
+            orderIter == taskOrderByPrio_.end() || countIter->second == delayCountIter->second) {
+            // No no_delay_task of this priority
+            continue;
+        }
+        for (const auto &target : orderIter->second) {
+            auto policyIter = policyMap_.find(target);
+            if (policyIter == policyMap_.end() || policyIter->second == TargetPolicy::DELAY ||
+                laneScheduledTargets_.count(target) != 0) {
+                continue;
+            }
+            outTarget = target;
+            outPrio = prio;
+            return true;
+        }
+    }
+    return false;
+}
+
+const SendTask *SendTaskScheduler::GetFirstTaskByTargetNoMutex(const std::string &target) const
+{
+    auto laneIter = laneScheduledTargets_.find(target);
+    for (const auto &prio : priorityOrder_) {
+        if (laneIter != laneScheduledTargets_.end() && laneIter->second != prio) {
+            // The task scheduled out by lane is the first one of this target
+            continue;
+        }
+        auto groupIter = taskGroupByPrio_.find(prio);
+        if (groupIter == taskGroupByPrio_.end()) {
+            continue;
+        }
+        auto taskIter = groupIter->second.find(target);
+        if (taskIter != groupIter->second.end() && !taskIter->second.empty()) {
+            return &(taskIter->second.front());
+        }
+    }
+    return nullptr;
+}
+
 int SendTaskScheduler::DelayTaskByTarget(const std::string &inTarget)
 {
     std::lock_guard<std::mutex> overallLockGuard(overallMutex_);
@@ -386,23 +484,16 @@ void SendTaskScheduler::ResetRetryCount()
 
 void SendTaskScheduler::IncreaseRetryCountIfNeed(const std::string &dev, bool isRetryTask)
 {
-    SendTask task;
-    SendTaskInfo taskInfo;
-    uint32_t totalLength = 0;
-    int errCode = ScheduleOutSendTask(task, taskInfo, totalLength);
-    if (errCode != E_OK) {
-        LOGE("[SendTaskScheduler] schedule %.3s task failed %d", dev.c_str(), errCode);
-        return;
-    }
-    if (dev != task.dstTarget) {
-        LOGI("[SendTaskScheduler] first send task has changed from %.3s to %.3s", dev.c_str(), task.dstTarget.c_str());
+    std::lock_guard<std::mutex> autoLock(overallMutex_);
+    const SendTask *task = GetFirstTaskByTargetNoMutex(dev);
+    if (task == nullptr) {
+        LOGE("[SendTaskScheduler] schedule %.3s task failed, no task", dev.c_str());
         return;
     }
-    if (!task.isValid) {
+    if (!task->isValid) {
         LOGI("[SendTaskScheduler] %.3s task has been invalid", dev.c_str());
         return;
     }
-    std::lock_guard<std::mutex> autoLock(overallMutex_);
     retryCount_[dev][isRetryTask]++;
 }
 }
@@ -19,12 +19,13 @@
 #include "db_errno.h"
 #include "log_print.h"
 #include "securec.h"
+#include "serial_buffer_pool.h"
 
 namespace DistributedDB {
 SerialBuffer::~SerialBuffer()
 {
     if (!isExternalStackMemory_ && oringinalBytes_ != nullptr) {
-        delete[] oringinalBytes_;
+        SerialBufferPool::GetInstance().Free(oringinalBytes_, capacity_);
     }
     oringinalBytes_ = nullptr;
     bytes_ = nullptr;
@@ -56,7 +57,7 @@ int SerialBuffer::AllocBufferByPayloadLength(uint32_t inPayloadLen, uint32_t inH
     if (totalLen_ == 0 || totalLen_ > MAX_TOTAL_LEN) {
         return -E_INVALID_ARGS;
     }
-    oringinalBytes_ = new (std::nothrow) uint8_t[totalLen_ + extendHeadLen_]();
+    oringinalBytes_ = SerialBufferPool::GetInstance().Alloc(totalLen_ + extendHeadLen_, capacity_);
     if (oringinalBytes_ == nullptr) {
         return -E_OUT_OF_MEMORY;
     }
@@ -78,7 +79,7 @@ int SerialBuffer::AllocBufferByTotalLength(uint32_t inTotalLen, uint32_t inHeade
     headerLen_ = inHeaderLen;
     payloadLen_ = totalLen_ - headerLen_;
     paddingLen_ = 0;
-    bytes_ = new (std::nothrow) uint8_t[inTotalLen]();
+    bytes_ = SerialBufferPool::GetInstance().Alloc(inTotalLen, capacity_);
     if (bytes_ == nullptr) {
         return -E_OUT_OF_MEMORY;
     }
@@ -119,7 +120,7 @@ SerialBuffer *SerialBuffer::Clone(int &outErrorNo)
     if (bytes_ == nullptr) {
         twinBuffer->bytes_ = nullptr;
     } else {
-        twinBuffer->bytes_ = new (std::nothrow) uint8_t[totalLen_];
+        twinBuffer->bytes_ = SerialBufferPool::GetInstance().Alloc(totalLen_, twinBuffer->capacity_);
         if (twinBuffer->bytes_ == nullptr) {
             outErrorNo = -E_OUT_OF_MEMORY;
             delete twinBuffer;
@@ -129,7 +130,7 @@ SerialBuffer *SerialBuffer::Clone(int &outErrorNo)
         errno_t errCode = memcpy_s(twinBuffer->bytes_, totalLen_, bytes_, totalLen_);
         if (errCode != EOK) {
             outErrorNo = -E_SECUREC_ERROR;
-            delete[] twinBuffer->bytes_;
+            SerialBufferPool::GetInstance().Free(twinBuffer->bytes_, twinBuffer->capacity_);
             twinBuffer->bytes_ = nullptr;
             delete twinBuffer;
             twinBuffer = nullptr;
@@ -158,13 +159,13 @@ int SerialBuffer::ConvertForCrossThread()
         return E_OK;
     }
     // Logic guarantee all the member value: isExternalStackMemory_ is true; bytes_ is nullptr; totalLen_ is correct.
-    bytes_ = new (std::nothrow) uint8_t[totalLen_];
+    bytes_ = SerialBufferPool::GetInstance().Alloc(totalLen_, capacity_);
     if (bytes_ == nullptr) {
         return -E_OUT_OF_MEMORY;
     }
     errno_t errCode = memcpy_s(bytes_, totalLen_, externalBytes_, totalLen_);
     if (errCode != EOK) {
-        delete[] bytes_;
+        SerialBufferPool::GetInstance().Free(bytes_, capacity_);
         bytes_ = nullptr;
         return -E_SECUREC_ERROR;
     }
@@ -67,6 +67,7 @@ private:
     uint8_t *bytes_ = nullptr; // distributeddb start addr
     const uint8_t *externalBytes_ = nullptr;
     uint32_t totalLen_ = 0;
+    uint32_t capacity_ = 0; // length of the bytes got from SerialBufferPool, needed when give them back
     uint32_t headerLen_ = 0;
     uint32_t payloadLen_ = 0;
     uint32_t paddingLen_ = 0;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "serial_buffer_pool.h"
+#include <new>
+#include "securec.h"
+
+namespace DistributedDB {
+SerialBufferPool &SerialBufferPool::GetInstance()
+{
+    // Never destroyed, buffers may still be freed by other static objects while exit.
+    static SerialBufferPool *instance = new SerialBufferPool();
+    return *instance;
+}
+
+uint8_t *SerialBufferPool::Alloc(uint32_t length, uint32_t &outCapacity)
+{
+    uint32_t index = 0;
+    if (!GetClassIndex(length, index)) {
+        heapAllocCount_++;
+        outCapacity = length;
+        return new (std::nothrow) uint8_t[length]();
+    }
+    uint32_t capacity = 1u << (index + MIN_CLASS_SHIFT);
+    uint8_t *bytes = nullptr;
+    {
+        std::lock_guard<std::mutex> autoLock(poolMutex_);
+        if (!freeBytes_[index].empty()) {
+            bytes = freeBytes_[index].back();
+            freeBytes_[index].pop_back();
+            cachedBytes_ -= capacity;
+        }
+    }
+    if (bytes == nullptr) {
+        heapAllocCount_++;
+        bytes = new (std::nothrow) uint8_t[capacity];
+        if (bytes == nullptr) {
+            outCapacity = 0;
+            return nullptr;
+        }
+    } else {
+        reuseCount_++;
+    }
+    // Never let the content of last frame leak out through padding or unused fields
+    (void)memset_s(bytes, capacity, 0, length);
+    outCapacity = capacity;
+    return bytes;
+}
+
+void SerialBufferPool::Free(uint8_t *bytes, uint32_t capacity)
+{
+    if (bytes == nullptr) {
+        return;
+    }
+    uint32_t index = 0;
+    if (!GetClassIndex(capacity, index) || (1u << (index + MIN_CLASS_SHIFT)) != capacity) {
+        delete[] bytes;
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(poolMutex_);
+        if (cachedBytes_ + capacity <= MAX_CACHED_BYTES) {
+            freeBytes_[index].push_back(bytes);
+            cachedBytes_ += capacity;
+            return;
+        }
+    }
+    delete[] bytes;
+}
+
+SerialBufferPoolStat SerialBufferPool::GetStat() const
+{
+    SerialBufferPoolStat stat;
+    stat.heapAllocCount = heapAllocCount_.load();
+    stat.reuseCount = reuseCount_.load();
+    std::lock_guard<std::mutex> autoLock(poolMutex_);
+    stat.cachedBytes = cachedBytes_;
+    return stat;
+}
+
+void SerialBufferPool::Clear()
+{
+    std::lock_guard<std::mutex> autoLock(poolMutex_);
+    for (auto &eachClass : freeBytes_) {
+        for (auto bytes : eachClass) {
+            delete[] bytes;
+        }
+        eachClass.clear();
+    }
+    cachedBytes_ = 0;
+}
+
+bool SerialBufferPool::GetClassIndex(uint32_t length, uint32_t &outIndex)
+{
+    if (length == 0 || length > (1u << MAX_CLASS_SHIFT)) {
+        return false;
+    }
+    uint32_t shift = MIN_CLASS_SHIFT;
+    while ((1u << shift) < length) {
+        shift++;
+    }
+    outIndex = shift - MIN_CLASS_SHIFT;
+    return true;
+}
+} // namespace DistributedDB
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SERIAL_BUFFER_POOL_H
+#define SERIAL_BUFFER_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "macro_utils.h"
+
+namespace DistributedDB {
+struct SerialBufferPoolStat {
+    uint64_t heapAllocCount = 0; // buffers got from heap
+    uint64_t reuseCount = 0; // buffers got from the pool
+    uint64_t cachedBytes = 0; // bytes of idle buffers kept by the pool
+};
+
+// Keep the freed frame buffers by power of two size classes, so that sending or combining large frames does not
+// ask the heap, which maps and faults fresh pages for each large buffer.
+class SerialBufferPool {
+public:
+    static SerialBufferPool &GetInstance();
+
+    // Return zeroed bytes no shorter than length, outCapacity must be passed back when Free.
+    uint8_t *Alloc(uint32_t length, uint32_t &outCapacity);
+    void Free(uint8_t *bytes, uint32_t capacity);
+
+    SerialBufferPoolStat GetStat() const;
+
+    // Release all idle buffers to heap.
+    void Clear();
+
+private:
+    SerialBufferPool() = default;
+    ~SerialBufferPool() = default;
+    DISABLE_COPY_ASSIGN_MOVE(SerialBufferPool);
+
+    static bool GetClassIndex(uint32_t length, uint32_t &outIndex);
+
+    static constexpr uint32_t MIN_CLASS_SHIFT = 10; // 1 KB
+    static constexpr uint32_t MAX_CLASS_SHIFT = 22; // 4 MB
+    static constexpr uint32_t CLASS_NUM = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+    static constexpr uint64_t MAX_CACHED_BYTES = 16 * 1024 * 1024; // 16 MB
+
+    mutable std::mutex poolMutex_;
+    std::vector<uint8_t *> freeBytes_[CLASS_NUM];
+    uint64_t cachedBytes_ = 0;
+    std::atomic<uint64_t> heapAllocCount_ = 0;
+    std::atomic<uint64_t> reuseCount_ = 0;
+};
+} // namespace DistributedDB
+
+#endif // SERIAL_BUFFER_POOL_H
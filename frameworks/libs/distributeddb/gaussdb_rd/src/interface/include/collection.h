@@ -31,6 +31,9 @@ public:
     int GetDocumentById(Key &key, Value &document) const;
     int GetMatchedDocument(const JsonObject &filterObj, Key &key, std::pair<std::string, std::string> &values,
         int isIdExist) const;
+    int GetMatchedDocuments(const JsonObject &filterObj, const Key &key, size_t batchSize,
+        std::vector<std::pair<std::string, std::string>> &values) const;
+    int64_t GetTotalChanges() const;
     int DeleteDocument(Key &key);
     int IsCollectionExists(int &errCode);
     int UpsertDocument(const std::string &id, const std::string &newDocument, bool &isIdExist);
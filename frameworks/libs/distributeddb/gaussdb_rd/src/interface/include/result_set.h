@@ -16,6 +16,7 @@
 #ifndef RESULTSET_H
 #define RESULTSET_H
 
+#include <deque>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -45,6 +46,8 @@ private:
     int CheckCutNode(JsonObject *node, std::vector<std::string> singleCutPath,
         std::vector<std::vector<std::string>> &allCutPath);
     int GetNextWithField();
+    int GetNextFromCache(std::string &jsonKey, std::string &jsonData);
+    int FillCache(int64_t totalChanges);
     int CutJsonBranchInner(JsonObject &cjsonObj, bool viewType, bool isIdExistInValue,
         bool &isInsertIdflag);
 
@@ -54,6 +57,11 @@ private:
     std::shared_ptr<QueryContext> context_;
     std::pair<std::string, std::string> matchData_;
     std::string lastKeyIndex_;
+    // Matched rows prefetched in key order, dropped as soon as the collection is written.
+    std::deque<std::pair<std::string, std::string>> cachedData_;
+    size_t cacheBatchSize_ = 0;
+    int64_t cachedTotalChanges_ = -1;
+    bool isScanFinished_ = false;
 };
 } // namespace DocumentDB
 #endif // RESULTSET_H
\ No newline at end of file
@@ -106,6 +106,23 @@ int Collection::GetMatchedDocument(const JsonObject &filterObj, Key &key, std::p
     return executor_->GetDataByFilter(name_, key, filterObj, values, isIdExist);
 }
 
+int Collection::GetMatchedDocuments(const JsonObject &filterObj, const Key &key, size_t batchSize,
+    std::vector<std::pair<std::string, std::string>> &values) const
+{
+    if (executor_ == nullptr) {
+        return -E_INNER_ERROR;
+    }
+    return executor_->GetDataByFilterBatch(name_, key, filterObj, batchSize, values);
+}
+
+int64_t Collection::GetTotalChanges() const
+{
+    if (executor_ == nullptr) {
+        return -1;
+    }
+    return executor_->GetTotalChanges();
+}
+
 int Collection::IsCollectionExists(int &errCode)
 {
     return executor_->IsCollectionExists(name_, errCode);
@@ -21,6 +21,7 @@
 
 namespace DocumentDB {
 constexpr const char *KEY_ID = "_id";
+constexpr size_t MAX_CACHE_BATCH_SIZE = 128;
 
 ResultSet::ResultSet() {}
 ResultSet::~ResultSet()
@@ -66,25 +67,28 @@ int ResultSet::GetValueFromDB(Key &key, JsonObject &filterObj, std::string &json
 int ResultSet::GetNextWithField()
 {
     int errCode = E_OK;
+    if (!context_->isIdExist) {
+        std::string jsonKey;
+        std::string jsonData;
+        errCode = GetNextFromCache(jsonKey, jsonData);
+        matchData_ = std::make_pair(jsonKey, jsonData);
+        return errCode;
+    }
     JsonObject filterObj = JsonObject::Parse(context_->filter, errCode, true, true);
     if (errCode != E_OK) {
         GLOGE("filter Parsed failed");
         return errCode;
     }
     Key key;
-    if (context_->isIdExist) {
-        if (index_ == 0) { // get id from filter, if alreay has got id once, get from lastKeyIndex.
-            JsonObject filterObjChild = filterObj.GetChild();
-            ValueObject idValue = JsonCommon::GetValueInSameLevel(filterObjChild, KEY_ID);
-            std::string idKey = idValue.GetStringValue();
-            key.assign(idKey.begin(), idKey.end());
-        } else { // Use id to find data that can only get one data.
-            matchData_.first.clear(); // Delete previous data.
-            matchData_.second.clear();
-            return -E_NO_DATA;
-        }
-    } else {
-        key.assign(lastKeyIndex_.begin(), lastKeyIndex_.end());
+    if (index_ == 0) { // get id from filter, if alreay has got id once, get from lastKeyIndex.
+        JsonObject filterObjChild = filterObj.GetChild();
+        ValueObject idValue = JsonCommon::GetValueInSameLevel(filterObjChild, KEY_ID);
+        std::string idKey = idValue.GetStringValue();
+        key.assign(idKey.begin(), idKey.end());
+    } else { // Use id to find data that can only get one data.
+        matchData_.first.clear(); // Delete previous data.
+        matchData_.second.clear();
+        return -E_NO_DATA;
     }
     matchData_.first.clear();
     matchData_.second.clear();
@@ -95,6 +99,63 @@ int ResultSet::GetNextWithField()
     return errCode;
 }
 
+int ResultSet::FillCache(int64_t totalChanges)
+{
+    int errCode = E_OK;
+    JsonObject filterObj = JsonObject::Parse(context_->filter, errCode, true, true);
+    if (errCode != E_OK) {
+        GLOGE("filter Parsed failed");
+        return errCode;
+    }
+    // Start with a single row so one-shot lookups cost the same as before, then double for full scans.
+    cacheBatchSize_ = (cacheBatchSize_ == 0) ? 1 : std::min(cacheBatchSize_ * 2, MAX_CACHE_BATCH_SIZE);
+    std::vector<std::pair<std::string, std::string>> values;
+    Collection coll = store_->GetCollection(context_->collectionName);
+    filterObj.DeleteItemFromObject(KEY_ID);
+    Key key(lastKeyIndex_.begin(), lastKeyIndex_.end());
+    errCode = coll.GetMatchedDocuments(filterObj, key, cacheBatchSize_, values);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    isScanFinished_ = (values.size() < cacheBatchSize_);
+    cachedTotalChanges_ = totalChanges;
+    for (auto &value : values) {
+        cachedData_.emplace_back(std::move(value));
+    }
+    return E_OK;
+}
+
+int ResultSet::GetNextFromCache(std::string &jsonKey, std::string &jsonData)
+{
+    int64_t totalChanges = store_->GetCollection(context_->collectionName).GetTotalChanges();
+    if (totalChanges != cachedTotalChanges_) {
+        // Data changed since the cache was filled, rescan from the last returned key to see the latest rows.
+        cachedData_.clear();
+        isScanFinished_ = false;
+    }
+    if (cachedData_.empty() && !isScanFinished_) {
+        int errCode = FillCache(totalChanges);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+    }
+    if (cachedData_.empty()) {
+        return -E_NO_DATA;
+    }
+    jsonKey = std::move(cachedData_.front().first);
+    jsonData = std::move(cachedData_.front().second);
+    cachedData_.pop_front();
+    lastKeyIndex_ = jsonKey;
+    if (isCutBranch_) {
+        int errCode = CutJsonBranch(jsonKey, jsonData);
+        if (errCode != E_OK) {
+            GLOGE("cut branch faild");
+            return errCode;
+        }
+    }
+    return E_OK;
+}
+
 int ResultSet::GetNextInner(bool isNeedCheckTable)
 {
     int errCode = E_OK;
@@ -17,6 +17,7 @@
 #define KV_STORE_EXECUTOR_H
 
 #include <string>
+#include <vector>
 
 #include "check_common.h"
 
@@ -35,6 +36,9 @@ public:
     virtual int GetDataById(const std::string &collName, Key &key, Value &value) const = 0;
     virtual int GetDataByFilter(const std::string &collName, Key &key, const JsonObject &filterObj,
         std::pair<std::string, std::string> &values, int isIdExist) const = 0;
+    virtual int GetDataByFilterBatch(const std::string &collName, const Key &key, const JsonObject &filterObj,
+        size_t batchSize, std::vector<std::pair<std::string, std::string>> &values) const = 0;
+    virtual int64_t GetTotalChanges() const = 0;
     virtual int DelData(const std::string &collName, Key &key) = 0;
 
     virtual int CreateCollection(const std::string &name, const std::string &option, bool ignoreExists) = 0;
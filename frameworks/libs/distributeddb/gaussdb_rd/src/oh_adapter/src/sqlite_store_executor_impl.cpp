@@ -287,6 +287,71 @@ int SqliteStoreExecutorImpl::GetDataByFilter(const std::string &collName, Key &k
     return innerErrorCode;
 }
 
+int SqliteStoreExecutorImpl::GetDataByFilterBatch(const std::string &collName, const Key &key,
+    const JsonObject &filterObj, size_t batchSize, std::vector<std::pair<std::string, std::string>> &values) const
+{
+    if (dbHandle_ == nullptr) {
+        GLOGE("Invalid db handle.");
+        return -E_ERROR;
+    }
+    if (batchSize == 0) {
+        return -E_INVALID_ARGS;
+    }
+    // One statement walks the key order from the last returned key and collects up to batchSize matched rows,
+    // so iterating a result set does not prepare and rescan once per document.
+    std::string sql = key.empty() ? "SELECT key, value FROM '" + collName + "' ORDER BY key;" :
+        "SELECT key, value FROM '" + collName + "' WHERE key>? ORDER BY key;";
+    Key bindKey = key;
+    if (!bindKey.empty()) {
+        bindKey.push_back(KEY_TYPE);
+    }
+    Value keyResult;
+    Value valueResult;
+    int innerErrorCode = E_OK;
+    int errCode = RDSQLiteUtils::ExecSql(
+        dbHandle_, sql,
+        [&bindKey](sqlite3_stmt *stmt) {
+            if (!bindKey.empty()) {
+                RDSQLiteUtils::BindBlobToStatement(stmt, 1, bindKey);
+            }
+            return E_OK;
+        },
+        [&keyResult, &valueResult, &innerErrorCode, &filterObj, &values, batchSize](sqlite3_stmt *stmt,
+            bool &isMatchOneData) {
+            RDSQLiteUtils::GetColumnBlobValue(stmt, 0, keyResult);
+            RDSQLiteUtils::GetColumnBlobValue(stmt, 1, valueResult);
+            std::string valueStr(valueResult.begin(), valueResult.end());
+            JsonObject srcObj = JsonObject::Parse(valueStr, innerErrorCode, true);
+            if (innerErrorCode != E_OK) {
+                GLOGE("srcObj Parsed failed");
+                return innerErrorCode;
+            }
+            if (!JsonCommon::IsJsonNodeMatch(srcObj, filterObj, innerErrorCode)) {
+                innerErrorCode = E_OK;
+                return E_OK;
+            }
+            std::string keyStr(keyResult.begin(), keyResult.end());
+            keyStr.pop_back(); // get id from really key.
+            values.emplace_back(std::move(keyStr), std::move(valueStr));
+            innerErrorCode = E_OK;
+            isMatchOneData = (values.size() >= batchSize); // stop stepping once the batch is full
+            return E_OK;
+        });
+    if (errCode != E_OK) {
+        GLOGE("[sqlite executor] Get batch data failed. err=%d", errCode);
+        return errCode;
+    }
+    return innerErrorCode;
+}
+
+int64_t SqliteStoreExecutorImpl::GetTotalChanges() const
+{
+    if (dbHandle_ == nullptr) {
+        return -1;
+    }
+    return static_cast<int64_t>(sqlite3_total_changes(dbHandle_));
+}
+
 int SqliteStoreExecutorImpl::DelData(const std::string &collName, Key &key)
 {
     if (dbHandle_ == nullptr) {
@@ -43,6 +43,9 @@ public:
     int GetDataById(const std::string &collName, Key &key, Value &value) const override;
     int GetDataByFilter(const std::string &collName, Key &key, const JsonObject &filterObj,
         std::pair<std::string, std::string> &values, int isIdExist) const override;
+    int GetDataByFilterBatch(const std::string &collName, const Key &key, const JsonObject &filterObj,
+        size_t batchSize, std::vector<std::pair<std::string, std::string>> &values) const override;
+    int64_t GetTotalChanges() const override;
     int DelData(const std::string &collName, Key &key) override;
 
     int CreateCollection(const std::string &name, const std::string &option, bool ignoreExists) override;
@@ -1494,4 +1494,112 @@ HWTEST_F(DocumentDBFindTest, DocumentDBFindTest063, TestSize.Level1)
     EXPECT_EQ(GRD_DBClose(test_db, 0), GRD_OK);
     DocumentDBTestUtils::RemoveTestDbFiles(path.c_str());
 }
+
+/**
+  * @tc.name: DocumentDBFindTest064
+  * @tc.desc: Test iterating a large result set returns every matched document in id order.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DocumentDBFindTest, DocumentDBFindTest064, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Insert 300 documents, half of them match the filter.
+     * @tc.expected: step1. Succeed to insert.
+     */
+    const int docNum = 300;
+    auto getId = [](int i) {
+        std::string num = std::to_string(i);
+        return "t" + std::string(3 - num.size(), '0') + num;
+    };
+    for (int i = 0; i < docNum; i++) {
+        std::string document = "{\"_id\":\"" + getId(i) + "\", \"group\":" + std::to_string(i % 2) + "}";
+        EXPECT_EQ(GRD_InsertDoc(g_db, COLLECTION_NAME, document.c_str(), 0), GRD_OK);
+    }
+    /**
+     * @tc.steps: step2. Find with filter and iterate to the end.
+     * @tc.expected: step2. All matched documents are returned once and in id order.
+     */
+    const char *filter = "{\"group\":1}";
+    GRD_ResultSet *resultSet = nullptr;
+    const char *projection = "{}";
+    Query query = { filter, projection };
+    EXPECT_EQ(GRD_FindDoc(g_db, COLLECTION_NAME, query, 1, &resultSet), GRD_OK);
+    int count = 0;
+    char *value = nullptr;
+    while (GRD_Next(resultSet) == GRD_OK) {
+        EXPECT_EQ(GRD_GetValue(resultSet, &value), GRD_OK);
+        std::string expect = "{\"_id\":\"" + getId(count * 2 + 1) + "\", \"group\":1}";
+        CompareValue(value, expect.c_str());
+        EXPECT_EQ(GRD_FreeValue(value), GRD_OK);
+        count++;
+    }
+    EXPECT_EQ(count, docNum / 2);
+    EXPECT_EQ(GRD_Next(resultSet), GRD_NO_DATA);
+    EXPECT_EQ(GRD_FreeResultSet(resultSet), GRD_OK);
+    /**
+     * @tc.steps: step3. Find with filter and _id flag is 0, iterate to the end.
+     * @tc.expected: step3. All matched documents are returned without _id.
+     */
+    resultSet = nullptr;
+    EXPECT_EQ(GRD_FindDoc(g_db, COLLECTION_NAME, query, 0, &resultSet), GRD_OK);
+    count = 0;
+    while (GRD_Next(resultSet) == GRD_OK) {
+        EXPECT_EQ(GRD_GetValue(resultSet, &value), GRD_OK);
+        CompareValue(value, "{\"group\":1}");
+        EXPECT_EQ(GRD_FreeValue(value), GRD_OK);
+        count++;
+    }
+    EXPECT_EQ(count, docNum / 2);
+    EXPECT_EQ(GRD_FreeResultSet(resultSet), GRD_OK);
+}
+
+/**
+  * @tc.name: DocumentDBFindTest065
+  * @tc.desc: Test writes between GRD_Next are visible to the following GRD_Next.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DocumentDBFindTest, DocumentDBFindTest065, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Insert 10 documents and iterate the first 3 of them.
+     * @tc.expected: step1. Succeed.
+     */
+    for (int i = 0; i < 10; i++) { // 10 documents
+        std::string document = "{\"_id\":\"u" + std::to_string(i) + "\", \"a\":1}";
+        EXPECT_EQ(GRD_InsertDoc(g_db, COLLECTION_NAME, document.c_str(), 0), GRD_OK);
+    }
+    const char *filter = "{\"a\":1}";
+    GRD_ResultSet *resultSet = nullptr;
+    Query query = { filter, "{}" };
+    EXPECT_EQ(GRD_FindDoc(g_db, COLLECTION_NAME, query, 1, &resultSet), GRD_OK);
+    char *value = nullptr;
+    for (int i = 0; i < 3; i++) { // 3 documents read before writing
+        EXPECT_EQ(GRD_Next(resultSet), GRD_OK);
+        EXPECT_EQ(GRD_GetValue(resultSet, &value), GRD_OK);
+        std::string expect = "{\"_id\":\"u" + std::to_string(i) + "\", \"a\":1}";
+        CompareValue(value, expect.c_str());
+        EXPECT_EQ(GRD_FreeValue(value), GRD_OK);
+    }
+    /**
+     * @tc.steps: step2. Delete u3, update u4 so it no longer matches and update u5.
+     * @tc.expected: step2. The result set skips u3 and u4 and returns the new value of u5.
+     */
+    EXPECT_EQ(GRD_DeleteDoc(g_db, COLLECTION_NAME, "{\"_id\":\"u3\"}", 0), 1);
+    EXPECT_EQ(GRD_UpdateDoc(g_db, COLLECTION_NAME, "{\"_id\":\"u4\"}", "{\"a\":2}", 0), 1);
+    EXPECT_EQ(GRD_UpdateDoc(g_db, COLLECTION_NAME, "{\"_id\":\"u5\"}", "{\"b\":5}", 0), 1);
+    EXPECT_EQ(GRD_Next(resultSet), GRD_OK);
+    EXPECT_EQ(GRD_GetValue(resultSet, &value), GRD_OK);
+    CompareValue(value, "{\"_id\":\"u5\", \"a\":1, \"b\":5}");
+    EXPECT_EQ(GRD_FreeValue(value), GRD_OK);
+    int count = 0;
+    while (GRD_Next(resultSet) == GRD_OK) {
+        count++;
+    }
+    EXPECT_EQ(count, 4); // u6 to u9
+    EXPECT_EQ(GRD_FreeResultSet(resultSet), GRD_OK);
+}
 } // namespace
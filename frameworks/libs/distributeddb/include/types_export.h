@@ -242,6 +242,7 @@ struct SecurityOption {
 enum class ResultSetCacheMode : int {
     CACHE_FULL_ENTRY = 0,       // Ordinary mode efficient when sequential access, the default mode
     CACHE_ENTRY_ID_ONLY = 1,    // Special mode efficient when random access
+    CACHE_ENTRY_PAGED = 2,      // Special mode efficient when sequential access of large result, cache one page
 };
 
 struct RemotePushNotifyInfo {
@@ -131,6 +131,8 @@ struct CloudSyncOption {
     QueryMode queryMode = QueryMode::UPLOAD_AND_DOWNLOAD;
     SyncFlowType syncFlowType = SyncFlowType::NORMAL;
     bool isFullSync = false;
+    // query next batch from cloud while current batch is saving, not work with query nodes and compensated sync
+    bool pipelineDownload = false;
 };
 
 enum class QueryNodeType : uint32_t {
@@ -60,6 +60,10 @@ public:
         std::string storageEngineType = SQLITE; // use gaussdb_rd as storage engine
         Rdconfig rdconfig;
         ConnPoolConfig connPoolConfig;
+        // sync_data without dev_index, device scoped operations scan the table. Opening an existed store with the
+        // other value drops or recreates dev_index once, the store keeps the layout until the value changes again.
+        bool isReducedSyncIndex = false;
+        bool isFastOpen = false; // create read handles on demand and repair the upgraded local data in background
     };
 
     struct DatabaseStatus {
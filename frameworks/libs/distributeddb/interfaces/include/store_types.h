@@ -136,6 +136,17 @@ enum PragmaCmd {
     REMOVE_LOCAL_DATA_BY_KEY_PATTERN,
     SET_HIGH_PERFORMANCE_READ_MODE,
     GET_PAGE_SIZE,
+    VALUE_CACHE_MAX_SIZE, // Allowed Int Type Range [0,16], Unit MB, 0 means disable the hot key value cache
+    GET_VALUE_CACHE_STATISTICS, // Accept ValueCacheStatistics Type As PragmaData
+    // Allowed uint32_t Type Range [0,128], 0 means save sync watermark into db at once(default),
+    // otherwise the advanced watermark is kept in memory and saved after the count of update reach it
+    SET_WATERMARK_FLUSH_THRESHOLD,
+};
+
+struct ValueCacheStatistics {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictCount = 0;
 };
 
 enum ResolutionPolicyType {
@@ -24,34 +24,40 @@ KvStoreChangedDataImpl::~KvStoreChangedDataImpl()
 const std::list<Entry> &KvStoreChangedDataImpl::GetEntriesInserted() const
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (insertedEntries_.empty() && observerData_ != nullptr) {
+    if (insertedEntries_ == nullptr && observerData_ != nullptr) {
         int errCode;
-        insertedEntries_ = observerData_->GetInsertedEntries(errCode);
+        insertedEntries_ = observerData_->GetInsertedEntriesSnapshot(errCode);
     }
 
-    return insertedEntries_;
+    return GetEntries(insertedEntries_);
 }
 
 const std::list<Entry> &KvStoreChangedDataImpl::GetEntriesUpdated() const
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (updatedEntries_.empty() && observerData_ != nullptr) {
+    if (updatedEntries_ == nullptr && observerData_ != nullptr) {
         int errCode;
-        updatedEntries_ = observerData_->GetUpdatedEntries(errCode);
+        updatedEntries_ = observerData_->GetUpdatedEntriesSnapshot(errCode);
     }
 
-    return updatedEntries_;
+    return GetEntries(updatedEntries_);
 }
 
 const std::list<Entry> &KvStoreChangedDataImpl::GetEntriesDeleted() const
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (deletedEntries_.empty() && observerData_ != nullptr) {
+    if (deletedEntries_ == nullptr && observerData_ != nullptr) {
         int errCode;
-        deletedEntries_ = observerData_->GetDeletedEntries(errCode);
+        deletedEntries_ = observerData_->GetDeletedEntriesSnapshot(errCode);
     }
 
-    return deletedEntries_;
+    return GetEntries(deletedEntries_);
+}
+
+const std::list<Entry> &KvStoreChangedDataImpl::GetEntries(const std::shared_ptr<const std::list<Entry>> &entries)
+{
+    static const std::list<Entry> emptyEntries;
+    return (entries == nullptr) ? emptyEntries : *entries;
 }
 
 bool KvStoreChangedDataImpl::IsCleared() const
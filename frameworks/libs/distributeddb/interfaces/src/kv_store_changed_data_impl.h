@@ -38,11 +38,14 @@ public:
     bool IsCleared() const override;
 
 private:
+    static const std::list<Entry> &GetEntries(const std::shared_ptr<const std::list<Entry>> &entries);
+
     const KvDBCommitNotifyData *observerData_;
     mutable std::mutex mutex_;
-    mutable std::list<Entry> insertedEntries_;
-    mutable std::list<Entry> updatedEntries_;
-    mutable std::list<Entry> deletedEntries_;
+    // Snapshot shared with the other observers of the same commit, got only when the observer needs it.
+    mutable std::shared_ptr<const std::list<Entry>> insertedEntries_;
+    mutable std::shared_ptr<const std::list<Entry>> updatedEntries_;
+    mutable std::shared_ptr<const std::list<Entry>> deletedEntries_;
 };
 } // namespace DistributedDB
 
@@ -113,6 +113,8 @@ void InitPropWithNbOption(KvDBProperties &properties, const std::string &storePa
     }
     properties.SetBoolProp(KvDBProperties::SYNC_DUAL_TUPLE_MODE, option.syncDualTupleMode);
     properties.SetBoolProp(KvDBProperties::LOCAL_ONLY, option.localOnly);
+    properties.SetBoolProp(KvDBProperties::REDUCED_SYNC_INDEX, option.isReducedSyncIndex);
+    properties.SetBoolProp(KvDBProperties::FAST_OPEN, option.isFastOpen);
     properties.SetBoolProp(KvDBProperties::READ_ONLY_MODE, option.rdconfig.readOnly);
     bool sharedMode = (option.storageEngineType == GAUSSDB_RD);
     properties.SetBoolProp(KvDBProperties::SHARED_MODE, sharedMode);
@@ -64,6 +64,9 @@ namespace {
         {REMOVE_LOCAL_DATA_BY_KEY_PATTERN, PRAGMA_REMOVE_LOCAL_DATA_BY_KEY_PATTERN},
         {SET_HIGH_PERFORMANCE_READ_MODE, PRAGMA_SET_HIGH_PERFORMANCE_READ_MODE},
         {GET_PAGE_SIZE, PRAGMA_GET_PAGE_SIZE},
+        {VALUE_CACHE_MAX_SIZE, PRAGMA_VALUE_CACHE_MAX_SIZE},
+        {GET_VALUE_CACHE_STATISTICS, PRAGMA_GET_VALUE_CACHE_STATISTICS},
+        {SET_WATERMARK_FLUSH_THRESHOLD, PRAGMA_SET_WATERMARK_FLUSH_THRESHOLD},
     };
 
     constexpr const char *INVALID_CONNECTION = "[KvStoreNbDelegate] Invalid connection for operation";
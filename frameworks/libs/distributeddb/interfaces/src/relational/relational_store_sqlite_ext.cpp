@@ -12,11 +12,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #ifndef _WIN32
 #include <dlfcn.h>
 #endif
 #include <fstream>
 #include <mutex>
+#include <new>
 #include <openssl/sha.h>
 #include <openssl/crypto.h>
 #include <string>
@@ -391,6 +393,116 @@ std::mutex g_registerSqliteHookMutex;
 
 std::mutex g_createTempTriggerMutex;
 
+// Mirror of g_clientObserverMap for one db file, readable by trigger functions without lock
+struct ClientObserverState {
+    std::atomic<bool> isRegistered = false;
+    std::atomic<uint64_t> clearVersion = 0; // increased when unregistered, changes collected before are dropped
+};
+std::map<std::string, std::shared_ptr<ClientObserverState>> g_clientObserverStateMap; // guard by g_clientObserverMutex
+
+// Computed once when the handle is opened, so that the trigger functions running for every changed row
+// do not hash the file path or search the global maps again.
+struct DbHandleContext {
+    sqlite3 *db = nullptr;
+    std::string identity; // key of time helper
+    std::string hashFileName; // key of observers, empty if hash failed
+    std::shared_ptr<ClientObserverState> clientObserverState;
+    // Changed tables of the uncommitted transaction. Only touched while the handle is in use, serialized by sqlite.
+    // Only used when the wal hook of RegisterDbHook is on this handle, it is the one moves them to the observer.
+    std::map<std::string, ChangeProperties> pendingClientData;
+    uint64_t pendingClearVersion = 0;
+    std::atomic<bool> isDbHookRegistered = false;
+
+    ~DbHandleContext();
+};
+
+std::shared_ptr<ClientObserverState> GetClientObserverStateWithLock(const std::string &hashFileName)
+{
+    auto &state = g_clientObserverStateMap[hashFileName];
+    if (state == nullptr) {
+        state = std::make_shared<ClientObserverState>();
+    }
+    return state;
+}
+
+// Drop the state of a file when neither an observer nor a handle refers to it
+void EraseClientObserverStateIfUnusedWithLock(const std::string &hashFileName)
+{
+    auto it = g_clientObserverStateMap.find(hashFileName);
+    if (it != g_clientObserverStateMap.end() && it->second.use_count() == 1 && !it->second->isRegistered.load()) {
+        g_clientObserverStateMap.erase(it);
+    }
+}
+
+DbHandleContext::~DbHandleContext()
+{
+    if (clientObserverState == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_clientObserverMutex);
+    clientObserverState = nullptr;
+    EraseClientObserverStateIfUnusedWithLock(hashFileName);
+}
+
+std::mutex g_dbHandleContextMutex;
+std::map<sqlite3 *, std::weak_ptr<DbHandleContext>> g_dbHandleContextMap;
+
+static bool GetDbFileName(sqlite3 *db, std::string &fileName);
+
+std::shared_ptr<DbHandleContext> GetDbHandleContext(sqlite3 *db)
+{
+    std::lock_guard<std::mutex> lock(g_dbHandleContextMutex);
+    auto it = g_dbHandleContextMap.find(db);
+    if (it == g_dbHandleContextMap.end()) {
+        return nullptr;
+    }
+    return it->second.lock();
+}
+
+std::shared_ptr<DbHandleContext> GetOrCreateDbHandleContext(sqlite3 *db)
+{
+    std::lock_guard<std::mutex> lock(g_dbHandleContextMutex);
+    auto it = g_dbHandleContextMap.find(db);
+    if (it != g_dbHandleContextMap.end()) {
+        auto handleContext = it->second.lock();
+        if (handleContext != nullptr) {
+            return handleContext;
+        }
+    }
+    // Context is released with the functions when handle closed, drop the expired ones here
+    for (auto iter = g_dbHandleContextMap.begin(); iter != g_dbHandleContextMap.end();) {
+        iter = iter->second.expired() ? g_dbHandleContextMap.erase(iter) : std::next(iter);
+    }
+    auto handleContext = std::make_shared<DbHandleContext>();
+    handleContext->db = db;
+    (void)GetDBIdentity(db, handleContext->identity);
+    std::string fileName;
+    if (!GetDbFileName(db, fileName) || DBCommon::GetHashString(fileName, handleContext->hashFileName) != E_OK) {
+        LOGW("[GetOrCreateDbHandleContext] Get db hash string failed.");
+        handleContext->hashFileName.clear();
+    } else {
+        std::lock_guard<std::mutex> observerLock(g_clientObserverMutex);
+        handleContext->clientObserverState = GetClientObserverStateWithLock(handleContext->hashFileName);
+        handleContext->pendingClearVersion = handleContext->clientObserverState->clearVersion.load();
+    }
+    g_dbHandleContextMap[db] = handleContext;
+    return handleContext;
+}
+
+std::shared_ptr<DbHandleContext> GetDbHandleContextFromFunc(sqlite3_context *ctx)
+{
+    auto handleContext = static_cast<std::shared_ptr<DbHandleContext> *>(sqlite3_user_data(ctx));
+    if (handleContext == nullptr) {
+        return nullptr;
+    }
+    return *handleContext;
+}
+
+void ReleaseDbHandleContext(void *data)
+{
+    delete static_cast<std::shared_ptr<DbHandleContext> *>(data);
+}
+
 int RegisterFunction(sqlite3 *db, const std::string &funcName, int nArg, void *uData, TransactFunc &func)
 {
     if (db == nullptr) {
@@ -400,6 +512,22 @@ int RegisterFunction(sqlite3 *db, const std::string &funcName, int nArg, void *u
         func.xFunc, func.xStep, func.xFinal, func.xDestroy);
 }
 
+// Each function keeps its own reference of the context, it is released by sqlite when function is replaced or
+// the handle is closed, and also when the registration failed.
+int RegisterFunctionWithContext(sqlite3 *db, const std::string &funcName, int nArg, TransactFunc &func)
+{
+    if (db == nullptr) {
+        return -E_ERROR;
+    }
+    auto handleContext = GetOrCreateDbHandleContext(db);
+    auto uData = new (std::nothrow) std::shared_ptr<DbHandleContext>(handleContext);
+    if (uData == nullptr) {
+        return -E_ERROR;
+    }
+    func.xDestroy = &ReleaseDbHandleContext;
+    return RegisterFunction(db, funcName, nArg, uData, func);
+}
+
 void CalcHashKey(sqlite3_context *ctx, int argc, sqlite3_value **argv)
 {
     // 1 means that the function only needs one parameter, namely key
@@ -539,11 +667,12 @@ void GetSysTime(sqlite3_context *ctx, int argc, sqlite3_value **argv)
         return;
     }
 
-    auto *db = static_cast<sqlite3 *>(sqlite3_user_data(ctx));
-    if (db == nullptr) {
+    auto handleContext = GetDbHandleContextFromFunc(ctx);
+    if (handleContext == nullptr || handleContext->db == nullptr) {
         sqlite3_result_error(ctx, "Sqlite context is invalid.", -1);
         return;
     }
+    sqlite3 *db = handleContext->db;
 
     std::function<Timestamp()> getDbMaxTimestamp = [db]() -> Timestamp {
         Timestamp maxTimestamp = 0;
@@ -556,8 +685,7 @@ void GetSysTime(sqlite3_context *ctx, int argc, sqlite3_value **argv)
         return localTimeOffset;
     };
 
-    std::string identity;
-    GetDBIdentity(db, identity);
+    const std::string &identity = handleContext->identity;
     auto timeOffset = static_cast<TimeOffset>(sqlite3_value_int64(argv[0]));
     (void)TimeHelperManager::GetInstance()->TimeSkew(identity, getDbLocalTimeOffset, timeOffset);
     Timestamp currentTime = TimeHelperManager::GetInstance()->GetTime(identity, timeOffset, getDbMaxTimestamp,
@@ -586,15 +714,14 @@ void GetLastTime(sqlite3_context *ctx, int argc, sqlite3_value **argv)
         return;
     }
 
-    auto *db = static_cast<sqlite3 *>(sqlite3_user_data(ctx));
-    if (db == nullptr) {
+    auto handleContext = GetDbHandleContextFromFunc(ctx);
+    if (handleContext == nullptr) {
         sqlite3_result_error(ctx, "Sqlite context is invalid.", -1);
         return;
     }
-    std::string identity;
-    GetDBIdentity(db, identity);
 
-    sqlite3_result_int64(ctx, (sqlite3_int64)TimeHelperManager::GetInstance()->GetLastTime(identity));
+    sqlite3_result_int64(ctx,
+        (sqlite3_int64)TimeHelperManager::GetInstance()->GetLastTime(handleContext->identity));
 }
 
 static bool GetDbFileName(sqlite3 *db, std::string &fileName)
@@ -621,20 +748,43 @@ static bool GetDbHashString(sqlite3 *db, std::string &hashFileName)
     return DBCommon::GetHashString(fileName, hashFileName) == E_OK;
 }
 
+void MergeChangeProperties(const std::string &tableName, const ChangeProperties &properties,
+    std::map<std::string, ChangeProperties> &tableData)
+{
+    auto itTable = tableData.find(tableName);
+    if (itTable == tableData.end()) {
+        tableData.insert_or_assign(tableName, properties);
+        return;
+    }
+    itTable->second.isTrackedDataChange |= properties.isTrackedDataChange;
+    itTable->second.isP2pSyncDataChange |= properties.isP2pSyncDataChange;
+    itTable->second.isKnowledgeDataChange |= properties.isKnowledgeDataChange;
+    itTable->second.isCloudSyncDataChange |= properties.isCloudSyncDataChange;
+}
+
 void CloudDataChangedObserver(sqlite3_context *ctx, int argc, sqlite3_value **argv)
 {
     if (ctx == nullptr || argc != 4 || argv == nullptr) { // 4 is param counts
         return;
     }
-    sqlite3 *db = static_cast<sqlite3 *>(sqlite3_user_data(ctx));
-    std::string hashFileName = "";
-    if (!GetDbHashString(db, hashFileName)) {
+    auto handleContext = GetDbHandleContextFromFunc(ctx);
+    if (handleContext == nullptr || handleContext->clientObserverState == nullptr) {
         return;
     }
     auto tableNameChar = reinterpret_cast<const char *>(sqlite3_value_text(argv[0]));
     if (tableNameChar == nullptr) {
         return;
     }
+    const auto &observerState = handleContext->clientObserverState;
+    uint64_t clearVersion = observerState->clearVersion.load();
+    if (handleContext->pendingClearVersion != clearVersion) {
+        handleContext->pendingClientData.clear();
+        handleContext->pendingClearVersion = clearVersion;
+    }
+    if (!observerState->isRegistered.load()) {
+        sqlite3_result_int64(ctx, static_cast<sqlite3_int64>(1));
+        return;
+    }
     std::string tableName = static_cast<std::string>(tableNameChar);
 
     auto changeStatus = static_cast<uint64_t>(sqlite3_value_int(argv[3])); // 3 is param index
@@ -642,35 +792,42 @@ void CloudDataChangedObserver(sqlite3_context *ctx, int argc, sqlite3_value **ar
     bool isP2pChange = (changeStatus & CloudDbConstant::ON_CHANGE_P2P) != 0;
     bool isKnowledgeDataChange = (changeStatus & CloudDbConstant::ON_CHANGE_KNOWLEDGE) != 0;
     bool isCloudDataChange = (changeStatus & CloudDbConstant::ON_CHANGE_CLOUD) != 0;
-    bool isExistObserver = false;
-    {
-        std::lock_guard<std::mutex> lock(g_clientObserverMutex);
-        auto it = g_clientObserverMap.find(hashFileName);
-        isExistObserver = (it != g_clientObserverMap.end());
-    }
-    {
+    DistributedDB::ChangeProperties properties = {
+        .isTrackedDataChange = isTrackerChange,
+        .isP2pSyncDataChange = isP2pChange,
+        .isKnowledgeDataChange = isKnowledgeDataChange,
+        .isCloudSyncDataChange = isCloudDataChange
+    };
+    if (handleContext->isDbHookRegistered.load()) {
+        // Collected in handle without lock, moved to the observer by the wal hook at commit
+        MergeChangeProperties(tableName, properties, handleContext->pendingClientData);
+    } else {
+        // No hook on this handle, the changes are notified by the handle which has the hook of the same file
         std::lock_guard<std::mutex> lock(g_clientChangedDataMutex);
-        if (isExistObserver) {
-            auto itTable = g_clientChangedDataMap[hashFileName].tableData.find(tableName);
-            if (itTable != g_clientChangedDataMap[hashFileName].tableData.end()) {
-                itTable->second.isTrackedDataChange |= isTrackerChange;
-                itTable->second.isP2pSyncDataChange |= isP2pChange;
-                itTable->second.isKnowledgeDataChange |= isKnowledgeDataChange;
-                itTable->second.isCloudSyncDataChange |= isCloudDataChange;
-            } else {
-                DistributedDB::ChangeProperties properties = {
-                    .isTrackedDataChange = isTrackerChange,
-                    .isP2pSyncDataChange = isP2pChange,
-                    .isKnowledgeDataChange = isKnowledgeDataChange,
-                    .isCloudSyncDataChange = isCloudDataChange
-                };
-                g_clientChangedDataMap[hashFileName].tableData.insert_or_assign(tableName, properties);
-            }
-        }
+        MergeChangeProperties(tableName, properties, g_clientChangedDataMap[handleContext->hashFileName].tableData);
     }
     sqlite3_result_int64(ctx, static_cast<sqlite3_int64>(1));
 }
 
+void FlushPendingClientData(const std::shared_ptr<DbHandleContext> &handleContext)
+{
+    if (handleContext == nullptr || handleContext->pendingClientData.empty()) {
+        return;
+    }
+    std::map<std::string, ChangeProperties> pendingClientData;
+    pendingClientData.swap(handleContext->pendingClientData);
+    const auto &observerState = handleContext->clientObserverState;
+    if (observerState == nullptr || !observerState->isRegistered.load() ||
+        observerState->clearVersion.load() != handleContext->pendingClearVersion) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(g_clientChangedDataMutex);
+    auto &tableData = g_clientChangedDataMap[handleContext->hashFileName].tableData;
+    for (const auto &[tableName, properties] : pendingClientData) {
+        MergeChangeProperties(tableName, properties, tableData);
+    }
+}
+
 int JudgeIfGetRowid(sqlite3 *db, const std::string &tableName, std::string &type, bool &isRowid)
 {
     if (db == nullptr) {
@@ -730,11 +887,12 @@ void DataChangedObserver(sqlite3_context *ctx, int argc, sqlite3_value **argv)
     if (ctx == nullptr || argc != 4 || argv == nullptr) { // 4 is param counts
         return;
     }
-    sqlite3 *db = static_cast<sqlite3 *>(sqlite3_user_data(ctx));
-    std::string hashFileName = "";
-    if (!GetDbHashString(db, hashFileName)) {
+    auto handleContext = GetDbHandleContextFromFunc(ctx);
+    if (handleContext == nullptr || handleContext->hashFileName.empty()) {
         return;
     }
+    sqlite3 *db = handleContext->db;
+    const std::string &hashFileName = handleContext->hashFileName;
     bool isExistObserver = false;
     {
         std::lock_guard<std::mutex> lock(g_storeObserverMutex);
@@ -961,13 +1119,12 @@ void StoreObserverCallback(sqlite3 *db, const std::string &hashFileName)
 
 int LogCommitHookCallback(void *data, sqlite3 *db, const char *zDb, int size)
 {
-    std::string fileName;
-    if (!GetDbFileName(db, fileName)) {
-        return 0;
-    }
+    auto handleContext = GetDbHandleContext(db);
+    FlushPendingClientData(handleContext);
     std::string hashFileName;
-    int errCode = DBCommon::GetHashString(fileName, hashFileName);
-    if (errCode != E_OK) {
+    if (handleContext != nullptr && !handleContext->hashFileName.empty()) {
+        hashFileName = handleContext->hashFileName;
+    } else if (!GetDbHashString(db, hashFileName)) {
         return 0;
     }
     ClientObserverCallback(hashFileName);
@@ -978,6 +1135,10 @@ int LogCommitHookCallback(void *data, sqlite3 *db, const char *zDb, int size)
 void RollbackHookCallback(void* data)
 {
     sqlite3 *db = static_cast<sqlite3 *>(data);
+    auto handleContext = GetDbHandleContext(db);
+    if (handleContext != nullptr) {
+        handleContext->pendingClientData.clear();
+    }
     std::string fileName;
     if (!GetDbFileName(db, fileName)) {
         return;
@@ -1005,14 +1166,14 @@ int RegisterGetSysTime(sqlite3 *db)
 {
     TransactFunc func;
     func.xFunc = &GetSysTime;
-    return RegisterFunction(db, "get_sys_time", 1, db, func);
+    return RegisterFunctionWithContext(db, "get_sys_time", 1, func);
 }
 
 int RegisterGetLastTime(sqlite3 *db)
 {
     TransactFunc func;
     func.xFunc = &GetLastTime;
-    return RegisterFunction(db, "get_last_time", 0, db, func);
+    return RegisterFunctionWithContext(db, "get_last_time", 0, func);
 }
 
 int RegisterGetRawSysTime(sqlite3 *db)
@@ -1026,7 +1187,7 @@ int RegisterCloudDataChangeObserver(sqlite3 *db)
 {
     TransactFunc func;
     func.xFunc = &CloudDataChangedObserver;
-    return RegisterFunction(db, "client_observer", 4, db, func); // 4 is param counts
+    return RegisterFunctionWithContext(db, "client_observer", 4, func); // 4 is param counts
 }
 
 int RegisterBinlogDataChangeObserver(sqlite3 *db)
@@ -1045,7 +1206,7 @@ int RegisterDataChangeObserver(sqlite3 *db)
 {
     TransactFunc func;
     func.xFunc = &DataChangedObserver;
-    return RegisterFunction(db, "data_change", 4, db, func); // 4 is param counts
+    return RegisterFunctionWithContext(db, "data_change", 4, func); // 4 is param counts
 }
 
 void RegisterCommitAndRollbackHook(sqlite3 *db)
@@ -1776,6 +1937,7 @@ DB_API DistributedDB::DBStatus RegisterClientObserver(sqlite3 *db, const ClientO
 
     std::lock_guard<std::mutex> lock(g_clientObserverMutex);
     g_clientObserverMap[hashFileName] = clientObserver;
+    GetClientObserverStateWithLock(hashFileName)->isRegistered.store(true);
     return DistributedDB::OK;
 }
 
@@ -1798,6 +1960,12 @@ DB_API DistributedDB::DBStatus UnRegisterClientObserver(sqlite3 *db)
         if (it != g_clientObserverMap.end()) {
             g_clientObserverMap.erase(it);
         }
+        auto itState = g_clientObserverStateMap.find(hashFileName);
+        if (itState != g_clientObserverStateMap.end()) {
+            itState->second->isRegistered.store(false);
+            itState->second->clearVersion++;
+            EraseClientObserverStateIfUnusedWithLock(hashFileName);
+        }
     }
     {
         std::lock_guard<std::mutex> lock(g_clientChangedDataMutex);
@@ -1954,6 +2122,10 @@ DB_API void RegisterDbHook(sqlite3 *db)
     std::lock_guard<std::mutex> lock(g_registerSqliteHookMutex);
     sqlite3_wal_hook(db, LogCommitHookCallback, db);
     sqlite3_rollback_hook(db, RollbackHookCallback, db);
+    auto handleContext = GetDbHandleContext(db);
+    if (handleContext != nullptr) {
+        handleContext->isDbHookRegistered.store(true);
+    }
 }
 
 DB_API void UnregisterDbHook(sqlite3 *db)
@@ -1965,6 +2137,12 @@ DB_API void UnregisterDbHook(sqlite3 *db)
     std::lock_guard<std::mutex> lock(g_registerSqliteHookMutex);
     sqlite3_wal_hook(db, nullptr, db);
     sqlite3_rollback_hook(db, nullptr, db);
+    auto handleContext = GetDbHandleContext(db);
+    if (handleContext != nullptr) {
+        // Nothing moves the collected changes after the hook removed, hand them to the process wide data now
+        handleContext->isDbHookRegistered.store(false);
+        FlushPendingClientData(handleContext);
+    }
 }
 
 DB_API DistributedDB::DBStatus CreateDataChangeTempTrigger(sqlite3 *db)
@@ -18,6 +18,7 @@
 
 #include <string>
 
+#include "db_errno.h"
 #include "db_types.h"
 #include "kvdb_properties.h"
 
@@ -59,6 +60,18 @@ public:
     // Put meta data as a key-value entry.
     virtual int PutMetaData(const Key &key, const Value &value, bool isInTransaction) = 0;
 
+    // Put multiple meta data entries, implementation might save them in one transaction.
+    virtual int PutMetaDataBatch(const std::map<Key, Value> &data)
+    {
+        for (const auto &[key, value] : data) {
+            int errCode = PutMetaData(key, value, false);
+            if (errCode != E_OK) {
+                return errCode;
+            }
+        }
+        return E_OK;
+    }
+
     // Delete multiple meta data records in a transaction.
     virtual int DeleteMetaData(const std::vector<Key> &keys) = 0;
 
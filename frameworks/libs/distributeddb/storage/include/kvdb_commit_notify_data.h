@@ -17,6 +17,7 @@
 #define KVDB_COMMIT_NOTIFY_DATA_H
 
 #include <list>
+#include <memory>
 
 #include "db_types.h"
 #include "ref_object.h"
@@ -43,6 +44,22 @@ public:
     // get all conflict entries when commit.
     virtual const std::list<KvDBConflictEntry> GetCommitConflicts(int &errCode) const = 0;
 
+    // get the inserted/updated/deleted entries which can be shared by all the observers without copy.
+    virtual std::shared_ptr<const std::list<Entry>> GetInsertedEntriesSnapshot(int &errCode) const
+    {
+        return std::make_shared<const std::list<Entry>>(GetInsertedEntries(errCode));
+    }
+
+    virtual std::shared_ptr<const std::list<Entry>> GetUpdatedEntriesSnapshot(int &errCode) const
+    {
+        return std::make_shared<const std::list<Entry>>(GetUpdatedEntries(errCode));
+    }
+
+    virtual std::shared_ptr<const std::list<Entry>> GetDeletedEntriesSnapshot(int &errCode) const
+    {
+        return std::make_shared<const std::list<Entry>>(GetDeletedEntries(errCode));
+    }
+
     // database is cleared by user in the commit.
     virtual bool IsCleared() const = 0;
 
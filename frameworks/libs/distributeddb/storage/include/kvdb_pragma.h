@@ -56,6 +56,9 @@ enum : int {
     PRAGMA_REMOVE_LOCAL_DATA_BY_KEY_PATTERN,
     PRAGMA_SET_HIGH_PERFORMANCE_READ_MODE,
     PRAGMA_GET_PAGE_SIZE,
+    PRAGMA_VALUE_CACHE_MAX_SIZE,
+    PRAGMA_GET_VALUE_CACHE_STATISTICS,
+    PRAGMA_SET_WATERMARK_FLUSH_THRESHOLD,
 };
 
 struct PragmaSync {
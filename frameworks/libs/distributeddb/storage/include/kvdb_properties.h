@@ -71,6 +71,8 @@ public:
     static const std::string CHECK_INTEGRITY;
     static const std::string RM_CORRUPTED_DB;
     static const std::string LOCAL_ONLY;
+    static const std::string REDUCED_SYNC_INDEX;
+    static const std::string FAST_OPEN;
 
     static const std::string SHARED_MODE;
     static const std::string READ_ONLY_MODE;
@@ -377,20 +377,57 @@ int GenericSingleVerKvEntry::Compress(const std::vector<SingleVerKvEntry *> &kvE
         return -E_INVALID_ARGS;
     }
 
-    // Serialize data.
-    std::vector<uint8_t> srcData(srcLen, 0);
-    Parcel parcel(srcData.data(), srcData.size());
-    int errCode = SerializeDatas(kvEntries, parcel, compressInfo.targetVersion);
+    auto inst = DataCompression::GetInstance(compressInfo.compressAlgo);
+    if (inst == nullptr) {
+        return -E_INVALID_COMPRESS_ALGO;
+    }
+    std::unique_ptr<DataCompressionStream> stream = inst->CreateCompressionStream(srcLen);
+    if (stream == nullptr) {
+        return -E_INVALID_ARGS;
+    }
+
+    // Compress data while serializing, no need to hold all the serialized entries.
+    int errCode = SerializeDatas(kvEntries, *stream, compressInfo.targetVersion);
     if (errCode != E_OK) {
         return errCode;
     }
+    return stream->Finish(destData);
+}
 
-    // Compress data.
-    auto inst = DataCompression::GetInstance(compressInfo.compressAlgo);
-    if (inst == nullptr) {
-        return -E_INVALID_COMPRESS_ALGO;
+int GenericSingleVerKvEntry::SerializeDatas(const std::vector<SingleVerKvEntry *> &kvEntries,
+    DataCompressionStream &stream, uint32_t targetVersion)
+{
+    std::vector<uint8_t> buffer(BYTE_8_ALIGN(Parcel::GetUInt32Len()), 0);
+    Parcel headParcel(buffer.data(), buffer.size());
+    (void)headParcel.WriteUInt32(static_cast<uint32_t>(kvEntries.size()));
+    headParcel.EightByteAlign();
+    if (headParcel.IsError()) {
+        LOGE("[SerializeDatas] write entries size failed.");
+        return -E_PARSE_FAIL;
     }
-    return inst->Compress(srcData, destData);
+    int errCode = stream.Append(buffer.data(), buffer.size());
+    for (const auto &kvEntry : kvEntries) {
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        if (kvEntry == nullptr) {
+            continue;
+        }
+        // Each field is aligned by its own length, so the entry serialized alone is the same as in the whole parcel
+        uint32_t len = kvEntry->CalculateLen(targetVersion);
+        if (len == 0) {
+            return -E_INVALID_ARGS;
+        }
+        buffer.assign(len, 0);
+        Parcel parcel(buffer.data(), buffer.size());
+        errCode = kvEntry->SerializeData(parcel, targetVersion);
+        if (errCode != E_OK || parcel.IsError()) {
+            LOGE("[SerializeDatas] write kvEntry failed, errCode=%d.", errCode);
+            return errCode != E_OK ? errCode : -E_PARSE_FAIL;
+        }
+        errCode = stream.Append(buffer.data(), buffer.size());
+    }
+    return errCode;
 }
 
 int GenericSingleVerKvEntry::Uncompress(const std::vector<uint8_t> &srcData, std::vector<SingleVerKvEntry *> &kvEntries,
@@ -24,6 +24,8 @@
 #include "single_ver_kv_entry.h"
 
 namespace DistributedDB {
+class DataCompressionStream;
+
 struct CompressInfo {
     CompressAlgorithm compressAlgo = CompressAlgorithm::ZLIB;
     uint32_t targetVersion = 0;
@@ -84,6 +86,10 @@ public:
     static int DeSerializeCompressedDatas(std::vector<SingleVerKvEntry *> &kvEntries, Parcel &parcel);
 
 private:
+    // Serialize the entries one by one into the compression stream, the output is the same as SerializeDatas
+    static int SerializeDatas(const std::vector<SingleVerKvEntry *> &kvEntries, DataCompressionStream &stream,
+        uint32_t targetVersion);
+
     enum class OperType {
         SERIALIZE,
         DESERIALIZE,
@@ -1094,6 +1094,12 @@ int KvDBManager::CheckKvDBProperties(const IKvDB *kvDB, const KvDBProperties &pr
         return -E_INVALID_ARGS;
     }
 
+    if (kvDB->GetMyProperties().GetBoolProp(KvDBProperties::REDUCED_SYNC_INDEX, false) !=
+        properties.GetBoolProp(KvDBProperties::REDUCED_SYNC_INDEX, false)) { // LCOV_EXCL_BR_LINE
+        LOGE("Different sync data index layout");
+        return -E_INVALID_ARGS;
+    }
+
     if (!CheckSecOptions(properties, kvDB->GetMyProperties())) { // LCOV_EXCL_BR_LINE
         return -E_INVALID_ARGS;
     }
@@ -29,6 +29,8 @@ const std::string KvDBProperties::CONFLICT_RESOLVE_POLICY = "conflictResolvePoli
 const std::string KvDBProperties::CHECK_INTEGRITY = "checkIntegrity";
 const std::string KvDBProperties::RM_CORRUPTED_DB = "rmCorruptedDb";
 const std::string KvDBProperties::LOCAL_ONLY = "localOnly";
+const std::string KvDBProperties::REDUCED_SYNC_INDEX = "reducedSyncIndex";
+const std::string KvDBProperties::FAST_OPEN = "fastOpen";
 
 const std::string KvDBProperties::SHARED_MODE = "sharedMode";
 const std::string KvDBProperties::READ_ONLY_MODE = "read_only";
@@ -521,6 +521,14 @@ int SyncAbleKvDB::GetWatermarkInfo(const std::string &device, WatermarkInfo &inf
     }
     return syncer_.GetWatermarkInfo(device, info);
 }
+
+int SyncAbleKvDB::SetWaterMarkFlushThreshold(uint32_t threshold)
+{
+    if (NeedStartSyncer()) {
+        StartSyncer();
+    }
+    return syncer_.SetWaterMarkFlushThreshold(threshold);
+}
 #endif
 
 int SyncAbleKvDB::UpgradeSchemaVerInMeta()
@@ -646,6 +654,7 @@ void SyncAbleKvDB::FillSyncInfo(const CloudSyncOption &option, const SyncProcess
     info.merge = option.merge;
     info.prepareTraceId = option.prepareTraceId;
     info.queryMode = option.queryMode;
+    info.pipelineDownload = option.pipelineDownload;
     if (option.queryMode == QueryMode::UPLOAD_ONLY) {
         QuerySyncObject query(option.query);
         query.SetTableName(CloudDbConstant::CLOUD_KV_TABLE_NAME);
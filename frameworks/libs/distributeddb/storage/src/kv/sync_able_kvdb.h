@@ -122,6 +122,8 @@ public:
     int GetSyncDataSize(const std::string &device, size_t &size) const;
 
     int GetWatermarkInfo(const std::string &device, WatermarkInfo &info);
+
+    int SetWaterMarkFlushThreshold(uint32_t threshold);
 #endif
 protected:
     virtual IKvDBSyncInterface *GetSyncInterface() = 0;
@@ -75,6 +75,8 @@ void SyncAbleKvDBConnection::InitPragmaFunc()
             errCode = SetPushDataInterceptor(*static_cast<PushDataInterceptor *>(parameter)); }},
         {PRAGMA_SUBSCRIBE_QUERY, [this](void *parameter, int &errCode) {
             errCode = PragmaSyncAction(static_cast<PragmaSync *>(parameter)); }},
+        {PRAGMA_SET_WATERMARK_FLUSH_THRESHOLD, [this](void *parameter, int &errCode) {
+            errCode = SetWaterMarkFlushThreshold(static_cast<const uint32_t *>(parameter)); }},
 #endif
         {PRAGMA_PERFORMANCE_ANALYSIS_GET_REPORT, [](void *parameter, int &errCode) {
             *(static_cast<std::string *>(parameter)) = PerformanceAnalysis::GetInstance()->GetStatistics(); }},
@@ -360,6 +362,20 @@ int SyncAbleKvDBConnection::SetSyncRetry(bool isRetry)
     return kvDB->SetSyncRetry(isRetry);
 }
 
+#ifdef USE_DISTRIBUTEDDB_DEVICE
+int SyncAbleKvDBConnection::SetWaterMarkFlushThreshold(const uint32_t *threshold)
+{
+    if (threshold == nullptr || *threshold > DBConstant::MAX_WATERMARK_FLUSH_THRESHOLD) {
+        return -E_INVALID_ARGS;
+    }
+    SyncAbleKvDB *kvDB = GetDB<SyncAbleKvDB>();
+    if (kvDB == nullptr) {
+        return -E_INVALID_CONNECTION;
+    }
+    return kvDB->SetWaterMarkFlushThreshold(*threshold);
+}
+#endif
+
 int SyncAbleKvDBConnection::SetEqualIdentifier(const PragmaSetEqualIdentifier *param)
 {
     if (param == nullptr) {
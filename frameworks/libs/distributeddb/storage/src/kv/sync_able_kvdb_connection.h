@@ -86,6 +86,9 @@ private:
     int SetRemotePushFinishedNotify(PragmaRemotePushNotify *notifyParma);
 
     int SetSyncRetry(bool isRetry);
+#ifdef USE_DISTRIBUTEDDB_DEVICE
+    int SetWaterMarkFlushThreshold(const uint32_t *threshold);
+#endif
     // Set an equal identifier for this database, After this called, send msg to the target will use this identifier
     int SetEqualIdentifier(const PragmaSetEqualIdentifier *param);
 
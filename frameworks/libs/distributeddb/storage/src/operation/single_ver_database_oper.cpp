@@ -22,6 +22,22 @@
 #include "platform_specific.h"
 
 namespace DistributedDB {
+namespace {
+int ExportDatabaseFile(const std::string &currentDb, CipherType cipherType, const CipherPassword &currPasswd,
+    const std::string &backupDb, const CipherPassword &passwd)
+{
+    // Copy the pages directly if no need to encrypt, it's much faster than exporting all records into a new database
+    if (currPasswd.GetSize() == 0 && passwd.GetSize() == 0) {
+        int errCode = SQLiteUtils::BackupDatabase(currentDb, backupDb);
+        if (errCode == E_OK) {
+            return E_OK;
+        }
+        LOGW("Backup the database failed:%d, export it instead", errCode);
+    }
+    return SQLiteUtils::ExportDatabase(currentDb, cipherType, currPasswd, backupDb, passwd);
+}
+}
+
 SingleVerDatabaseOper::SingleVerDatabaseOper(SQLiteSingleVerNaturalStore *naturalStore,
     SQLiteStorageEngine *storageEngine)
     : singleVerNaturalStore_(naturalStore),
@@ -182,7 +198,7 @@ int SingleVerDatabaseOper::ExportMainDB(const std::string &currentDir, const Cip
     CipherPassword currPasswd;
     singleVerNaturalStore_->GetDbProperties().GetPassword(cipherType, currPasswd);
     LOGD("Begin the sqlite main database export!");
-    int errCode = SQLiteUtils::ExportDatabase(currentDb, cipherType, currPasswd, backupDbName, passwd);
+    int errCode = ExportDatabaseFile(currentDb, cipherType, currPasswd, backupDbName, passwd);
     if (errCode != E_OK) {
         LOGE("Export the database failed:%d", errCode);
     }
@@ -204,8 +220,7 @@ int SingleVerDatabaseOper::ExportMetaDB(const std::string &currentDir, const Cip
 
     // Set metaDB db passwd same as mainDB temp, may be not need
     LOGI("Begin the sqlite meta database export.");
-    int errCode = SQLiteUtils::ExportDatabase(currentDb, CipherType::DEFAULT, CipherPassword(),
-        backupDbName, CipherPassword());
+    int errCode = ExportDatabaseFile(currentDb, CipherType::DEFAULT, CipherPassword(), backupDbName, CipherPassword());
     if (errCode != E_OK) {
         LOGE("Export the database failed:%d", errCode);
     }
@@ -532,6 +547,7 @@ void SingleVerDatabaseOper::InitDataBaseOption(OpenDbProperties &option) const
     option.subdir = dirPath;
     option.securityOpt = securityOpt;
     option.conflictReslovePolicy = properties.GetIntProp(KvDBProperties::CONFLICT_RESOLVE_POLICY, 0);
+    option.isReducedSyncIndex = properties.GetBoolProp(KvDBProperties::REDUCED_SYNC_INDEX, false);
 }
 
 int SingleVerDatabaseOper::RunRekeyLogic(CipherType type, const CipherPassword &passwd)
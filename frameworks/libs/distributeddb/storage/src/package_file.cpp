@@ -44,6 +44,7 @@ namespace {
     const string INVALID_FILE_WORDS = "..";
 
     const uint32_t FILE_HEADER_LEN = MAGIC_LEN + CHECKSUM_LEN + DEVICE_ID_LEN + Parcel::GetUInt32Len() * 3;
+    const uint32_t CHECKSUM_OFFSET = MAGIC_LEN + Parcel::GetUInt32Len();
     const uint32_t FILE_CONTEXT_LEN = MAX_FILE_NAME_LEN + Parcel::GetUInt32Len() * 2 + Parcel::GetUInt64Len() * 2;
 }
 
@@ -55,6 +56,43 @@ struct FileContext {
     uint64_t offset = 0;
 };
 
+// Hash the package content after the checksum field, the result is the same as reading the package in blocks of
+// CHECKSUM_BLOCK_SIZE with the last block padded with zero, which is the format since the first version
+class ChecksumCalc {
+public:
+    int Initialize()
+    {
+        len_ = 0;
+        return calc_.Initialize();
+    }
+
+    int Update(const uint8_t *data, uint64_t len)
+    {
+        len_ += len;
+        return calc_.Update(data, len);
+    }
+
+    int GetResult(vector<char> &result)
+    {
+        vector<uint8_t> padding(CHECKSUM_BLOCK_SIZE - len_ % CHECKSUM_BLOCK_SIZE, 0);
+        int errCode = calc_.Update(padding);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        vector<uint8_t> resultBuf;
+        errCode = calc_.GetResult(resultBuf);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        result.assign(resultBuf.begin(), resultBuf.end());
+        return E_OK;
+    }
+
+private:
+    ValueHashCalc calc_;
+    uint64_t len_ = 0;
+};
+
 static void Clear(ofstream &target, const string &targetFile)
 {
     if (target.is_open()) {
@@ -72,38 +110,34 @@ static int GetChecksum(const string &file, vector<char> &result)
         LOGE("[GetChecksum]Error fileHandle! sys[%d]", errno);
         return -E_INVALID_PATH;
     }
-    ValueHashCalc calc;
+    ChecksumCalc calc;
     int errCode = calc.Initialize();
     if (errCode != E_OK) {
         LOGE("[GetChecksum]Calc Initialize fail!");
         return errCode;
     }
-    fileHandle.seekg(static_cast<int64_t>(MAGIC_LEN + Parcel::GetUInt32Len() + CHECKSUM_LEN), ios_base::beg);
-    vector<uint8_t> buffer(CHECKSUM_BLOCK_SIZE, 0);
+    fileHandle.seekg(static_cast<int64_t>(CHECKSUM_OFFSET + CHECKSUM_LEN), ios_base::beg);
+    vector<char> buffer(BUFFER_LEN, 0);
     bool readEnd = false;
     while (!readEnd) {
-        fileHandle.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+        fileHandle.read(buffer.data(), buffer.size());
         if (fileHandle.eof()) {
             readEnd = true;
         } else if (!fileHandle.good()) {
             LOGE("[GetChecksum]fileHandle error! sys[%d]", errno);
             return -E_INVALID_PATH;
         }
-        errCode = calc.Update(buffer);
+        errCode = calc.Update(reinterpret_cast<uint8_t *>(buffer.data()), static_cast<uint64_t>(fileHandle.gcount()));
         if (errCode != E_OK) {
             LOGE("[GetChecksum]Calc Update fail!");
             return errCode;
         }
-        buffer.assign(CHECKSUM_BLOCK_SIZE, 0);
     }
-    vector<uint8_t> resultBuf;
-    errCode = calc.GetResult(resultBuf);
+    errCode = calc.GetResult(result);
     if (errCode != E_OK) {
         LOGE("[GetChecksum]Calc GetResult fail!");
-        return errCode;
     }
-    result.assign(resultBuf.begin(), resultBuf.end());
-    return E_OK;
+    return errCode;
 }
 
 static int GetFileContexts(const string &sourcePath, list<FileContext> &fileContexts)
@@ -149,7 +183,8 @@ static int GetFileContexts(const string &sourcePath, list<FileContext> &fileCont
     return E_OK;
 }
 
-static int FileContentCopy(ifstream &sourceFile, ofstream &targetFile, uint64_t fileLen)
+static int FileContentCopy(ifstream &sourceFile, ofstream &targetFile, uint64_t fileLen,
+    ChecksumCalc *calc = nullptr)
 {
     uint64_t leftLen = fileLen;
     vector<char> buffer(BUFFER_LEN, 0);
@@ -165,12 +200,19 @@ static int FileContentCopy(ifstream &sourceFile, ofstream &targetFile, uint64_t
             LOGE("[FileContentCopy] TargetFile error! sys[%d]", errno);
             return -E_INVALID_PATH;
         }
+        if (calc != nullptr) {
+            int errCode = calc->Update(reinterpret_cast<uint8_t *>(buffer.data()), readLen);
+            if (errCode != E_OK) {
+                LOGE("[FileContentCopy] Calc checksum fail!");
+                return errCode;
+            }
+        }
         leftLen -= readLen;
     }
     return E_OK;
 }
 
-static int PackFileHeader(ofstream &targetFile, const FileInfo &fileInfo, uint32_t fileNum)
+static int PackFileHeader(ofstream &targetFile, const FileInfo &fileInfo, uint32_t fileNum, ChecksumCalc &calc)
 {
     if (fileInfo.deviceID.size() != DEVICE_ID_LEN) {
         return -E_INVALID_ARGS;
@@ -209,7 +251,9 @@ static int PackFileHeader(ofstream &targetFile, const FileInfo &fileInfo, uint32
         LOGE("[PackFileHeader] TargetFile error! sys[%d]", errno);
         return -E_INVALID_PATH;
     }
-    return E_OK;
+    // The magic, version and checksum itself are not in the checksum
+    const uint32_t skipLen = CHECKSUM_OFFSET + CHECKSUM_LEN;
+    return calc.Update(buffer.data() + skipLen, FILE_HEADER_LEN - skipLen);
 }
 
 static int CheckMagicHeader(Parcel &fileHeaderParcel)
@@ -273,7 +317,7 @@ static int UnpackFileHeader(ifstream &sourceFile, const string &sourceFileName,
     return E_OK;
 }
 
-static int PackFileContext(ofstream &targetFile, const FileContext &fileContext)
+static int PackFileContext(ofstream &targetFile, const FileContext &fileContext, ChecksumCalc &calc)
 {
     vector<uint8_t> buffer(FILE_CONTEXT_LEN, 0);
     Parcel parcel(buffer.data(), FILE_CONTEXT_LEN);
@@ -303,7 +347,7 @@ static int PackFileContext(ofstream &targetFile, const FileContext &fileContext)
         LOGE("[PackFileContext] TargetFile error! sys[%d]", errno);
         return -E_INVALID_PATH;
     }
-    return E_OK;
+    return calc.Update(buffer.data(), buffer.size());
 }
 
 static int UnpackFileContext(ifstream &sourceFile, FileContext &fileContext)
@@ -326,7 +370,8 @@ static int UnpackFileContext(ifstream &sourceFile, FileContext &fileContext)
     return E_OK;
 }
 
-static int PackFileContent(ofstream &targetFile, const string &sourcePath, const FileContext &fileContext)
+static int PackFileContent(ofstream &targetFile, const string &sourcePath, const FileContext &fileContext,
+    ChecksumCalc &calc)
 {
     if (fileContext.fileType != OS::FILE) {
         return E_OK;
@@ -353,7 +398,7 @@ static int PackFileContent(ofstream &targetFile, const string &sourcePath, const
         return -E_INVALID_PATH;
     }
 
-    return FileContentCopy(file, targetFile, fileLen);
+    return FileContentCopy(file, targetFile, fileLen, &calc);
 }
 
 static int UnpackFileContent(ifstream &sourceFile, const string &targetPath, const FileContext &fileContext)
@@ -383,21 +428,17 @@ static int UnpackFileContent(ifstream &sourceFile, const string &targetPath, con
     return errCode;
 }
 
-static int WriteChecksum(const string &targetFile)
+// The checksum is calculated while packing, write it back to the header instead of reading the package again
+static int WriteChecksum(ofstream &targetHandle, const string &targetFile, ChecksumCalc &calc)
 {
     vector<char> checksum(CHECKSUM_LEN, 0);
-    int errCode = GetChecksum(targetFile, checksum);
+    int errCode = calc.GetResult(checksum);
     if (errCode != E_OK) {
+        Clear(targetHandle, targetFile);
         LOGE("Get checksum failed.");
         return errCode;
     }
-    ofstream targetHandle(targetFile, ios::in | ios::out | ios::binary);
-    if (!targetHandle.good()) {
-        Clear(targetHandle, targetFile);
-        LOGE("[WriteChecksum]targetHandle error, sys err [%d]", errno);
-        return -E_INVALID_PATH;
-    }
-    targetHandle.seekp(static_cast<int64_t>(MAGIC_LEN + Parcel::GetUInt32Len()), ios_base::beg);
+    targetHandle.seekp(static_cast<int64_t>(CHECKSUM_OFFSET), ios_base::beg);
     if (!targetHandle.good()) {
         Clear(targetHandle, targetFile);
         LOGE("[WriteChecksum]targetHandle error after seekp, sys err [%d]", errno);
@@ -410,6 +451,11 @@ static int WriteChecksum(const string &targetFile)
         return -E_INVALID_PATH;
     }
     targetHandle.close();
+    if (!targetHandle.good()) {
+        Clear(targetHandle, targetFile);
+        LOGE("[WriteChecksum]targetHandle error after close, sys err [%d]", errno);
+        return -E_INVALID_PATH;
+    }
     return E_OK;
 }
 
@@ -498,7 +544,14 @@ int PackageFile::ExePackage(const string &sourcePath, const string &targetFile,
         return errCode;
     }
 
-    errCode = PackFileHeader(targetHandle, fileInfo, static_cast<uint32_t>(fileContexts.size()));
+    ChecksumCalc calc;
+    errCode = calc.Initialize();
+    if (errCode != E_OK) {
+        Clear(targetHandle, targetFile);
+        LOGE("[PackageFiles]Calc Initialize fail!");
+        return errCode;
+    }
+    errCode = PackFileHeader(targetHandle, fileInfo, static_cast<uint32_t>(fileContexts.size()), calc);
     if (errCode != E_OK) {
         Clear(targetHandle, targetFile);
         LOGE("[PackageFiles]Pack file header err[%d]!!!", errCode);
@@ -508,7 +561,7 @@ int PackageFile::ExePackage(const string &sourcePath, const string &targetFile,
     uint64_t offset = FILE_HEADER_LEN + FILE_CONTEXT_LEN * static_cast<uint64_t>(fileContexts.size());
     for (auto &file : fileContexts) {
         file.offset = offset;
-        errCode = PackFileContext(targetHandle, file);
+        errCode = PackFileContext(targetHandle, file, calc);
         if (errCode != E_OK) {
             Clear(targetHandle, targetFile);
             LOGE("[PackageFiles]Pack file context err[%d]!!!", errCode);
@@ -518,14 +571,13 @@ int PackageFile::ExePackage(const string &sourcePath, const string &targetFile,
     }
     for (const auto &file : fileContexts) {
         // If file type is path no need pack content in PackFileContent
-        errCode = PackFileContent(targetHandle, sourcePath, file);
+        errCode = PackFileContent(targetHandle, sourcePath, file, calc);
         if (errCode != E_OK) {
             Clear(targetHandle, targetFile);
             return errCode;
         }
     }
-    targetHandle.close();
-    return WriteChecksum(targetFile);
+    return WriteChecksum(targetHandle, targetFile, calc);
 }
 
 int PackageFile::UnpackFile(const string &sourceFile, const string &targetPath, FileInfo &fileInfo)
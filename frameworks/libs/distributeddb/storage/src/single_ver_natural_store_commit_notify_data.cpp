@@ -14,26 +14,64 @@
  */
 
 #include "single_ver_natural_store_commit_notify_data.h"
+
+#include <algorithm>
+
 #include "db_errno.h"
 #include "log_print.h"
 #include "db_common.h"
 
 namespace DistributedDB {
-SingleVerNaturalStoreCommitNotifyData::SingleVerNaturalStoreCommitNotifyData() : conflictedFlag_(0) {}
+SingleVerNaturalStoreCommitNotifyData::SingleVerNaturalStoreCommitNotifyData()
+    : insertedEntries_(std::make_shared<std::list<Entry>>()),
+      updatedEntries_(std::make_shared<std::list<Entry>>()),
+      deletedEntries_(std::make_shared<std::list<Entry>>()),
+      isSnapshotGot_(false),
+      conflictedFlag_(0)
+{}
 
 const std::list<Entry> SingleVerNaturalStoreCommitNotifyData::GetInsertedEntries(int &errCode) const
 {
-    return FilterEntriesByKey(insertedEntries_, keyFilter_, errCode);
+    return FilterEntriesByKey(*insertedEntries_, keyFilter_, errCode);
 }
 
 const std::list<Entry> SingleVerNaturalStoreCommitNotifyData::GetUpdatedEntries(int &errCode) const
 {
-    return FilterEntriesByKey(updatedEntries_, keyFilter_, errCode);
+    return FilterEntriesByKey(*updatedEntries_, keyFilter_, errCode);
 }
 
 const std::list<Entry> SingleVerNaturalStoreCommitNotifyData::GetDeletedEntries(int &errCode) const
 {
-    return FilterEntriesByKey(deletedEntries_, keyFilter_, errCode);
+    return FilterEntriesByKey(*deletedEntries_, keyFilter_, errCode);
+}
+
+std::shared_ptr<const std::list<Entry>> SingleVerNaturalStoreCommitNotifyData::GetInsertedEntriesSnapshot(
+    int &errCode) const
+{
+    return GetEntriesSnapshot(insertedEntries_, errCode);
+}
+
+std::shared_ptr<const std::list<Entry>> SingleVerNaturalStoreCommitNotifyData::GetUpdatedEntriesSnapshot(
+    int &errCode) const
+{
+    return GetEntriesSnapshot(updatedEntries_, errCode);
+}
+
+std::shared_ptr<const std::list<Entry>> SingleVerNaturalStoreCommitNotifyData::GetDeletedEntriesSnapshot(
+    int &errCode) const
+{
+    return GetEntriesSnapshot(deletedEntries_, errCode);
+}
+
+std::shared_ptr<const std::list<Entry>> SingleVerNaturalStoreCommitNotifyData::GetEntriesSnapshot(
+    const std::shared_ptr<std::list<Entry>> &entries, int &errCode) const
+{
+    if (!keyFilter_.empty()) {
+        return std::make_shared<const std::list<Entry>>(FilterEntriesByKey(*entries, keyFilter_, errCode));
+    }
+    errCode = E_OK;
+    isSnapshotGot_ = true;
+    return entries;
 }
 
 const std::list<KvDBConflictEntry> SingleVerNaturalStoreCommitNotifyData::GetCommitConflicts(int &errCode) const
@@ -49,9 +87,8 @@ void SingleVerNaturalStoreCommitNotifyData::SetFilterKey(const Key &key)
 
 bool SingleVerNaturalStoreCommitNotifyData::IsChangedDataEmpty() const
 {
-    int errCode;
-    return (!IsCleared() && GetInsertedEntries(errCode).empty() && GetUpdatedEntries(errCode).empty() &&
-        GetDeletedEntries(errCode).empty());
+    return (!IsCleared() && IsFilteredEntriesEmpty(*insertedEntries_, keyFilter_) &&
+        IsFilteredEntriesEmpty(*updatedEntries_, keyFilter_) && IsFilteredEntriesEmpty(*deletedEntries_, keyFilter_));
 }
 
 bool SingleVerNaturalStoreCommitNotifyData::IsConflictedDataEmpty() const
@@ -59,20 +96,29 @@ bool SingleVerNaturalStoreCommitNotifyData::IsConflictedDataEmpty() const
     return conflictedEntries_.empty();
 }
 
-int SingleVerNaturalStoreCommitNotifyData::InsertCommittedData(const Entry &entry, DataType dataType, bool needMerge)
+int SingleVerNaturalStoreCommitNotifyData::InsertCommittedData(Entry entry, DataType dataType, bool needMerge,
+    const Key &hashKey)
 {
+    if (isSnapshotGot_) {
+        LOGE("The committed data is shared with observers, can not be changed.");
+        return -E_NOT_SUPPORT;
+    }
     if (!needMerge) {
-        return InsertEntry(dataType, entry);
+        return InsertEntry(dataType, std::move(entry));
     }
 
-    Key hashKey;
-    DBCommon::CalcValueHash(entry.key, hashKey);
+    Key calcHashKey;
+    if (hashKey.empty()) {
+        DBCommon::CalcValueHash(entry.key, calcHashKey);
+    }
     // conclude the operation type
-    if (!IsKeyPropSet(hashKey)) {
+    auto propIter = keyPropRecord_.find(hashKey.empty() ? calcHashKey : hashKey);
+    if (propIter == keyPropRecord_.end()) {
         return E_OK;
     }
+    ItemProp &itemProp = propIter->second;
     DataType type = DataType::NONE;
-    if (keyPropRecord_[hashKey].existStatus == ExistStatus::EXIST) {
+    if (itemProp.existStatus == ExistStatus::EXIST) {
         if (dataType == DataType::INSERT || dataType == DataType::UPDATE) {
             type = DataType::UPDATE;
         } else if (dataType == DataType::DELETE) {
@@ -86,25 +132,42 @@ int SingleVerNaturalStoreCommitNotifyData::InsertCommittedData(const Entry &entr
         }
     }
 
-    // clear the old data
-    DeleteEntryByKey(entry.key, keyPropRecord_[hashKey].latestType);
+    // clear the old data by the recorded position, no need to search the entries
+    std::list<Entry> *oldEntries = GetEntriesByType(itemProp.latestType);
+    if (oldEntries != nullptr) {
+        oldEntries->erase(itemProp.entryIter);
+    }
 
     // update the latest operation type value
-    keyPropRecord_[hashKey].latestType = type;
+    itemProp.latestType = type;
+
+    return InsertEntry(type, std::move(entry), &itemProp.entryIter);
+}
 
-    return InsertEntry(type, entry);
+int SingleVerNaturalStoreCommitNotifyData::InsertEntry(DataType dataType, Entry &&entry,
+    std::list<Entry>::iterator *entryIter)
+{
+    std::list<Entry> *entries = GetEntriesByType(dataType);
+    if (entries == nullptr) {
+        return E_OK;
+    }
+    entries->push_back(std::move(entry));
+    if (entryIter != nullptr) {
+        *entryIter = std::prev(entries->end());
+    }
+    return E_OK;
 }
 
-int SingleVerNaturalStoreCommitNotifyData::InsertEntry(DataType dataType, const Entry &entry)
+std::list<Entry> *SingleVerNaturalStoreCommitNotifyData::GetEntriesByType(DataType dataType) const
 {
     if (dataType == DataType::INSERT) {
-        insertedEntries_.push_back(entry);
+        return insertedEntries_.get();
     } else if (dataType == DataType::UPDATE) {
-        updatedEntries_.push_back(entry);
+        return updatedEntries_.get();
     } else if (dataType == DataType::DELETE) {
-        deletedEntries_.push_back(entry);
+        return deletedEntries_.get();
     }
-    return E_OK;
+    return nullptr;
 }
 
 int SingleVerNaturalStoreCommitNotifyData::InsertConflictedItem(const DataItemInfo &itemInfo, bool isOriginal)
@@ -150,31 +213,17 @@ const std::list<Entry> SingleVerNaturalStoreCommitNotifyData::FilterEntriesByKey
     return filterEntries;
 }
 
-void SingleVerNaturalStoreCommitNotifyData::DeleteEntry(const Key &key, std::list<Entry> &entries) const
+bool SingleVerNaturalStoreCommitNotifyData::IsFilteredEntriesEmpty(const std::list<Entry> &entries,
+    const Key &filterKey)
 {
-    if (entries.empty()) {
-        return;
+    if (filterKey.empty()) {
+        return entries.empty();
     }
-    entries.remove_if([&key](const Entry &entry) {
-        return entry.key == key;
+    return std::none_of(entries.begin(), entries.end(), [&filterKey](const Entry &entry) {
+        return entry.key == filterKey;
     });
 }
 
-void SingleVerNaturalStoreCommitNotifyData::DeleteEntryByKey(const Key &key, DataType type)
-{
-    if (type == DataType::INSERT) {
-        DeleteEntry(key, insertedEntries_);
-    }
-
-    if (type == DataType::UPDATE) {
-        DeleteEntry(key, updatedEntries_);
-    }
-
-    if (type == DataType::DELETE) {
-        DeleteEntry(key, deletedEntries_);
-    }
-}
-
 void SingleVerNaturalStoreCommitNotifyData::InitKeyPropRecord(const Key &key, ExistStatus status)
 {
     // check if key status set before, we can only set key status at the first time
@@ -16,6 +16,8 @@
 #ifndef SINGLE_VER_NATURAL_STORE_COMMIT_NOTIFY_DATA_H
 #define SINGLE_VER_NATURAL_STORE_COMMIT_NOTIFY_DATA_H
 
+#include <atomic>
+
 #include "kvdb_commit_notify_filterable_data.h"
 
 namespace DistributedDB {
@@ -54,13 +56,21 @@ public:
 
     const std::list<KvDBConflictEntry> GetCommitConflicts(int &errCode) const override;
 
+    // The entries can not be changed any more once the snapshot is got.
+    std::shared_ptr<const std::list<Entry>> GetInsertedEntriesSnapshot(int &errCode) const override;
+
+    std::shared_ptr<const std::list<Entry>> GetUpdatedEntriesSnapshot(int &errCode) const override;
+
+    std::shared_ptr<const std::list<Entry>> GetDeletedEntriesSnapshot(int &errCode) const override;
+
     void SetFilterKey(const Key &key) override;
 
     bool IsChangedDataEmpty() const override;
 
     bool IsConflictedDataEmpty() const override;
 
-    int InsertCommittedData(const Entry &entry, DataType dataType, bool needMerge = false);
+    // hashKey is calculated from the entry key if it is empty.
+    int InsertCommittedData(Entry entry, DataType dataType, bool needMerge = false, const Key &hashKey = {});
 
     int InsertConflictedItem(const DataItemInfo &itemInfo, bool isOriginal = false);
 
@@ -77,16 +87,20 @@ private:
     struct ItemProp {
         ExistStatus existStatus = ExistStatus::NONE; // indicator if the key exist in db before this transaction
         DataType latestType = DataType::NONE; // indicator the latest operation type for this key
+        std::list<Entry>::iterator entryIter; // the entry of the latest operation, valid if latestType is not NONE
     };
 
-    int InsertEntry(DataType dataType, const Entry &entry);
+    int InsertEntry(DataType dataType, Entry &&entry, std::list<Entry>::iterator *entryIter = nullptr);
+
+    std::list<Entry> *GetEntriesByType(DataType dataType) const;
+
+    std::shared_ptr<const std::list<Entry>> GetEntriesSnapshot(const std::shared_ptr<std::list<Entry>> &entries,
+        int &errCode) const;
 
     static const std::list<Entry> FilterEntriesByKey(const std::list<Entry> &entries,
         const Key &filterKey, int &errCode);
 
-    void DeleteEntry(const Key &key, std::list<Entry> &entries) const;
-
-    void DeleteEntryByKey(const Key &key, DataType type);
+    static bool IsFilteredEntriesEmpty(const std::list<Entry> &entries, const Key &filterKey);
 
     void PutIntoConflictData(const DataItemInfo &orgItemInfo, const DataItemInfo &newItemInfo);
 
@@ -100,9 +114,11 @@ private:
     static const int SINGLE_VER_CONFLICT_FOREIGN_KEY_ORIG = 0x02; // sync conflict for different origin dev
     static const int SINGLE_VER_CONFLICT_NATIVE_ALL = 0x0c;       // native conflict.
 
-    std::list<Entry> insertedEntries_;
-    std::list<Entry> updatedEntries_;
-    std::list<Entry> deletedEntries_;
+    // Shared with the observers as snapshot after commit, so not copied for each observer.
+    std::shared_ptr<std::list<Entry>> insertedEntries_;
+    std::shared_ptr<std::list<Entry>> updatedEntries_;
+    std::shared_ptr<std::list<Entry>> deletedEntries_;
+    mutable std::atomic<bool> isSnapshotGot_;
     std::list<KvDBConflictEntry> conflictedEntries_;
     Key keyFilter_;
     std::map<Key, ItemProp> keyPropRecord_; // hash key mapping to item property
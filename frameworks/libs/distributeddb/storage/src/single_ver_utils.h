@@ -49,6 +49,7 @@ struct OpenDbProperties {
     bool isNeedRmCorruptedDb = false;
     bool readOnly = false;
     bool isHashTable = false;
+    bool isReducedSyncIndex = false;
 };
 
 int GetPathSecurityOption(const std::string &filePath, SecurityOption &secOpt);
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_ver_value_cache.h"
+
+namespace DistributedDB {
+void SingleVerValueCache::SetCapacity(uint64_t capacity)
+{
+    shardCapacity_.store(capacity / SHARD_NUM);
+    InvalidateAll();
+}
+
+bool SingleVerValueCache::IsEnabled() const
+{
+    return shardCapacity_.load() != 0;
+}
+
+uint64_t SingleVerValueCache::GetGeneration() const
+{
+    return generation_.load();
+}
+
+bool SingleVerValueCache::Get(const Key &key, Value &value)
+{
+    Shard &shard = shards_[GetShardIndex(key)];
+    std::lock_guard<std::mutex> autoLock(shard.mutex);
+    auto iter = shard.index.find(key);
+    if (iter == shard.index.end()) {
+        missCount_++;
+        return false;
+    }
+    shard.lruList.splice(shard.lruList.begin(), shard.lruList, iter->second);
+    value = iter->second->value;
+    hitCount_++;
+    return true;
+}
+
+void SingleVerValueCache::Put(const Key &key, const Value &value, uint64_t generation)
+{
+    uint64_t capacity = shardCapacity_.load();
+    uint64_t nodeSize = GetNodeSize(key, value);
+    if (nodeSize > capacity) {
+        return;
+    }
+    Shard &shard = shards_[GetShardIndex(key)];
+    std::lock_guard<std::mutex> autoLock(shard.mutex);
+    // The value was read before a later commit, it may be stale already.
+    if (generation != generation_.load()) {
+        return;
+    }
+    auto iter = shard.index.find(key);
+    if (iter != shard.index.end()) {
+        EraseNode(shard, iter);
+    }
+    while (!shard.lruList.empty() && shard.usedSize + nodeSize > capacity) {
+        EraseNode(shard, shard.index.find(shard.lruList.back().key));
+        evictCount_++;
+    }
+    shard.lruList.push_front({key, value});
+    shard.index[key] = shard.lruList.begin();
+    shard.usedSize += nodeSize;
+}
+
+void SingleVerValueCache::Invalidate(const std::vector<Key> &keys)
+{
+    if (keys.empty()) {
+        return;
+    }
+    // Bump the generation before erasing, so that a reader which loaded the old value can not insert it back.
+    generation_++;
+    for (const auto &key : keys) {
+        Shard &shard = shards_[GetShardIndex(key)];
+        std::lock_guard<std::mutex> autoLock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter != shard.index.end()) {
+            EraseNode(shard, iter);
+        }
+    }
+}
+
+void SingleVerValueCache::InvalidateAll()
+{
+    generation_++;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> autoLock(shard.mutex);
+        ClearShard(shard);
+    }
+}
+
+void SingleVerValueCache::GetStatistics(ValueCacheStatistics &statistics) const
+{
+    statistics.hitCount = hitCount_.load();
+    statistics.missCount = missCount_.load();
+    statistics.evictCount = evictCount_.load();
+}
+
+size_t SingleVerValueCache::GetShardIndex(const Key &key)
+{
+    // FNV-1a, keys are short so hashing every byte is cheap enough
+    uint32_t hash = 2166136261u; // FNV offset basis
+    for (const auto &ch : key) {
+        hash ^= ch;
+        hash *= 16777619u; // FNV prime
+    }
+    return hash % SHARD_NUM;
+}
+
+uint64_t SingleVerValueCache::GetNodeSize(const Key &key, const Value &value)
+{
+    // key is stored in both the lru list and the index
+    return key.size() * 2 + value.size() + NODE_OVERHEAD;
+}
+
+void SingleVerValueCache::EraseNode(Shard &shard, std::map<Key, std::list<CacheNode>::iterator>::iterator iter)
+{
+    uint64_t nodeSize = GetNodeSize(iter->second->key, iter->second->value);
+    shard.usedSize = (shard.usedSize > nodeSize) ? (shard.usedSize - nodeSize) : 0;
+    shard.lruList.erase(iter->second);
+    shard.index.erase(iter);
+}
+
+void SingleVerValueCache::ClearShard(Shard &shard)
+{
+    shard.index.clear();
+    shard.lruList.clear();
+    shard.usedSize = 0;
+}
+} // namespace DistributedDB
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SINGLE_VER_VALUE_CACHE_H
+#define SINGLE_VER_VALUE_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "db_types.h"
+#include "macro_utils.h"
+#include "store_types.h"
+
+namespace DistributedDB {
+constexpr int VALUE_CACHE_MAX_SIZE_MIN = 0; // Unit MB, 0 means disabled, it is the default
+constexpr int VALUE_CACHE_MAX_SIZE_MAX = 16;
+
+// Size bounded LRU cache of sync data values, split into shards to reduce lock contention on hot keys.
+// An insert carries the generation read before the value was loaded from db, and is dropped if any
+// invalidation happened in between, so a reader can never put back a value older than the last commit.
+class SingleVerValueCache {
+public:
+    SingleVerValueCache() = default;
+    ~SingleVerValueCache() = default;
+    DISABLE_COPY_ASSIGN_MOVE(SingleVerValueCache);
+
+    // 0 disables the cache and drops all cached values.
+    void SetCapacity(uint64_t capacity);
+    bool IsEnabled() const;
+
+    uint64_t GetGeneration() const;
+    bool Get(const Key &key, Value &value);
+    void Put(const Key &key, const Value &value, uint64_t generation);
+
+    void Invalidate(const std::vector<Key> &keys);
+    void InvalidateAll();
+
+    void GetStatistics(ValueCacheStatistics &statistics) const;
+
+private:
+    struct CacheNode {
+        Key key;
+        Value value;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<CacheNode> lruList; // front is the most recently used
+        std::map<Key, std::list<CacheNode>::iterator> index;
+        uint64_t usedSize = 0;
+    };
+
+    static constexpr size_t SHARD_NUM = 16;
+    static constexpr size_t NODE_OVERHEAD = 64; // approximate bookkeeping cost per cached value
+
+    static size_t GetShardIndex(const Key &key);
+    static uint64_t GetNodeSize(const Key &key, const Value &value);
+    void EraseNode(Shard &shard, std::map<Key, std::list<CacheNode>::iterator>::iterator iter);
+    void ClearShard(Shard &shard);
+
+    Shard shards_[SHARD_NUM];
+    std::atomic<uint64_t> shardCapacity_ = 0;
+    std::atomic<uint64_t> generation_ = 0;
+    std::atomic<uint64_t> hitCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+    std::atomic<uint64_t> evictCount_ = 0;
+};
+} // namespace DistributedDB
+#endif // SINGLE_VER_VALUE_CACHE_H
@@ -67,13 +67,14 @@ std::string DeviceTrackerLogTableManager::GetInsertTrigger(const TableInfo &tabl
     insertTrigger += "\t INSERT OR REPLACE INTO " + logTblName;
     insertTrigger += " (data_key, device, ori_device, timestamp, wtimestamp, flag, hash_key, cloud_gid";
     insertTrigger += ", extend_field, cursor, version, sharing_resource, status)";
-    insertTrigger += " VALUES (new." + std::string(DBConstant::SQLITE_INNER_ROWID) + ", '', '',";
+    insertTrigger += " SELECT new." + std::string(DBConstant::SQLITE_INNER_ROWID) + ", '', '',";
     insertTrigger += " get_sys_time(0), get_last_time(),";
     insertTrigger += " CASE WHEN (SELECT count(*)<>0 FROM " + logTblName + " WHERE hash_key=" +
-        CalcPrimaryKeyHash("NEW.", table, identity) + " AND flag&0x02=0x02) THEN 0x22 ELSE 0x02 END,";
-    insertTrigger += CalcPrimaryKeyHash("NEW.", table, identity) + ", '', ";
+        GetInsertHashKeyRef() + " AND flag&0x02=0x02) THEN 0x22 ELSE 0x02 END,";
+    insertTrigger += GetInsertHashKeyRef() + ", '', ";
     insertTrigger += table.GetTrackerTable().GetAssignValSql();
-    insertTrigger += ", " + CloudStorageUtils::GetSelectIncCursorSql(tableName) + ", '', '', 0);\n";
+    insertTrigger += ", " + CloudStorageUtils::GetSelectIncCursorSql(tableName) + ", '', '', 0" +
+        GetInsertHashKeyFromSql(CalcPrimaryKeyHash("NEW.", table, identity)) + ";\n";
     insertTrigger += "SELECT client_observer('" + tableName + "', NEW._rowid_, 0, 3";
     insertTrigger += ");\n";
     insertTrigger += "END;";
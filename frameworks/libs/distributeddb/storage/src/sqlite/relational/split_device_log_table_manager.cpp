@@ -44,11 +44,12 @@ std::string SplitDeviceLogTableManager::GetInsertTrigger(const TableInfo &table,
     insertTrigger += "BEGIN\n";
     insertTrigger += "\t INSERT OR REPLACE INTO " + logTblName;
     insertTrigger += " (data_key, device, ori_device, timestamp, wtimestamp, flag, hash_key)";
-    insertTrigger += " VALUES (new." + std::string(DBConstant::SQLITE_INNER_ROWID) + ", '', '',";
+    insertTrigger += " SELECT new." + std::string(DBConstant::SQLITE_INNER_ROWID) + ", '', '',";
     insertTrigger += " get_sys_time(0), get_last_time(),";
     insertTrigger += " CASE WHEN (SELECT count(*)<>0 FROM " + logTblName + " WHERE hash_key=" +
-        CalcPrimaryKeyHash("NEW.", table, identity) + " AND flag&0x02=0x02) THEN 0x22 ELSE 0x02 END,";
-    insertTrigger += CalcPrimaryKeyHash("NEW.", table, identity) + ");\n";
+        GetInsertHashKeyRef() + " AND flag&0x02=0x02) THEN 0x22 ELSE 0x02 END,";
+    insertTrigger += GetInsertHashKeyRef() + GetInsertHashKeyFromSql(CalcPrimaryKeyHash("NEW.", table, identity)) +
+        ";\n";
     insertTrigger += "END;";
     return insertTrigger;
 }
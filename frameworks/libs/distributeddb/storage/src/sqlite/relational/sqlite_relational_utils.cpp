@@ -1288,6 +1288,7 @@ void SQLiteRelationalUtils::FillSyncInfo(const CloudSyncOption &option, const Sy
     info.asyncDownloadAssets = option.asyncDownloadAssets;
     info.queryMode = option.queryMode;
     info.fullSync = option.isFullSync;
+    info.pipelineDownload = option.pipelineDownload;
 }
 
 int SQLiteRelationalUtils::PutCloudGid(sqlite3 *db, const std::string &tableName, std::vector<VBucket> &data)
@@ -754,7 +754,7 @@ int SQLiteSingleVerRelationalStorageExecutor::DeleteMetaData(const std::vector<K
 int SQLiteSingleVerRelationalStorageExecutor::DeleteMetaDataByPrefixKey(const Key &keyPrefix) const
 {
     static const std::string REMOVE_META_VALUE_BY_KEY_PREFIX_SQL = "DELETE FROM " +
-        std::string(DBConstant::RELATIONAL_PREFIX) + "metadata WHERE key>=? AND key<=?;";
+        std::string(DBConstant::RELATIONAL_PREFIX) + "metadata WHERE key>=? AND key<?;";
     sqlite3_stmt *statement = nullptr;
     int errCode = SQLiteUtils::GetStatement(dbHandle_, REMOVE_META_VALUE_BY_KEY_PREFIX_SQL, statement);
     if (errCode != E_OK) {
@@ -24,7 +24,7 @@ namespace {
     const std::string CLEAR_SQL = "DELETE FROM data;";
     const std::string SELECT_SQL = "SELECT value FROM data WHERE key=?;";
     const std::string SELECT_BATCH_SQL =
-        "SELECT key, value FROM data WHERE key>=? AND key<=? ORDER BY key ASC;";
+        "SELECT key, value FROM data WHERE key>=? AND key<? ORDER BY key ASC;";
     const std::string INSERT_SQL = "INSERT OR REPLACE INTO data VALUES(?,?);";
     const std::string DELETE_SQL = "DELETE FROM data WHERE key=?;";
 
@@ -19,6 +19,8 @@
 namespace DistributedDB {
 namespace {
     const unsigned int MAX_FIELD_NUM_IN_ONE_STATEMENT = 100u;
+    constexpr const char *INSERT_PK_ALIAS = "naturalbase_rdb_pk";
+    constexpr const char *INSERT_HASH_KEY_ALIAS = "hash_value";
 }
 
 int SqliteLogTableManager::AddRelationalLogTableTrigger(sqlite3 *db, const TableInfo &table,
@@ -301,6 +303,19 @@ std::string SqliteLogTableManager::CalcPkHash(const std::string &references, con
     return sql;
 }
 
+std::string SqliteLogTableManager::GetInsertHashKeyRef()
+{
+    return std::string(INSERT_PK_ALIAS) + "." + INSERT_HASH_KEY_ALIAS;
+}
+
+// calc_hash is the most expensive part of the insert trigger, it is calculated once in a single row subquery and
+// referenced by the log row and the lookups of old log. Subquery without FROM clause is never flattened by sqlite,
+// so the expression is not copied to each reference.
+std::string SqliteLogTableManager::GetInsertHashKeyFromSql(const std::string &hashKeyExpr)
+{
+    return " FROM (SELECT " + hashKeyExpr + " AS " + INSERT_HASH_KEY_ALIAS + ") AS " + INSERT_PK_ALIAS;
+}
+
 std::string SqliteLogTableManager::GetConflictPkSql(const TableInfo &table)
 {
     return "ON CONFLICT(hash_key)";
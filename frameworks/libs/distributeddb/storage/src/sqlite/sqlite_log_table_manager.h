@@ -55,6 +55,11 @@ protected:
 
     static std::string GetUpdateWithAssignSql(const TableInfo &table, const std::string &emptyValue,
         const std::string &matchValue, const std::string &missMatchValue);
+
+    // Reference to the primary key hash which is calculated once by the FROM clause of insert trigger
+    static std::string GetInsertHashKeyRef();
+
+    static std::string GetInsertHashKeyFromSql(const std::string &hashKeyExpr);
 private:
     virtual std::string GetInsertTrigger(const TableInfo &table, const std::string &identity) = 0;
     virtual std::string GetUpdateTrigger(const TableInfo &table, const std::string &identity) = 0;
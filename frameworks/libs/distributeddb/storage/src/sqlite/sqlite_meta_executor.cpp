@@ -115,7 +115,7 @@ int SqliteMetaExecutor::GetExistsDevicesFromMeta(sqlite3 *dbHandle, MetaMode met
 int SqliteMetaExecutor::GetMetaDataByPrefixKey(sqlite3 *dbHandle, bool isMemDb, const std::string &metaTableName,
     const Key &keyPrefix, std::map<Key, Value> &data)
 {
-    std::string sql = "SELECT key,value FROM " + metaTableName + " WHERE key >= ? AND key <= ?;";
+    std::string sql = "SELECT key,value FROM " + metaTableName + " WHERE key >= ? AND key < ?;";
     sqlite3_stmt *statement = nullptr;
     int errCode = SQLiteUtils::GetStatement(dbHandle, sql, statement);
     if (errCode != E_OK) {
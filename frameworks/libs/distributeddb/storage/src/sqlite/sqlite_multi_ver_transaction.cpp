@@ -51,7 +51,7 @@ const std::string SQLiteMultiVerTransaction::SELECT_ONE_SQL =
 const std::string SQLiteMultiVerTransaction::SELECT_BY_HASHKEY_VER_SQL =
     "SELECT oper_flag, value FROM version_data WHERE hash_key=? AND version=? ";
 const std::string SQLiteMultiVerTransaction::SELECT_BATCH_SQL =
-    "SELECT oper_flag, key, value, version FROM version_data WHERE key>=? AND key<=?" \
+    "SELECT oper_flag, key, value, version FROM version_data WHERE key>=? AND key<?" \
     "AND (timestamp>? OR (timestamp=? AND rowid>=?)) AND version<=? AND (oper_flag&0x08=0x08) " \
     "ORDER BY key ASC, version DESC;";
 // select the data whose hash key is same to the current data.
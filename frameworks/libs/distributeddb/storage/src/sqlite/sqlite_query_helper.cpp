@@ -305,7 +305,7 @@ int SqliteQueryHelper::GetQuerySql(std::string &sql, bool onlyRowid)
 
     const std::string &querySqlForUse = (onlyRowid ? PRE_QUERY_ROWID_SQL : PRE_QUERY_KV_SQL);
     sql = AssembleSqlForSuggestIndex(querySqlForUse, FILTER_NATIVE_DATA_SQL);
-    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<=?) ");
+    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<?) ");
     sql = keys_.empty() ? sql : (sql + " AND " + MapKeysInToSql(keys_.size()));
     sql += " AND (flag&0x200=0) ";
     if (sortType_ != SortType::NONE) {
@@ -333,7 +333,7 @@ int SqliteQueryHelper::GetSyncDataCheckSql(std::string &sql)
         return -E_INVALID_QUERY_FORMAT;
     }
     sql = PRE_QUERY_ITEM_SQL + tableName_ + " WHERE hash_key=? AND (flag&0x01=0) ";
-    sql += hasPrefixKey_ ? " AND (key>=? AND key<=?) " : "";
+    sql += hasPrefixKey_ ? " AND (key>=? AND key<?) " : "";
     sql = keys_.empty() ? sql : (sql + " AND " + MapKeysInToSql(keys_.size()));
     if (!transformed_) {
         errCode = ToQuerySql();
@@ -396,7 +396,7 @@ int SqliteQueryHelper::GetCountQuerySql(std::string &sql)
         return errCode;
     }
     sql = AssembleSqlForSuggestIndex(PRE_GET_COUNT_SQL, FILTER_NATIVE_DATA_SQL);
-    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<=?) ");
+    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<?) ");
     sql = keys_.empty() ? sql : (sql + " AND " + MapKeysInToSql(keys_.size()));
     sql += " AND (flag&0x200=0) ";
     sql += countSql_;
@@ -536,7 +536,7 @@ int SqliteQueryHelper::GetSyncDataQuerySql(std::string &sql, bool hasSubQuery, b
 
     sql = AssembleSqlForSuggestIndex(((isCount && !hasSubQuery) ?
         PRE_QUERY_COUNT_ITEM_SQL : PRE_QUERY_ITEM_SQL) + tableName_ + " ", FILTER_REMOTE_QUERY);
-    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<=?) ");
+    sql = !hasPrefixKey_ ? sql : (sql + " AND (key>=? AND key<?) ");
     sql = keys_.empty() ? sql : (sql + " AND " + MapKeysInToSql(keys_.size()));
     sql = hasSubQuery ? sql : (sql + " AND (timestamp>=? AND timestamp<?) ");
     sql += " AND (flag&0x200=0) ";
@@ -838,12 +838,12 @@ std::string SqliteQueryHelper::CheckAndFormatSuggestIndex() const
 
 std::string SqliteQueryHelper::MapKeysInSubCondition(const std::string &accessStr) const
 {
-    std::string resultStr = "hex(" + accessStr + "key) IN (";
+    std::string resultStr = accessStr + "key IN (";
     for (auto iter = keys_.begin(); iter != keys_.end(); iter++) {
         if (iter != keys_.begin()) {
             resultStr += ", ";
         }
-        resultStr += "'" + DBCommon::VectorToHexString(*iter) + "' ";
+        resultStr += "x'" + DBCommon::VectorToHexString(*iter) + "' ";
     }
     resultStr += ")";
     return resultStr;
@@ -869,7 +869,10 @@ int SqliteQueryHelper::GetSubscribeCondition(const std::string &accessStr, std::
     }
 
     if (hasPrefixKey_) {
-        conditionStr += "(hex(" + accessStr + "key) LIKE '" + DBCommon::VectorToHexString(prefixKey_) + "%')";
+        // compare the key blob with the prefix range directly, avoid hex encoding the key of every row
+        conditionStr += "(" + accessStr + "key>=x'" + DBCommon::VectorToHexString(prefixKey_) + "' AND " +
+            accessStr + "key<x'" + DBCommon::VectorToHexString(SQLiteUtils::GetPrefixKeyUpperBound(prefixKey_)) +
+            "')";
     }
 
     if (!keys_.empty()) {
@@ -1480,7 +1483,7 @@ void SqliteQueryHelper::AppendKvQueryObjectOnSql(CloudWaterType mode, std::strin
         return;
     }
     if (hasPrefixKey_) {
-        sql += " AND key >= ? AND key <= ? ";
+        sql += " AND key >= ? AND key < ? ";
     }
 }
 
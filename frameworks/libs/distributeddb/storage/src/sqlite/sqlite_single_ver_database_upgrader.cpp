@@ -66,6 +66,11 @@ namespace {
     const constexpr char *CREATE_SYNC_TABLE_INDEX_SQL_DEV_INDEX =
         "CREATE INDEX IF NOT EXISTS dev_index ON sync_data (device);";
 
+    const constexpr char *DROP_SYNC_TABLE_INDEX_SQL_DEV_INDEX = "DROP INDEX IF EXISTS dev_index;";
+
+    const constexpr char *CHECK_DEV_INDEX_SQL =
+        "SELECT COUNT(*) FROM sqlite_master WHERE type='index' AND name='dev_index';";
+
     const constexpr char *CREATE_SYNC_TABLE_INDEX_SQL_LOCAL_HASHKEY_INDEX =
         "CREATE INDEX IF NOT EXISTS local_hashkey_index ON local_data (hash_key);";
 
@@ -84,7 +89,9 @@ SQLiteSingleVerDatabaseUpgrader::SQLiteSingleVerDatabaseUpgrader(sqlite3 *db,
       secOpt_(secopt),
       isMemDB_(isMemDb),
       isMetaUpgrade_(false),
-      isMigrateMetaDb_(false)
+      isMigrateMetaDb_(false),
+      isReducedSyncIndex_(false),
+      isDevIndexMatched_(true)
 {
 }
 
@@ -190,7 +197,34 @@ void SQLiteSingleVerDatabaseUpgrader::SetUpgradeSqls(int version, std::vector<st
         if (isMigrateMetaDb_) {
             sqls.emplace_back(CREATE_META_TABLE_SQL);
         }
+        // The index layout follows the open option, only a store opened with the other option than last time
+        // drops or recreates dev_index, see CheckDevIndexMatched.
+        if (!isDevIndexMatched_) {
+            sqls.emplace_back(isReducedSyncIndex_ ? DROP_SYNC_TABLE_INDEX_SQL_DEV_INDEX :
+                CREATE_SYNC_TABLE_INDEX_SQL_DEV_INDEX);
+        }
+    }
+}
+
+int SQLiteSingleVerDatabaseUpgrader::CheckDevIndexMatched()
+{
+    sqlite3_stmt *stmt = nullptr;
+    int errCode = SQLiteUtils::GetStatement(db_, CHECK_DEV_INDEX_SQL, stmt);
+    if (errCode != E_OK) {
+        LOGE("[SqlSingleUp] Get check dev index statement failed:%d", errCode);
+        return errCode;
     }
+    errCode = SQLiteUtils::StepWithRetry(stmt);
+    if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_ROW)) {
+        bool isDevIndexExist = (sqlite3_column_int(stmt, 0) > 0);
+        isDevIndexMatched_ = (isDevIndexExist != isReducedSyncIndex_);
+        errCode = E_OK;
+    } else {
+        LOGE("[SqlSingleUp] Check dev index failed:%d", errCode);
+    }
+    int ret = E_OK;
+    SQLiteUtils::ResetStatement(stmt, true, ret);
+    return errCode != E_OK ? errCode : ret;
 }
 
 int SQLiteSingleVerDatabaseUpgrader::UpgradeFromDatabaseVersion(int version)
@@ -199,6 +233,12 @@ int SQLiteSingleVerDatabaseUpgrader::UpgradeFromDatabaseVersion(int version)
     bool isCreateUpgradeFile = false;
     LOGI("[SqlUp] meta[%d] label[%d] flag[%d] ver[%d]",
         isMetaUpgrade_, secOpt_.securityLabel, secOpt_.securityFlag, version);
+    if (version != 0) {
+        int errCode = CheckDevIndexMatched();
+        if (errCode != E_OK) {
+            return errCode;
+        }
+    }
     SetUpgradeSqls(version, sqls, isCreateUpgradeFile);
     for (const auto &item : sqls) {
         int errCode = SQLiteUtils::ExecuteRawSQL(db_, item);
@@ -269,6 +309,11 @@ void SQLiteSingleVerDatabaseUpgrader::SetSubdir(const std::string &subDir)
     subDir_ = subDir;
 }
 
+void SQLiteSingleVerDatabaseUpgrader::SetReducedSyncIndex(bool isReducedSyncIndex)
+{
+    isReducedSyncIndex_ = isReducedSyncIndex;
+}
+
 int SQLiteSingleVerDatabaseUpgrader::SetPathSecOptWithCheck(const std::string &path, const SecurityOption &secOption,
     const std::string &dbStore, bool isWithChecked)
 {
@@ -472,7 +517,6 @@ void SQLiteSingleVerDatabaseUpgrader::SetCreateSql(std::vector<std::string> &sql
             CREATE_SYNC_TABLE_SQL,
             CREATE_SYNC_TABLE_INDEX_SQL_KEY_INDEX,
             CREATE_SYNC_TABLE_INDEX_SQL_TIME_INDEX,
-            CREATE_SYNC_TABLE_INDEX_SQL_DEV_INDEX,
             CREATE_SYNC_TABLE_INDEX_SQL_LOCAL_HASHKEY_INDEX
         };
     } else {
@@ -482,9 +526,11 @@ void SQLiteSingleVerDatabaseUpgrader::SetCreateSql(std::vector<std::string> &sql
             CREATE_SYNC_TABLE_SQL,
             CREATE_SYNC_TABLE_INDEX_SQL_KEY_INDEX,
             CREATE_SYNC_TABLE_INDEX_SQL_TIME_INDEX,
-            CREATE_SYNC_TABLE_INDEX_SQL_DEV_INDEX,
             CREATE_SYNC_TABLE_INDEX_SQL_LOCAL_HASHKEY_INDEX
         };
     }
+    if (!isReducedSyncIndex_) {
+        sql.emplace_back(CREATE_SYNC_TABLE_INDEX_SQL_DEV_INDEX);
+    }
 }
 } // namespace DistributedDB
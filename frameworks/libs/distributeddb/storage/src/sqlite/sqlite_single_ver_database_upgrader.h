@@ -32,6 +32,7 @@ public:
 
     void SetMetaUpgrade(const SecurityOption &currentOpt, const SecurityOption &expectOpt, const std::string &subDir);
     void SetSubdir(const std::string &subDir);
+    void SetReducedSyncIndex(bool isReducedSyncIndex);
     static int SetPathSecOptWithCheck(const std::string &path, const SecurityOption &secOption,
         const std::string &dbStore, bool isWithChecked = false);
     static int SetSecOption(const std::string &path, const SecurityOption &secOption, SecurityOption existedSecOpt,
@@ -45,6 +46,7 @@ protected:
     int SetDatabaseVersion(int version) override;
     int UpgradeFromDatabaseVersion(int version) override;
     void SetUpgradeSqls(int version, std::vector<std::string> &sqls, bool &isCreateUpgradeFile) const;
+    int CheckDevIndexMatched();
     void InitTimeForUpgrade(int version);
     std::pair<int, TimeOffset> GetLocalTimeOffset();
     void UpgradeTime(TimeOffset offset);
@@ -59,6 +61,8 @@ protected:
     bool isMetaUpgrade_;
     std::string subDir_;
     bool isMigrateMetaDb_; // need recreate meta table and migrate data from meta.meta
+    bool isReducedSyncIndex_; // sync_data keeps no dev_index
+    bool isDevIndexMatched_; // existed dev_index matches isReducedSyncIndex_, no need to drop or create it
 };
 } // namespace DistributedDB
 #endif // SQLITE_SINGLE_VER_DATABASE_UPGRADER_H
@@ -44,6 +44,7 @@ namespace {
 
     constexpr int DEVICE_ID_LEN = 32;
     const std::string CREATE_DB_TIME = "createDBTime";
+    const std::string LOCAL_DATA_TIMESTAMP_INITED = "localDataTimestampInited";
 
     // Called when get multiple dev data.
     // deviceID is the device which currently being getting. When getting one dev data, deviceID is "".
@@ -447,7 +448,11 @@ int SQLiteSingleVerNaturalStore::Open(const KvDBProperties &kvDBProp)
         goto ERROR;
     }
 
-    InitialLocalDataTimestamp();
+    if (kvDBProp.GetBoolProp(KvDBProperties::FAST_OPEN, false)) {
+        TriggerToInitialLocalDataTimestamp();
+    } else {
+        InitialLocalDataTimestamp();
+    }
     storageEngine_->UpgradeLocalMetaData();
     isInitialized_ = true;
     isReadOnly_ = isReadOnly;
@@ -536,7 +541,7 @@ int SQLiteSingleVerNaturalStore::GetMetaData(const Key &key, Value &value) const
 
     Timestamp timestamp;
     errCode = handle->GetKvData(SingleVerDataType::META_TYPE, key, value, timestamp);
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
     HeartBeatForLifeCycle();
     return errCode;
 }
@@ -564,7 +569,7 @@ int SQLiteSingleVerNaturalStore::GetMetaDataByPrefixKey(const Key &keyPrefix, st
     }
 
     errCode = handle->GetMetaDataByPrefixKey(keyPrefix, data);
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
     HeartBeatForLifeCycle();
     return errCode;
 }
@@ -588,7 +593,45 @@ int SQLiteSingleVerNaturalStore::PutMetaData(const Key &key, const Value &value,
     }
 
     HeartBeatForLifeCycle();
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
+    return errCode;
+}
+
+// Put multiple meta data records in a transaction.
+int SQLiteSingleVerNaturalStore::PutMetaDataBatch(const std::map<Key, Value> &data)
+{
+    for (const auto &[key, value] : data) {
+        int errCode = SQLiteSingleVerNaturalStore::CheckDataStatus(key, value, false);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+    }
+    int errCode = E_OK;
+    auto handle = GetHandle(true, errCode);
+    if (handle == nullptr) {
+        return errCode;
+    }
+
+    errCode = handle->StartTransaction(TransactType::IMMEDIATE);
+    if (errCode != E_OK) {
+        ReleaseHandle(handle, {});
+        return errCode;
+    }
+    for (const auto &[key, value] : data) {
+        errCode = handle->PutKvData(SingleVerDataType::META_TYPE, key, value, 0, nullptr); // meta doesn't need time.
+        if (errCode != E_OK) {
+            break;
+        }
+    }
+    if (errCode != E_OK) {
+        handle->Rollback();
+        LOGE("[SinStore] PutMetaDataBatch failed, errCode = %d", errCode);
+    } else {
+        errCode = handle->Commit();
+    }
+
+    ReleaseHandle(handle, {});
+    HeartBeatForLifeCycle();
     return errCode;
 }
 
@@ -615,7 +658,7 @@ int SQLiteSingleVerNaturalStore::DeleteMetaData(const std::vector<Key> &keys)
         handle->Commit();
     }
 
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
     HeartBeatForLifeCycle();
     return errCode;
 }
@@ -632,7 +675,7 @@ int SQLiteSingleVerNaturalStore::GetAllMetaKeys(std::vector<Key> &keys) const
     }
 
     errCode = handle->GetAllMetaKeys(keys);
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
     return errCode;
 }
 
@@ -1223,7 +1266,42 @@ void SQLiteSingleVerNaturalStore::ReleaseHandle(SQLiteSingleVerStorageExecutor *
     if (handle == nullptr) {
         return;
     }
+    if (handle->GetWritable() && valueCache_.IsEnabled()) {
+        // The changes made through this handle are unknown, drop all cached values.
+        valueCache_.InvalidateAll();
+    }
+    RecycleHandle(handle);
+}
+
+void SQLiteSingleVerNaturalStore::ReleaseHandle(SQLiteSingleVerStorageExecutor *&handle,
+    const std::vector<Key> &changedKeys) const
+{
+    if (handle == nullptr) {
+        return;
+    }
+    if (valueCache_.IsEnabled()) {
+        valueCache_.Invalidate(changedKeys);
+    }
+    RecycleHandle(handle);
+}
 
+SingleVerValueCache &SQLiteSingleVerNaturalStore::GetValueCache() const
+{
+    return valueCache_;
+}
+
+int SQLiteSingleVerNaturalStore::SetValueCacheMaxSize(int size)
+{
+    if (size < VALUE_CACHE_MAX_SIZE_MIN || size > VALUE_CACHE_MAX_SIZE_MAX) {
+        LOGE("[SingleVerNStore] Invalid value cache size:%d", size);
+        return -E_INVALID_ARGS;
+    }
+    valueCache_.SetCapacity(static_cast<uint64_t>(size) * 1024 * 1024); // 1024 is scale
+    return E_OK;
+}
+
+void SQLiteSingleVerNaturalStore::RecycleHandle(SQLiteSingleVerStorageExecutor *&handle) const
+{
     if (storageEngine_ != nullptr) {
         bool isCorrupted = handle->GetCorruptedStatus();
         StorageExecutor *databaseHandle = handle;
@@ -1381,12 +1459,35 @@ int SQLiteSingleVerNaturalStore::SaveSyncDataToMain(const QueryObject &query, st
     return errCode;
 }
 
+int SQLiteSingleVerNaturalStore::CalcSyncItemsHashKey(const std::vector<DataItem> &dataItems,
+    std::vector<Key> &hashKeys)
+{
+    std::vector<const Key *> keys;
+    keys.reserve(dataItems.size());
+    for (const auto &item : dataItems) {
+        // deleted item and miss query item carry the hash key in key already
+        bool isKeyHashed = ((item.flag & DataItem::DELETE_FLAG) == DataItem::DELETE_FLAG) ||
+            ((item.flag & DataItem::REMOTE_DEVICE_DATA_MISS_QUERY) == DataItem::REMOTE_DEVICE_DATA_MISS_QUERY);
+        keys.push_back((item.neglect || isKeyHashed) ? nullptr : &item.key);
+    }
+    int errCode = DBCommon::CalcValueHashBatch(keys, hashKeys);
+    if (errCode != E_OK) {
+        LOGE("[SQLiteSingleVerNaturalStore] calc hash key of sync items failed:%d", errCode);
+    }
+    return errCode;
+}
+
 // Currently, this function only suitable to be call from sync in insert_record_from_sync procedure
 // Take attention if future coder attempt to call it in other situation procedure
 int SQLiteSingleVerNaturalStore::SaveSyncItems(const QueryObject &query, std::vector<DataItem> &dataItems,
     const DeviceInfo &deviceInfo, Timestamp &maxTimestamp, SingleVerNaturalStoreCommitNotifyData *commitData) const
 {
-    int errCode = E_OK;
+    // calc hash key before get write handle, not to hold the write transaction while calculating
+    std::vector<Key> hashKeys;
+    int errCode = CalcSyncItemsHashKey(dataItems, hashKeys);
+    if (errCode != E_OK) {
+        return errCode;
+    }
     int innerCode = E_OK;
     LOGD("[SQLiteSingleVerNaturalStore::SaveSyncData] Get write handle.");
     SQLiteSingleVerStorageExecutor *handle = GetHandle(true, errCode);
@@ -1408,18 +1509,19 @@ int SQLiteSingleVerNaturalStore::SaveSyncItems(const QueryObject &query, std::ve
     if (errCode != E_OK) {
         goto END;
     }
-    for (auto &item: dataItems) {
+    // Existed records are loaded in batch instead of being searched one by one
+    errCode = handle->StartBatchSavingSyncData(dataItems, hashKeys);
+    for (size_t i = 0; errCode == E_OK && i < dataItems.size(); ++i) {
+        auto &item = dataItems[i];
         if (item.neglect) { // Do not save this record if it is neglected
             continue;
         }
-        errCode = handle->SaveSyncDataItem(item, deviceInfo, maxTimestamp, commitData, true);
-        if (errCode != E_OK && errCode != -E_NOT_FOUND) {
-            break;
+        errCode = handle->SaveSyncDataItem(item, hashKeys[i], deviceInfo, maxTimestamp, commitData, true);
+        if (errCode == -E_NOT_FOUND) {
+            errCode = E_OK;
         }
     }
-    if (errCode == -E_NOT_FOUND) {
-        errCode = E_OK;
-    }
+    errCode = handle->FinishBatchSavingSyncData(errCode);
     innerCode = handle->ResetForSavingData(SingleVerDataType::SYNC_TYPE);
     if (innerCode != E_OK) {
         errCode = innerCode;
@@ -1501,11 +1603,16 @@ int SQLiteSingleVerNaturalStore::InitStorageEngine(const KvDBProperties &kvDBPro
     if (isMemoryMode) {
         poolSize.minWriteNum = 1; // keep at least one connection.
     }
+    if (kvDBProp.GetBoolProp(KvDBProperties::FAST_OPEN, false)) {
+        poolSize.minReadNum = 0; // read handles are created on first use.
+    }
 
     storageEngine_->SetNotifiedCallback(
         [&](int eventType, KvDBCommitNotifyFilterAbleData *committedData) {
             if (eventType == static_cast<int>(
                 SQLiteGeneralNSNotificationEventType::SQLITE_GENERAL_FINISH_MIGRATE_EVENT)) {
+                // cache data were moved into the main db without going through any store handle
+                this->valueCache_.InvalidateAll();
                 return this->TriggerSync(eventType);
             }
             auto commitData = static_cast<SingleVerNaturalStoreCommitNotifyData *>(committedData);
@@ -1686,6 +1793,7 @@ int SQLiteSingleVerNaturalStore::Import(const std::string &filePath, const Ciphe
     errCode = SaveCreateDBTime(); // This step will start syncer
 
 END:
+    valueCache_.InvalidateAll();
     // restore the storage engine and the syncer.
     AbortHandle();
     storageEngine_->Enable(OperatePerm::IMPORT_MONOPOLIZE_PERM);
@@ -1774,6 +1882,7 @@ void SQLiteSingleVerNaturalStore::InitDataBaseOption(const KvDBProperties &kvDBP
     option = {uri, isCreateNecessary, isMemoryDb, createTableSqls, cipherType, passwd, schemaStr, subDir, securityOpt};
     option.conflictReslovePolicy = kvDBProp.GetIntProp(KvDBProperties::CONFLICT_RESOLVE_POLICY, DEFAULT_LAST_WIN);
     option.createDirByStoreIdOnly = kvDBProp.GetBoolProp(KvDBProperties::CREATE_DIR_BY_STORE_ID_ONLY, false);
+    option.isReducedSyncIndex = kvDBProp.GetBoolProp(KvDBProperties::REDUCED_SYNC_INDEX, false);
 }
 
 int SQLiteSingleVerNaturalStore::TransObserverTypeToRegisterFunctionType(
@@ -1866,6 +1975,12 @@ int SQLiteSingleVerNaturalStore::DecideReadOnlyBaseOnSchema(const KvDBProperties
 
 void SQLiteSingleVerNaturalStore::InitialLocalDataTimestamp()
 {
+    // Only the local data upgraded from the old version is without timestamp, no need to scan the table once done.
+    const Key initedKey(LOCAL_DATA_TIMESTAMP_INITED.begin(), LOCAL_DATA_TIMESTAMP_INITED.end());
+    Value initedValue;
+    if (GetMetaData(initedKey, initedValue) == E_OK) {
+        return;
+    }
     Timestamp timestamp = GetCurrentTimestamp();
 
     int errCode = E_OK;
@@ -1875,10 +1990,16 @@ void SQLiteSingleVerNaturalStore::InitialLocalDataTimestamp()
     }
 
     errCode = handle->UpdateLocalDataTimestamp(timestamp);
+    ReleaseHandle(handle);
     if (errCode != E_OK) {
         LOGE("Update the timestamp for local data failed:%d", errCode);
+        return;
+    }
+    DBCommon::StringToVector(std::to_string(timestamp), initedValue);
+    errCode = PutMetaData(initedKey, initedValue, false);
+    if (errCode != E_OK) {
+        LOGW("Save the local data timestamp flag failed:%d", errCode);
     }
-    ReleaseHandle(handle);
 }
 
 const KvDBProperties &SQLiteSingleVerNaturalStore::GetDbProperties() const
@@ -2075,20 +2196,30 @@ int SQLiteSingleVerNaturalStore::RemoveAllSubscribe()
         return errCode;
     }
 
+    Key prefixKey;
+    DBCommon::StringToVector(DBConstant::SUBSCRIBE_QUERY_PREFIX, prefixKey);
+    if (triggers.empty()) {
+        // Nothing to keep consistent with the triggers, a single delete is enough and avoids the write transaction.
+        errCode = handle->DeleteMetaDataByPrefixKey(prefixKey);
+        if (errCode != E_OK) {
+            LOGE("remove all subscribe water mark failed. %d", errCode);
+        }
+        ReleaseHandle(handle);
+        return errCode;
+    }
+
     errCode = handle->StartTransaction(TransactType::IMMEDIATE);
     if (errCode != E_OK) {
         ReleaseHandle(handle);
         return errCode;
     }
 
-    Key prefixKey;
     errCode = handle->RemoveTrigger(triggers);
     if (errCode != E_OK) {
         LOGE("remove all subscribe triggers failed. %d", errCode);
         goto END;
     }
 
-    DBCommon::StringToVector(DBConstant::SUBSCRIBE_QUERY_PREFIX, prefixKey);
     errCode = handle->DeleteMetaDataByPrefixKey(prefixKey);
     if (errCode != E_OK) {
         LOGE("remove all subscribe water mark failed. %d", errCode);
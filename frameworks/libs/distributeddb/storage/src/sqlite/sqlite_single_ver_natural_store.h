@@ -23,6 +23,7 @@
 #include "runtime_context.h"
 #include "single_ver_natural_store.h"
 #include "single_ver_natural_store_commit_notify_data.h"
+#include "single_ver_value_cache.h"
 #include "sqlite_cloud_kv_store.h"
 #include "sqlite_single_ver_continue_token.h"
 #include "sqlite_single_ver_storage_engine.h"
@@ -69,6 +70,9 @@ public:
 
     int PutMetaData(const Key &key, const Value &value, bool isInTransaction) override;
 
+    // Put multiple meta data records in a transaction.
+    int PutMetaDataBatch(const std::map<Key, Value> &data) override;
+
     // Delete multiple meta data records in a transaction.
     int DeleteMetaData(const std::vector<Key> &keys) override;
     // Delete multiple meta data records with key prefix in a transaction.
@@ -125,6 +129,13 @@ public:
 
     void ReleaseHandle(SQLiteSingleVerStorageExecutor *&handle) const;
 
+    // Release a write handle whose changes on sync data are limited to the given keys, empty if only meta changed.
+    void ReleaseHandle(SQLiteSingleVerStorageExecutor *&handle, const std::vector<Key> &changedKeys) const;
+
+    SingleVerValueCache &GetValueCache() const;
+
+    int SetValueCacheMaxSize(int size);
+
     int TransObserverTypeToRegisterFunctionType(int observerType, RegisterFuncType &type) const override;
 
     int TransConflictTypeToRegisterFunctionType(int conflictType, RegisterFuncType &type) const override;
@@ -277,6 +288,8 @@ private:
 
     void InitialLocalDataTimestamp();
 
+    void TriggerToInitialLocalDataTimestamp();
+
     int GetSchema(SchemaObject &schema) const;
 
     static void InitDataBaseOption(const KvDBProperties &kvDBProp, OpenDbProperties &option);
@@ -305,6 +318,8 @@ private:
 
     int SaveSyncDataToMain(const QueryObject &query, std::vector<DataItem> &dataItems, const DeviceInfo &deviceInfo);
 
+    static int CalcSyncItemsHashKey(const std::vector<DataItem> &dataItems, std::vector<Key> &hashKeys);
+
     // Currently, this function only suitable to be call from sync in insert_record_from_sync procedure
     // Take attention if future coder attempt to call it in other situation procedure
     int SaveSyncItems(const QueryObject& query, std::vector<DataItem> &dataItems, const DeviceInfo &deviceInfo,
@@ -338,6 +353,8 @@ private:
 
     void GetAndResizeLocalIdentity(std::string &outTarget) const;
 
+    void RecycleHandle(SQLiteSingleVerStorageExecutor *&handle) const;
+
     DECLARE_OBJECT_TAG(SQLiteSingleVerNaturalStore);
 
     mutable std::shared_mutex engineMutex_;
@@ -370,6 +387,8 @@ private:
 #endif
 
     Timestamp lastLocalSysTime_ = 0ULL;
+
+    mutable SingleVerValueCache valueCache_;
 };
 } // namespace DistributedDB
 #endif // SQLITE_SINGLE_VER_NATURAL_STORE_H
@@ -50,7 +50,8 @@ SQLiteSingleVerNaturalStoreConnection::SQLiteSingleVerNaturalStoreConnection(SQL
       localCommittedData_(nullptr),
       transactionExeFlag_(false),
       conflictListener_(nullptr),
-      writeHandle_(nullptr)
+      writeHandle_(nullptr),
+      isChangedSyncKeysTracked_(false)
 {}
 
 SQLiteSingleVerNaturalStoreConnection::~SQLiteSingleVerNaturalStoreConnection()
@@ -114,6 +115,17 @@ int SQLiteSingleVerNaturalStoreConnection::Get(const IOption &option, const Key
         }
     }
 
+    SingleVerValueCache *valueCache = GetValueCache(dataType);
+    uint64_t generation = 0;
+    if (valueCache != nullptr) {
+        if (valueCache->Get(key, value)) {
+            DBDfxAdapter::FinishTracing();
+            return E_OK;
+        }
+        // must be got before reading the db, see SingleVerValueCache::Put
+        generation = valueCache->GetGeneration();
+    }
+
     SQLiteSingleVerStorageExecutor *handle = GetExecutor(false, errCode);
     if (handle == nullptr) {
         DBDfxAdapter::FinishTracing();
@@ -123,6 +135,9 @@ int SQLiteSingleVerNaturalStoreConnection::Get(const IOption &option, const Key
     Timestamp timestamp;
     errCode = handle->GetKvData(dataType, key, value, timestamp);
     ReleaseExecutor(handle);
+    if (errCode == E_OK && valueCache != nullptr) {
+        valueCache->Put(key, value, generation);
+    }
     DBDfxAdapter::FinishTracing();
     return errCode;
 }
@@ -392,6 +407,10 @@ int SQLiteSingleVerNaturalStoreConnection::PragmaNext(int cmd, void *parameter)
             return SetMaxValueSize(*static_cast<uint32_t *>(parameter));
         case PRAGMA_SET_HIGH_PERFORMANCE_READ_MODE:
             return PragmaSetHighPerformanceReadMode(parameter);
+        case PRAGMA_VALUE_CACHE_MAX_SIZE:
+            return PragmaValueCacheMaxSize(parameter);
+        case PRAGMA_GET_VALUE_CACHE_STATISTICS:
+            return PragmaGetValueCacheStatistics(parameter);
         default:
             // Call Pragma() of super class.
             errCode = SyncAbleKvDBConnection::Pragma(cmd, parameter);
@@ -924,9 +943,18 @@ int SQLiteSingleVerNaturalStoreConnection::PutBatchInner(const IOption &option,
     }
     // check whether sync started to get SystemTime
     naturalStore->WakeUpSyncer();
+    // calc hash key of the whole batch before start transaction
+    std::vector<Key> hashKeys;
+    int errCode = E_OK;
+    if (option.dataType == IOption::SYNC_DATA) {
+        errCode = CalcEntriesHashKey(entries, hashKeys);
+        if (errCode != E_OK) {
+            DBDfxAdapter::FinishTracing();
+            return errCode;
+        }
+    }
     std::lock_guard<std::mutex> lock(transactionMutex_);
     bool isAuto = false;
-    int errCode = E_OK;
     if (writeHandle_ == nullptr) {
         isAuto = true;
         errCode = StartTransactionInner(TransactType::IMMEDIATE);
@@ -942,7 +970,8 @@ int SQLiteSingleVerNaturalStoreConnection::PutBatchInner(const IOption &option,
     }
 
     if (option.dataType == IOption::SYNC_DATA) {
-        errCode = SaveSyncEntries(entries);
+        RecordChangedSyncKeys(entries);
+        errCode = SaveSyncEntries(entries, hashKeys);
     } else {
         errCode = SaveLocalEntries(entries);
     }
@@ -1000,6 +1029,7 @@ int SQLiteSingleVerNaturalStoreConnection::DeleteBatchInner(const IOption &optio
     }
 
     if (option.dataType == IOption::SYNC_DATA) {
+        RecordChangedSyncKeys(keys);
         errCode = DeleteSyncEntries(keys);
     } else {
         errCode = DeleteLocalEntries(keys);
@@ -1020,11 +1050,27 @@ int SQLiteSingleVerNaturalStoreConnection::DeleteBatchInner(const IOption &optio
     return errCode;
 }
 
-int SQLiteSingleVerNaturalStoreConnection::SaveSyncEntries(const std::vector<Entry> &entries)
+int SQLiteSingleVerNaturalStoreConnection::CalcEntriesHashKey(const std::vector<Entry> &entries,
+    std::vector<Key> &hashKeys)
 {
-    int errCode = E_OK;
+    std::vector<const Key *> keys;
+    keys.reserve(entries.size());
     for (const auto &entry : entries) {
-        errCode = SaveEntry(entry, false);
+        keys.push_back(&entry.key);
+    }
+    int errCode = DBCommon::CalcValueHashBatch(keys, hashKeys);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinCon] calc hash key of entries failed:%d", errCode);
+    }
+    return errCode;
+}
+
+int SQLiteSingleVerNaturalStoreConnection::SaveSyncEntries(const std::vector<Entry> &entries,
+    const std::vector<Key> &hashKeys)
+{
+    int errCode = E_OK;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        errCode = SaveEntry(entries[i], false, 0, (i < hashKeys.size()) ? hashKeys[i] : Key());
         if (errCode != E_OK) {
             break;
         }
@@ -1046,10 +1092,20 @@ int SQLiteSingleVerNaturalStoreConnection::SaveLocalEntries(const std::vector<En
 
 int SQLiteSingleVerNaturalStoreConnection::DeleteSyncEntries(const std::vector<Key> &keys)
 {
-    int errCode = E_OK;
+    std::vector<const Key *> keyPtrs;
+    keyPtrs.reserve(keys.size());
     for (const auto &key : keys) {
+        keyPtrs.push_back(&key);
+    }
+    std::vector<Key> hashKeys;
+    int errCode = DBCommon::CalcValueHashBatch(keyPtrs, hashKeys);
+    if (errCode != E_OK) {
+        LOGE("[DeleteSyncEntries] Calc hash key err:%d", errCode);
+        return errCode;
+    }
+    for (auto &hashKey : hashKeys) {
         Entry entry;
-        DBCommon::CalcValueHash(key, entry.key);
+        entry.key = std::move(hashKey);
         errCode = SaveEntry(entry, true);
         if ((errCode != E_OK) && (errCode != -E_NOT_FOUND)) {
             LOGE("[DeleteSyncEntries] Delete data err:%d", errCode);
@@ -1076,7 +1132,8 @@ int SQLiteSingleVerNaturalStoreConnection::DeleteLocalEntries(const std::vector<
 // This function currently only be called in local procedure to change sync_data table, do not use in sync procedure.
 // It will check and amend value when need if it is a schema database. return error if some value disagree with the
 // schema. But in sync procedure, we just neglect the value that disagree with schema.
-int SQLiteSingleVerNaturalStoreConnection::SaveEntry(const Entry &entry, bool isDelete, Timestamp timestamp)
+int SQLiteSingleVerNaturalStoreConnection::SaveEntry(const Entry &entry, bool isDelete, Timestamp timestamp,
+    const Key &hashKey)
 {
     SQLiteSingleVerNaturalStore *naturalStore = GetDB<SQLiteSingleVerNaturalStore>();
     if (naturalStore == nullptr) {
@@ -1101,7 +1158,7 @@ int SQLiteSingleVerNaturalStoreConnection::SaveEntry(const Entry &entry, bool is
         uint64_t recordVersion = naturalStore->GetCacheRecordVersion();
         return SaveEntryInCacheMode(dataItem, recordVersion);
     } else {
-        return SaveEntryNormally(dataItem);
+        return SaveEntryNormally(dataItem, hashKey);
     }
 }
 
@@ -1157,7 +1214,7 @@ int SQLiteSingleVerNaturalStoreConnection::SaveLocalItemInCacheMode(const LocalD
     return errCode;
 }
 
-int SQLiteSingleVerNaturalStoreConnection::SaveEntryNormally(DataItem &dataItem)
+int SQLiteSingleVerNaturalStoreConnection::SaveEntryNormally(DataItem &dataItem, const Key &hashKey)
 {
     int errCode = writeHandle_->PrepareForSavingData(SingleVerDataType::SYNC_TYPE);
     if (errCode != E_OK) {
@@ -1167,7 +1224,7 @@ int SQLiteSingleVerNaturalStoreConnection::SaveEntryNormally(DataItem &dataItem)
 
     Timestamp maxTimestamp = 0;
     DeviceInfo deviceInfo = {true, ""};
-    errCode = writeHandle_->SaveSyncDataItem(dataItem, deviceInfo, maxTimestamp, committedData_);
+    errCode = writeHandle_->SaveSyncDataItem(dataItem, hashKey, deviceInfo, maxTimestamp, committedData_, true);
     if (errCode == E_OK) {
         if (maxTimestamp > currentMaxTimestamp_) {
             currentMaxTimestamp_ = maxTimestamp;
@@ -1342,6 +1399,10 @@ void SQLiteSingleVerNaturalStoreConnection::CommitAndReleaseNotifyData(
 
 int SQLiteSingleVerNaturalStoreConnection::StartTransactionInner(TransactType transType)
 {
+    // Only track the changed keys while the value cache enabled, otherwise the whole cache would be dropped.
+    SingleVerValueCache *valueCache = GetValueCache(SingleVerDataType::SYNC_TYPE);
+    isChangedSyncKeysTracked_ = (valueCache != nullptr);
+    changedSyncKeys_.clear();
     if (IsExtendedCacheDBMode()) {
         return StartTransactionInCacheMode(transType);
     } else {
@@ -1444,7 +1505,7 @@ int SQLiteSingleVerNaturalStoreConnection::CommitInner(SingleVerNaturalStoreComm
     bool isCacheOrMigrating = IsExtendedCacheDBMode();
 
     int errCode = writeHandle_->Commit();
-    ReleaseExecutor(writeHandle_);
+    ReleaseCommittedExecutor(writeHandle_);
     transactionEntryLen_ = 0;
 
     if (!isCacheOrMigrating) {
@@ -1521,6 +1582,50 @@ void SQLiteSingleVerNaturalStoreConnection::ReleaseExecutor(SQLiteSingleVerStora
     }
 }
 
+void SQLiteSingleVerNaturalStoreConnection::ReleaseCommittedExecutor(SQLiteSingleVerStorageExecutor *&executor)
+{
+    if (!isChangedSyncKeysTracked_) {
+        ReleaseExecutor(executor);
+        return;
+    }
+    kvDB_->ReEnableConnection(OperatePerm::NORMAL_WRITE);
+    SQLiteSingleVerNaturalStore *naturalStore = GetDB<SQLiteSingleVerNaturalStore>();
+    if (naturalStore != nullptr) {
+        naturalStore->ReleaseHandle(executor, changedSyncKeys_);
+    }
+    changedSyncKeys_.clear();
+    isChangedSyncKeysTracked_ = false;
+}
+
+SingleVerValueCache *SQLiteSingleVerNaturalStoreConnection::GetValueCache(SingleVerDataType dataType) const
+{
+    if (dataType != SingleVerDataType::SYNC_TYPE) {
+        return nullptr;
+    }
+    SQLiteSingleVerNaturalStore *naturalStore = GetDB<SQLiteSingleVerNaturalStore>();
+    if (naturalStore == nullptr || !naturalStore->GetValueCache().IsEnabled()) {
+        return nullptr;
+    }
+    return &naturalStore->GetValueCache();
+}
+
+void SQLiteSingleVerNaturalStoreConnection::RecordChangedSyncKeys(const std::vector<Key> &keys)
+{
+    if (isChangedSyncKeysTracked_) {
+        changedSyncKeys_.insert(changedSyncKeys_.end(), keys.begin(), keys.end());
+    }
+}
+
+void SQLiteSingleVerNaturalStoreConnection::RecordChangedSyncKeys(const std::vector<Entry> &entries)
+{
+    if (!isChangedSyncKeysTracked_) {
+        return;
+    }
+    for (const auto &entry : entries) {
+        changedSyncKeys_.push_back(entry.key);
+    }
+}
+
 int SQLiteSingleVerNaturalStoreConnection::PublishLocal(const PragmaPublishInfo *info)
 {
     SingleVerNaturalStoreCommitNotifyData *committedData = nullptr;
@@ -1557,6 +1662,7 @@ int SQLiteSingleVerNaturalStoreConnection::PublishLocal(const PragmaPublishInfo
         if (errCode != E_OK) {
             return errCode;
         }
+        isChangedSyncKeysTracked_ = false; // sync data changed by publish is not recorded by key
 
         SingleVerNaturalStoreCommitNotifyData *innerCommittedData = nullptr;
         if (info->deleteLocal) {
@@ -1690,6 +1796,7 @@ int SQLiteSingleVerNaturalStoreConnection::UnpublishToLocal(const Key &key, bool
     if (errCode != E_OK) {
         return errCode;
     }
+    isChangedSyncKeysTracked_ = false; // sync data changed by unpublish is not recorded by key
 
     Key hashKey;
     int innerErrCode = E_OK;
@@ -1860,7 +1967,8 @@ int SQLiteSingleVerNaturalStoreConnection::PragmaResultSetCacheMode(PragmaData i
         return -E_INVALID_ARGS;
     }
     auto mode = *(static_cast<ResultSetCacheMode *>(inMode));
-    if (mode != ResultSetCacheMode::CACHE_FULL_ENTRY && mode != ResultSetCacheMode::CACHE_ENTRY_ID_ONLY) {
+    if (mode != ResultSetCacheMode::CACHE_FULL_ENTRY && mode != ResultSetCacheMode::CACHE_ENTRY_ID_ONLY &&
+        mode != ResultSetCacheMode::CACHE_ENTRY_PAGED) {
         return -E_INVALID_ARGS;
     }
     cacheModeForNewResultSet_.store(mode);
@@ -1880,6 +1988,31 @@ int SQLiteSingleVerNaturalStoreConnection::PragmaResultSetCacheMaxSize(PragmaDat
     return E_OK;
 }
 
+int SQLiteSingleVerNaturalStoreConnection::PragmaValueCacheMaxSize(PragmaData inSize)
+{
+    if (inSize == nullptr) {
+        return -E_INVALID_ARGS;
+    }
+    SQLiteSingleVerNaturalStore *naturalStore = GetDB<SQLiteSingleVerNaturalStore>();
+    if (naturalStore == nullptr) {
+        return -E_INVALID_DB;
+    }
+    return naturalStore->SetValueCacheMaxSize(*(static_cast<int *>(inSize)));
+}
+
+int SQLiteSingleVerNaturalStoreConnection::PragmaGetValueCacheStatistics(PragmaData statistics) const
+{
+    if (statistics == nullptr) {
+        return -E_INVALID_ARGS;
+    }
+    SQLiteSingleVerNaturalStore *naturalStore = GetDB<SQLiteSingleVerNaturalStore>();
+    if (naturalStore == nullptr) {
+        return -E_INVALID_DB;
+    }
+    naturalStore->GetValueCache().GetStatistics(*(static_cast<ValueCacheStatistics *>(statistics)));
+    return E_OK;
+}
+
 int SQLiteSingleVerNaturalStoreConnection::PragmaSetHighPerformanceReadMode(void *parameter)
 {
     if (parameter == nullptr) {
@@ -2016,6 +2149,7 @@ int SQLiteSingleVerNaturalStoreConnection::UpdateKey(const DistributedDB::Update
         std::lock_guard<std::mutex> lock(transactionMutex_);
         if (writeHandle_ != nullptr) {
             LOGD("[Connection] Transaction started already.");
+            isChangedSyncKeysTracked_ = false; // keys changed by callback are unknown
             errCode = writeHandle_->UpdateKey(callback);
             return errCode;
         }
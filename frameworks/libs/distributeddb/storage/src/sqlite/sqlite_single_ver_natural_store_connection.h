@@ -18,6 +18,7 @@
 #include <atomic>
 #include "single_ver_natural_store_connection.h"
 #include "sync_able_kvdb_connection.h"
+#include "single_ver_value_cache.h"
 #include "sqlite_single_ver_storage_executor.h"
 #include "db_types.h"
 #include "runtime_context.h"
@@ -137,12 +138,15 @@ private:
     int PutBatchInner(const IOption &option, const std::vector<Entry> &entries) override;
     int DeleteBatchInner(const IOption &option, const std::vector<Key> &keys) override;
 
-    int SaveSyncEntries(const std::vector<Entry> &entries);
+    static int CalcEntriesHashKey(const std::vector<Entry> &entries, std::vector<Key> &hashKeys);
+
+    int SaveSyncEntries(const std::vector<Entry> &entries, const std::vector<Key> &hashKeys);
     int SaveLocalEntries(const std::vector<Entry> &entries);
     int DeleteSyncEntries(const std::vector<Key> &keys);
     int DeleteLocalEntries(const std::vector<Key> &keys);
 
-    int SaveEntry(const Entry &entry, bool isDelete, Timestamp timestamp = 0);
+    // hashKey is the hash of entry.key if caller has calculated it, or empty
+    int SaveEntry(const Entry &entry, bool isDelete, Timestamp timestamp = 0, const Key &hashKey = {});
 
     int CheckDataStatus(const Key &key, const Value &value, bool isDelete) const;
 
@@ -214,6 +218,9 @@ private:
 
     void ReleaseExecutor(SQLiteSingleVerStorageExecutor *&executor) const;
 
+    // Release the committed write handle, only invalidate the cached values of the changed sync keys if tracked.
+    void ReleaseCommittedExecutor(SQLiteSingleVerStorageExecutor *&executor);
+
     int PragmaSetAutoLifeCycle(const uint32_t *lifeTime);
     void InitConflictNotifiedFlag();
     void AddConflictNotifierCount(int target);
@@ -221,6 +228,8 @@ private:
 
     int PragmaResultSetCacheMode(PragmaData inMode);
     int PragmaResultSetCacheMaxSize(PragmaData inSize);
+    int PragmaValueCacheMaxSize(PragmaData inSize);
+    int PragmaGetValueCacheStatistics(PragmaData statistics) const;
 
     // use for getkvstore migrating cache data
     int PragmaTriggerToMigrateData(const SecurityOption &secOption) const;
@@ -229,7 +238,7 @@ private:
     int SaveLocalEntry(const Entry &entry, bool isDelete);
     int SaveLocalItem(const LocalDataItem &dataItem) const;
     int SaveLocalItemInCacheMode(const LocalDataItem &dataItem) const;
-    int SaveEntryNormally(DataItem &dataItem);
+    int SaveEntryNormally(DataItem &dataItem, const Key &hashKey = {});
     int SaveEntryInCacheMode(DataItem &dataItem, uint64_t recordVersion);
 
     int StartTransactionInCacheMode(TransactType transType = TransactType::DEFERRED);
@@ -248,6 +257,10 @@ private:
     bool CheckLogOverLimit(SQLiteSingleVerStorageExecutor *executor) const;
     int CalcHashDevID(PragmaDeviceIdentifier &pragmaDev);
 
+    SingleVerValueCache *GetValueCache(SingleVerDataType dataType) const;
+    void RecordChangedSyncKeys(const std::vector<Key> &keys);
+    void RecordChangedSyncKeys(const std::vector<Entry> &entries);
+
     int GetEntriesInner(bool isGetValue, const IOption &option,
         const Key &keyPrefix, std::vector<Entry> &entries) const;
 
@@ -274,6 +287,9 @@ private:
 
     NotificationChain::Listener *conflictListener_;
     SQLiteSingleVerStorageExecutor *writeHandle_; // only existed while in transaction.
+    // sync keys changed in the current transaction, used to invalidate the value cache of the store
+    std::vector<Key> changedSyncKeys_;
+    bool isChangedSyncKeysTracked_;
     mutable std::set<IKvDBResultSet *> kvDbResultSets_;
     std::mutex conflictMutex_;
     std::mutex rekeyMutex_;
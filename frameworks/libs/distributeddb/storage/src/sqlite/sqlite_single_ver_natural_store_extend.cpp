@@ -167,6 +167,20 @@ int SQLiteSingleVerNaturalStore::TriggerToMigrateData() const
     return errCode;
 }
 
+void SQLiteSingleVerNaturalStore::TriggerToInitialLocalDataTimestamp()
+{
+    RefObject::IncObjRef(this);
+    int errCode = RuntimeContext::GetInstance()->ScheduleTask([this]() {
+        InitialLocalDataTimestamp();
+        RefObject::DecObjRef(this);
+    });
+    if (errCode != E_OK) {
+        RefObject::DecObjRef(this);
+        LOGW("[SingleVerNStore] Trigger to initial local data timestamp failed : %d, do it now.", errCode);
+        InitialLocalDataTimestamp();
+    }
+}
+
 bool SQLiteSingleVerNaturalStore::IsCacheDBMode() const
 {
     if (storageEngine_ == nullptr) {
@@ -307,7 +321,7 @@ int SQLiteSingleVerNaturalStore::DeleteMetaDataByPrefixKey(const Key &keyPrefix)
         LOGE("[SinStore] DeleteMetaData by prefix key failed, errCode = %d", errCode);
     }
 
-    ReleaseHandle(handle);
+    ReleaseHandle(handle, {});
     HeartBeatForLifeCycle();
     return errCode;
 }
@@ -615,7 +629,7 @@ void SQLiteSingleVerNaturalStore::EnableHandle()
 
 int SQLiteSingleVerNaturalStore::TryHandle() const
 {
-    std::unique_lock<std::shared_mutex> lock(abortHandleMutex_);
+    std::shared_lock<std::shared_mutex> lock(abortHandleMutex_);
     if (abortPerm_ == OperatePerm::RESTART_SYNC_PERM) {
         LOGW("[SingleVerNStore] Restarting sync, handle id[%s] is busy",
             DBCommon::TransferStringToHex(storageEngine_->GetIdentifier()).c_str());
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include "log_print.h"
 #include "db_errno.h"
+#include "runtime_context.h"
 #include "sqlite_single_ver_forward_cursor.h"
 #include "sqlite_single_ver_natural_store.h"
 #include "sqlite_single_ver_storage_executor.h"
@@ -27,16 +28,20 @@ namespace {
     const double MEM_WINDOW_SCALE = 0.5; // set default window size to 2G
     const double DEFAULT_WINDOW_SCALE = 1; // For non-mem db
     const int64_t WINDOW_SIZE_MB_UNIT = 1024 * 1024; // 1024 is scale
+    const uint32_t PAGED_ENTRIES_PER_MB = 128; // entries of one page in CACHE_ENTRY_PAGED mode for each MB
 }
 
 SQLiteSingleVerResultSet::SQLiteSingleVerResultSet(SQLiteSingleVerNaturalStore *kvDB, const Key &keyPrefix,
-    const Option& option) : option_(option), type_(ResultSetType::KEYPREFIX), keyPrefix_(keyPrefix), kvDB_(kvDB) {}
+    const Option& option) : option_(option), cacheMode_(option.cacheMode), type_(ResultSetType::KEYPREFIX),
+      keyPrefix_(keyPrefix), kvDB_(kvDB) {}
 
 SQLiteSingleVerResultSet::SQLiteSingleVerResultSet(SQLiteSingleVerNaturalStore *kvDB, const QueryObject &queryObj,
-    const Option& option) : option_(option), type_(ResultSetType::QUERY), queryObj_(queryObj), kvDB_(kvDB) {}
+    const Option& option) : option_(option), cacheMode_(option.cacheMode), type_(ResultSetType::QUERY),
+      queryObj_(queryObj), kvDB_(kvDB) {}
 
 SQLiteSingleVerResultSet::~SQLiteSingleVerResultSet()
 {
+    WaitPrefetchFinished();
     isOpen_ = false;
     count_ = 0;
     position_ = INIT_POSITION;
@@ -56,13 +61,31 @@ int SQLiteSingleVerResultSet::Open(bool isMemDb)
     if (kvDB_ == nullptr) { // Unlikely
         return -E_INVALID_ARGS;
     }
-    if (option_.cacheMode == ResultSetCacheMode::CACHE_FULL_ENTRY) {
+    cacheMode_ = GetActualCacheMode();
+    if (cacheMode_ == ResultSetCacheMode::CACHE_FULL_ENTRY) {
         return OpenForCacheFullEntryMode(isMemDb);
+    } else if (cacheMode_ == ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        return OpenForCachePagedMode();
     } else {
         return OpenForCacheEntryIdMode();
     }
 }
 
+ResultSetCacheMode SQLiteSingleVerResultSet::GetActualCacheMode()
+{
+    if (option_.cacheMode != ResultSetCacheMode::CACHE_ENTRY_PAGED || type_ == ResultSetType::KEYPREFIX) {
+        return option_.cacheMode;
+    }
+    // The key order of paged mode is only guaranteed the same as the query when it is just a key prefix
+    if (!queryObj_.IsValid() || !queryObj_.IsQueryOnlyByKey() || queryObj_.HasLimit() || queryObj_.HasInKeys() ||
+        queryObj_.HasOrderBy()) {
+        LOGI("[SqlSinResSet][GetCacheMode] Query can not be paged, use entry id mode instead.");
+        return ResultSetCacheMode::CACHE_ENTRY_ID_ONLY;
+    }
+    keyPrefix_ = queryObj_.GetPrefixKey();
+    return ResultSetCacheMode::CACHE_ENTRY_PAGED;
+}
+
 int SQLiteSingleVerResultSet::OpenForCacheFullEntryMode(bool isMemDb)
 {
     if (type_ == ResultSetType::KEYPREFIX) {
@@ -131,10 +154,82 @@ int SQLiteSingleVerResultSet::OpenForCacheEntryIdMode()
     return E_OK;
 }
 
+int SQLiteSingleVerResultSet::OpenForCachePagedMode()
+{
+    int errCode = E_OK;
+    handle_ = kvDB_->GetHandle(false, errCode);
+    if (handle_ == nullptr) {
+        LOGE("[SqlSinResSet][OpenForPaged] Get handle fail, errCode=%d.", errCode);
+        return errCode;
+    }
+    // All pages are read in one read transaction, so the result is consistent as other modes
+    errCode = handle_->OpenResultSetForCachePagedMode();
+    if (errCode == E_OK) {
+        errCode = handle_->GetResultSetPageByKey(keyPrefix_, {}, true, GetPageSize(), pagedEntries_);
+    }
+    if (errCode != E_OK) {
+        LOGE("[SqlSinResSet][OpenForPaged] Open ResultSet fail, errCode=%d.", errCode);
+        handle_->CloseResultSet();
+        kvDB_->ReleaseHandle(handle_);
+        pagedEntries_.clear();
+        return errCode;
+    }
+    count_ = -1;
+    if (pagedEntries_.size() < GetPageSize()) {
+        // The first page contains all result, count is known without another query
+        count_ = static_cast<int>(pagedEntries_.size());
+    }
+    // If no result, then nothing is cached, so the pageStartPosition_ is still INIT_POSITION
+    if (!pagedEntries_.empty()) {
+        pageStartPosition_ = 0;
+    }
+    isOpen_ = true;
+    SchedulePrefetchNextPage();
+    LOGD("[SqlSinResSet][OpenForPaged] Type=%d, CacheMaxSize=%d(MB), Count=%d, Cached=%zu.", static_cast<int>(type_),
+        option_.cacheMaxSize, count_, pagedEntries_.size());
+    return E_OK;
+}
+
+uint32_t SQLiteSingleVerResultSet::GetPageSize() const
+{
+    // cacheMaxSize is within [1,16]
+    return static_cast<uint32_t>(option_.cacheMaxSize) * PAGED_ENTRIES_PER_MB;
+}
+
 int SQLiteSingleVerResultSet::GetCount() const
 {
-    // count_ never changed after ResultSet opened
-    return count_;
+    if (cacheMode_ != ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        // count_ never changed after ResultSet opened
+        return count_;
+    }
+    std::lock_guard<std::mutex> lockGuard(mutex_);
+    if (!isOpen_) {
+        return count_;
+    }
+    int count = 0;
+    int errCode = GetCountForCachePagedMode(count);
+    if (errCode != E_OK) {
+        // count_ is kept not calculated, so the count can be got again next time
+        LOGE("[SqlSinResSet][GetCount] Get count fail, errCode=%d.", errCode);
+        return 0;
+    }
+    return count;
+}
+
+int SQLiteSingleVerResultSet::GetCountForCachePagedMode(int &count) const
+{
+    if (count_ >= 0) {
+        count = count_;
+        return E_OK;
+    }
+    WaitPrefetchFinished();
+    int errCode = handle_->GetResultSetCount(keyPrefix_, count);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinResSet][GetCountForPaged] Get count fail, errCode=%d.", errCode);
+        return errCode;
+    }
+    count_ = count;
+    return E_OK;
 }
 
 int SQLiteSingleVerResultSet::GetPosition() const
@@ -172,7 +267,8 @@ int SQLiteSingleVerResultSet::MoveTo(int position) const
         LOGW("[SqlSinResSet][MoveTo] Target Position=%d invalid.", position);
         return -E_INVALID_ARGS;
     }
-    if (position >= count_) {
+    // count_ is less than 0 when it is not calculated yet in CACHE_ENTRY_PAGED mode
+    if (count_ >= 0 && position >= count_) {
         position_ = count_;
         LOGW("[SqlSinResSet][MoveTo] Target Position=%d Exceed Count=%d.", position, count_);
         return -E_INVALID_ARGS;
@@ -180,8 +276,10 @@ int SQLiteSingleVerResultSet::MoveTo(int position) const
     if (position_ == position) {
         return E_OK;
     }
-    if (option_.cacheMode == ResultSetCacheMode::CACHE_FULL_ENTRY) {
+    if (cacheMode_ == ResultSetCacheMode::CACHE_FULL_ENTRY) {
         return MoveToForCacheFullEntryMode(position);
+    } else if (cacheMode_ == ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        return MoveToForCachePagedMode(position);
     } else {
         return MoveToForCacheEntryIdMode(position);
     }
@@ -211,6 +309,13 @@ bool SQLiteSingleVerResultSet::IsFirst() const
 
 bool SQLiteSingleVerResultSet::IsLast() const
 {
+    if (cacheMode_ == ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        std::lock_guard<std::mutex> lockGuard(mutex_);
+        bool isLast = false;
+        if (isOpen_ && count_ < 0 && IsLastForCachePagedMode(isLast)) {
+            return isLast;
+        }
+    }
     int position = GetPosition();
     int count = GetCount();
     if (count == 0) {
@@ -313,15 +418,177 @@ int SQLiteSingleVerResultSet::MoveToForCacheEntryIdMode(int position) const
     return E_OK;
 }
 
+int SQLiteSingleVerResultSet::MoveToForCachePagedMode(int position) const
+{
+    // The parameter position now is in [0, count_) if count_ is known, pageEndPosition is just after pagedEntries_
+    int pageEndPosition = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+    if (position >= pageStartPosition_ && position < pageEndPosition) {
+        position_ = position;
+        return E_OK;
+    }
+    WaitPrefetchFinished();
+    if (isNextPageReady_ && nextPageStartPosition_ == pageEndPosition && position >= nextPageStartPosition_ &&
+        position < nextPageStartPosition_ + static_cast<int>(nextPageEntries_.size())) {
+        // Sequential move forward, the prefetched next page is what we want
+        pagedEntries_.swap(nextPageEntries_);
+        pageStartPosition_ = nextPageStartPosition_;
+        if (count_ < 0 && pagedEntries_.size() < GetPageSize()) {
+            count_ = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+        }
+        position_ = position;
+        SchedulePrefetchNextPage();
+        return E_OK;
+    }
+    int errCode = LoadPageForCachePagedMode(position);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    pageEndPosition = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+    if (position >= pageEndPosition) {
+        // No more entries after the loaded page, count is known now
+        int count = 0;
+        errCode = GetCountForCachePagedMode(count);
+        if (errCode != E_OK) {
+            position_ = INIT_POSITION;
+            return -E_UNEXPECTED_DATA;
+        }
+        position_ = count;
+        LOGW("[SqlSinResSet][MoveForPaged] Target Position=%d Exceed Count=%d.", position, count);
+        return -E_INVALID_ARGS;
+    }
+    position_ = position;
+    SchedulePrefetchNextPage();
+    return E_OK;
+}
+
+bool SQLiteSingleVerResultSet::IsLastForCachePagedMode(bool &isLast) const
+{
+    // Called with mutex_ locked and count_ not calculated, return false if it can not be judged by the cached pages
+    int cacheIndex = position_ - pageStartPosition_;
+    if (position_ <= INIT_POSITION || cacheIndex < 0 || cacheIndex >= static_cast<int>(pagedEntries_.size())) {
+        return false;
+    }
+    if (cacheIndex < static_cast<int>(pagedEntries_.size()) - 1) {
+        isLast = false; // More entries after the position in current page
+        return true;
+    }
+    WaitPrefetchFinished();
+    int pageEndPosition = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+    if (!isNextPageReady_ || nextPageStartPosition_ != pageEndPosition) {
+        return false;
+    }
+    isLast = nextPageEntries_.empty();
+    if (isLast) {
+        count_ = pageEndPosition;
+    }
+    return true;
+}
+
+int SQLiteSingleVerResultSet::LoadPageForCachePagedMode(int position) const
+{
+    int pageSize = static_cast<int>(GetPageSize());
+    int pageEndPosition = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+    std::vector<Entry> entries;
+    int newPageStartPos = position;
+    bool isReachEnd = false; // A short page loaded forward reaches the end of result
+    int errCode = E_OK;
+    if (!pagedEntries_.empty() && position >= pageEndPosition && position < pageEndPosition + pageSize) {
+        // Move to the adjacent next page, seek by the last key instead of scan the skipped rows by offset
+        newPageStartPos = pageEndPosition;
+        errCode = handle_->GetResultSetPageByKey(keyPrefix_, pagedEntries_.back().key, true, pageSize, entries);
+        isReachEnd = static_cast<int>(entries.size()) < pageSize;
+    } else if (!pagedEntries_.empty() && position < pageStartPosition_ && position >= pageStartPosition_ - pageSize) {
+        // Move to the adjacent previous page, seek backward by the first key
+        errCode = handle_->GetResultSetPageByKey(keyPrefix_, pagedEntries_.front().key, false, pageSize, entries);
+        newPageStartPos = pageStartPosition_ - static_cast<int>(entries.size());
+    } else {
+        if (position < pageStartPosition_) {
+            // Move backward, subtract by 1 to ensure position still in range
+            newPageStartPos = std::max(position - (pageSize - 1), 0);
+        }
+        errCode = handle_->GetResultSetPageByOffset(keyPrefix_, newPageStartPos, pageSize, entries);
+        // An empty page by offset only means the offset is not less than count
+        isReachEnd = !entries.empty() && static_cast<int>(entries.size()) < pageSize;
+    }
+    if (errCode != E_OK) {
+        LOGE("[SqlSinResSet][MoveForPaged] Move to position=%d, Load fail, errCode=%d.", position, errCode);
+        pagedEntries_.clear();
+        pageStartPosition_ = INIT_POSITION;
+        position_ = INIT_POSITION; // Reset Position As MoveForEntry Do
+        return -E_UNEXPECTED_DATA;
+    }
+    if (count_ < 0 && isReachEnd) {
+        count_ = newPageStartPos + static_cast<int>(entries.size());
+    }
+    LOGD("[SqlSinResSet][MoveForPaged] Load: position=%d, pageStartPos=%d, cached=%zu, count=%d.",
+        position, newPageStartPos, entries.size(), count_);
+    isNextPageReady_ = false;
+    nextPageEntries_.clear();
+    pagedEntries_.swap(entries);
+    pageStartPosition_ = pagedEntries_.empty() ? INIT_POSITION : newPageStartPos;
+    return E_OK;
+}
+
+void SQLiteSingleVerResultSet::SchedulePrefetchNextPage() const
+{
+    // Called with mutex_ locked and no prefetch task running
+    isNextPageReady_ = false;
+    nextPageEntries_.clear();
+    int pageEndPosition = pageStartPosition_ + static_cast<int>(pagedEntries_.size());
+    if (pagedEntries_.size() < GetPageSize() || (count_ >= 0 && pageEndPosition >= count_)) {
+        return; // Already the last page
+    }
+    Key lastKey = pagedEntries_.back().key;
+    {
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        isPrefetching_ = true;
+    }
+    int errCode = RuntimeContext::GetInstance()->ScheduleTask([this, lastKey, pageEndPosition]() {
+        std::vector<Entry> entries;
+        int ret = handle_->GetResultSetPageByKey(keyPrefix_, lastKey, true, GetPageSize(), entries);
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        if (ret == E_OK) {
+            nextPageEntries_.swap(entries);
+            nextPageStartPosition_ = pageEndPosition;
+            isNextPageReady_ = true;
+        } else {
+            LOGW("[SqlSinResSet][Prefetch] Prefetch next page fail, errCode=%d.", ret);
+        }
+        isPrefetching_ = false;
+        prefetchCv_.notify_all();
+    });
+    if (errCode != E_OK) {
+        LOGW("[SqlSinResSet][Prefetch] Schedule prefetch task fail, errCode=%d.", errCode);
+        std::lock_guard<std::mutex> prefetchLock(prefetchMutex_);
+        isPrefetching_ = false;
+    }
+}
+
+void SQLiteSingleVerResultSet::WaitPrefetchFinished() const
+{
+    std::unique_lock<std::mutex> prefetchLock(prefetchMutex_);
+    prefetchCv_.wait(prefetchLock, [this]() {
+        return !isPrefetching_;
+    });
+}
+
 int SQLiteSingleVerResultSet::GetEntry(Entry &entry) const
 {
     std::lock_guard<std::mutex> lockGuard(mutex_);
     if (!isOpen_ || count_ == 0) {
         return -E_NO_SUCH_ENTRY;
     }
+    if (cacheMode_ == ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        int cacheIndex = position_ - pageStartPosition_;
+        if (position_ <= INIT_POSITION || cacheIndex < 0 || cacheIndex >= static_cast<int>(pagedEntries_.size())) {
+            return -E_NO_SUCH_ENTRY;
+        }
+        entry = pagedEntries_[cacheIndex];
+        return E_OK;
+    }
     if (position_ > INIT_POSITION && position_ < count_) {
         // If position_ in the valid range, it can be guaranteed that everything is ok without errors
-        if (option_.cacheMode == ResultSetCacheMode::CACHE_FULL_ENTRY) {
+        if (cacheMode_ == ResultSetCacheMode::CACHE_FULL_ENTRY) {
             return window_->GetEntry(entry);
         } else {
             // It can be guaranteed position_ in the range [cacheStartPosition_, cacheEndPosition)
@@ -349,15 +616,17 @@ int SQLiteSingleVerResultSet::Close()
     if (!isOpen_) {
         return E_OK;
     }
-    if (option_.cacheMode == ResultSetCacheMode::CACHE_FULL_ENTRY) {
+    if (cacheMode_ == ResultSetCacheMode::CACHE_FULL_ENTRY) {
         CloseForCacheFullEntryMode();
+    } else if (cacheMode_ == ResultSetCacheMode::CACHE_ENTRY_PAGED) {
+        CloseForCachePagedMode();
     } else {
         CloseForCacheEntryIdMode();
     }
     isOpen_ = false;
     count_ = 0;
     position_ = INIT_POSITION;
-    LOGD("[SqlSinResSet][Close] Done, Type=%d, Mode=%d.", static_cast<int>(type_), static_cast<int>(option_.cacheMode));
+    LOGD("[SqlSinResSet][Close] Done, Type=%d, Mode=%d.", static_cast<int>(type_), static_cast<int>(cacheMode_));
     return E_OK;
 }
 
@@ -382,4 +651,17 @@ void SQLiteSingleVerResultSet::CloseForCacheEntryIdMode()
         kvDB_->ReleaseHandle(handle_);
     }
 }
+
+void SQLiteSingleVerResultSet::CloseForCachePagedMode()
+{
+    WaitPrefetchFinished();
+    pageStartPosition_ = INIT_POSITION;
+    pagedEntries_.clear();
+    isNextPageReady_ = false;
+    nextPageEntries_.clear();
+    if (handle_ != nullptr) {
+        handle_->CloseResultSet();
+        kvDB_->ReleaseHandle(handle_);
+    }
+}
 } // namespace DistributedDB
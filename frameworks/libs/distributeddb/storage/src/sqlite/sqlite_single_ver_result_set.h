@@ -16,6 +16,7 @@
 #ifndef SQLITE_SINGLE_VER_RESULT_SET_H
 #define SQLITE_SINGLE_VER_RESULT_SET_H
 
+#include <condition_variable>
 #include <mutex>
 #include <vector>
 
@@ -82,18 +83,31 @@ public:
 private:
     int OpenForCacheFullEntryMode(bool isMemDb);
     int OpenForCacheEntryIdMode();
+    int OpenForCachePagedMode();
 
     int MoveToForCacheFullEntryMode(int position) const;
     int MoveToForCacheEntryIdMode(int position) const;
+    int MoveToForCachePagedMode(int position) const;
 
     void CloseForCacheFullEntryMode();
     void CloseForCacheEntryIdMode();
+    void CloseForCachePagedMode();
+
+    // Only key prefix result can be paged in key order, other query fall back to CACHE_ENTRY_ID_ONLY mode
+    ResultSetCacheMode GetActualCacheMode();
+    uint32_t GetPageSize() const;
+    int GetCountForCachePagedMode(int &count) const;
+    bool IsLastForCachePagedMode(bool &isLast) const;
+    int LoadPageForCachePagedMode(int position) const;
+    void SchedulePrefetchNextPage() const;
+    void WaitPrefetchFinished() const;
 
     const Option option_;
+    ResultSetCacheMode cacheMode_ = ResultSetCacheMode::CACHE_FULL_ENTRY;
 
-    // Common Part Of Two ResultSet Mode.
+    // Common Part Of All ResultSet Mode.
     bool isOpen_ = false;
-    int count_ = 0;
+    mutable int count_ = 0; // In CACHE_ENTRY_PAGED mode, count is calculated when needed, -1 for not calculated yet
     mutable int position_ = INIT_POSITION; // The position in the overall result
     mutable std::mutex mutex_;
 
@@ -112,6 +126,16 @@ private:
     SQLiteSingleVerStorageExecutor *handle_ = nullptr;
     mutable std::vector<int64_t> cachedRowIds_;
     mutable int cacheStartPosition_ = INIT_POSITION; // The offset of the first cached rowid in all result rowids
+
+    // Cache Paged Mode Using StorageExecutor too, only one page and the prefetched next page is kept in memory.
+    mutable std::vector<Entry> pagedEntries_;
+    mutable int pageStartPosition_ = INIT_POSITION; // The offset of the first cached entry in all result entries
+    mutable std::mutex prefetchMutex_;
+    mutable std::condition_variable prefetchCv_;
+    mutable bool isPrefetching_ = false; // handle_ is used by the prefetch task, should wait before use it
+    mutable bool isNextPageReady_ = false;
+    mutable int nextPageStartPosition_ = INIT_POSITION;
+    mutable std::vector<Entry> nextPageEntries_;
 };
 } // namespace DistributedDB
 
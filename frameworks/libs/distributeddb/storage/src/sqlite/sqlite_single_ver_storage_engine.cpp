@@ -930,6 +930,7 @@ int SQLiteSingleVerStorageEngine::UpgradeInner(sqlite3 *db, const OpenDbProperti
 
     upgrader->SetMetaUpgrade(secOpt, option.securityOpt, option.subdir);
     upgrader->SetSubdir(option.subdir);
+    upgrader->SetReducedSyncIndex(option.isReducedSyncIndex);
     errCode = upgrader->Upgrade();
     if (errCode != E_OK) {
         LOGE("Single ver database upgrade failed:%d", errCode);
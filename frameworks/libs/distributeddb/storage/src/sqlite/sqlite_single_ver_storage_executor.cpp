@@ -20,6 +20,7 @@
 #include "db_constant.h"
 #include "db_common.h"
 #include "db_errno.h"
+#include "hash_identifier_cache.h"
 #include "log_print.h"
 #include "log_table_manager_factory.h"
 #include "parcel.h"
@@ -27,6 +28,7 @@
 #include "runtime_context.h"
 #include "sqlite_meta_executor.h"
 #include "sqlite_single_ver_storage_executor_sql.h"
+#include "sqlite_statement_cache.h"
 
 namespace DistributedDB {
 namespace {
@@ -78,7 +80,9 @@ SQLiteSingleVerStorageExecutor::SQLiteSingleVerStorageExecutor(sqlite3 *dbHandle
       migrateTimeOffset_(0),
       isSyncMigrating_(false),
       conflictResolvePolicy_(DEFAULT_LAST_WIN)
-{}
+{
+    SQLiteStatementCache::GetInstance().RegisterHandle(dbHandle);
+}
 
 SQLiteSingleVerStorageExecutor::SQLiteSingleVerStorageExecutor(sqlite3 *dbHandle, bool writable, bool isMemDb,
     ExecutorState executorState)
@@ -93,7 +97,9 @@ SQLiteSingleVerStorageExecutor::SQLiteSingleVerStorageExecutor(sqlite3 *dbHandle
       migrateTimeOffset_(0),
       isSyncMigrating_(false),
       conflictResolvePolicy_(DEFAULT_LAST_WIN)
-{}
+{
+    SQLiteStatementCache::GetInstance().RegisterHandle(dbHandle);
+}
 
 SQLiteSingleVerStorageExecutor::~SQLiteSingleVerStorageExecutor()
 {
@@ -1187,7 +1193,7 @@ int SQLiteSingleVerStorageExecutor::SaveSyncDataToDatabase(const DataItem &dataI
         return -E_INVALID_ARGS;
     }
 
-    std::string devName = DBCommon::TransferHashString(deviceName);
+    std::string devName = HashIdentifierCache::GetInstance().GetHashString(deviceName);
     int errCode = BindSavedSyncData(statement, dataItem, hashKey, {origDev, devName}, isUpdate);
     if (errCode != E_OK) {
         return errCode;
@@ -1197,7 +1203,9 @@ int SQLiteSingleVerStorageExecutor::SaveSyncDataToDatabase(const DataItem &dataI
     if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_DONE)) {
         errCode = E_OK;
     }
-    if (errCode == E_OK) {
+    if (errCode == E_OK && isBatchSaving_) {
+        pendingCloudFlagKeys_.push_back(hashKey);
+    } else if (errCode == E_OK) {
         errCode = RemoveCloudUploadFlag(hashKey);
     }
     return errCode;
@@ -1215,7 +1223,7 @@ DataOperStatus SQLiteSingleVerStorageExecutor::JudgeSyncSaveType(DataItem &dataI
         } else {
             status.preStatus = DataStatus::EXISTED;
         }
-        std::string deviceName = DBCommon::TransferHashString(deviceInfo.deviceName);
+        std::string deviceName = HashIdentifierCache::GetInstance().GetHashString(deviceInfo.deviceName);
         if (itemGet.writeTimestamp >= dataItem.writeTimestamp) {
             // for multi user mode, no permit to forcewrite
             if (((!deviceName.empty()) && IsFromDataOwner(itemGet, deviceName) && isPermitForceWrite) ||
@@ -1276,7 +1284,11 @@ int SQLiteSingleVerStorageExecutor::PrepareForNotifyConflictAndObserver(DataItem
     const DeviceInfo &deviceInfo, NotifyConflictAndObserverData &notify, bool isPermitForceWrite)
 {
     // Check sava data existed info
-    int errCode = GetSyncDataItemPre(dataItem, notify.getData, notify.hashKey);
+    bool isPrefetched = false;
+    int errCode = GetPrefetchedSyncDataItemPre(dataItem, notify.getData, notify.hashKey, isPrefetched);
+    if (!isPrefetched) {
+        errCode = GetSyncDataItemPre(dataItem, notify.getData, notify.hashKey);
+    }
     if (errCode != E_OK && errCode != -E_NOT_FOUND) {
         LOGD("[SingleVerExe][PrepareForNotifyConflictAndObserver] failed:%d", errCode);
         if (isSyncMigrating_) {
@@ -1314,8 +1326,12 @@ int SQLiteSingleVerStorageExecutor::PrepareForNotifyConflictAndObserver(DataItem
         return ResetSaveSyncStatements(errCode);
     }
 
-    // get key and value from ori database
-    errCode = GetSyncDataItemExt(dataItem, notify.getData, notify.dataStatus);
+    // get key and value from ori database, the prefetched one has got them already
+    if (!isPrefetched) {
+        errCode = GetSyncDataItemExt(dataItem, notify.getData, notify.dataStatus);
+    } else if (notify.dataStatus.preStatus != DataStatus::EXISTED) {
+        notify.getData.value.clear(); // only existed item need origin value
+    }
     if (errCode != E_OK) {
         LOGD("GetSyncDataItemExt failed:%d", errCode);
         if (isSyncMigrating_) {
@@ -1330,9 +1346,17 @@ int SQLiteSingleVerStorageExecutor::PrepareForNotifyConflictAndObserver(DataItem
 
 int SQLiteSingleVerStorageExecutor::SaveSyncDataItem(DataItem &dataItem, const DeviceInfo &deviceInfo,
     Timestamp &maxStamp, SingleVerNaturalStoreCommitNotifyData *committedData, bool isPermitForceWrite)
+{
+    return SaveSyncDataItem(dataItem, {}, deviceInfo, maxStamp, committedData, isPermitForceWrite);
+}
+
+int SQLiteSingleVerStorageExecutor::SaveSyncDataItem(DataItem &dataItem, const Key &hashKey,
+    const DeviceInfo &deviceInfo, Timestamp &maxStamp, SingleVerNaturalStoreCommitNotifyData *committedData,
+    bool isPermitForceWrite)
 {
     NotifyConflictAndObserverData notify = {
-        .committedData = committedData
+        .committedData = committedData,
+        .hashKey = hashKey
     };
 
     int errCode = PrepareForNotifyConflictAndObserver(dataItem, deviceInfo, notify, isPermitForceWrite);
@@ -1515,7 +1539,7 @@ void SQLiteSingleVerStorageExecutor::PutConflictData(const DataItem &itemPut, co
     commitData->InsertConflictedItem(orgItemInfo, true);
 
     // insert conflict entry
-    std::string putDeviceName = DBCommon::TransferHashString(deviceInfo.deviceName);
+    std::string putDeviceName = HashIdentifierCache::GetInstance().GetHashString(deviceInfo.deviceName);
     std::vector<uint8_t> putDevVect(putDeviceName.begin(), putDeviceName.end());
 
     DataItemInfo newItemInfo = {itemPut, deviceInfo.isLocal, putDevVect};
@@ -1538,25 +1562,33 @@ int SQLiteSingleVerStorageExecutor::Reset()
     if (errCode != E_OK) {
         LOGE("Finalize the local resources for saving sync data failed: %d", errCode);
     }
+    isBatchSaving_ = false;
+    prefetchedSyncData_.clear();
+    pendingCloudFlagKeys_.clear();
     return SQLiteStorageExecutor::Reset();
 }
 
 int SQLiteSingleVerStorageExecutor::GetSyncDataItemPre(const DataItem &itemPut, DataItem &itemGet,
     Key &hashKey) const
+{
+    int errCode = GetSyncDataHashKey(itemPut, hashKey);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    return GetSyncDataPreByHashKey(hashKey, itemGet);
+}
+
+int SQLiteSingleVerStorageExecutor::GetSyncDataHashKey(const DataItem &itemPut, Key &hashKey) const
 {
     if (isSyncMigrating_) {
         hashKey = itemPut.hashKey;
     } else if ((itemPut.flag & DataItem::DELETE_FLAG) == DataItem::DELETE_FLAG ||
         ((itemPut.flag & DataItem::REMOTE_DEVICE_DATA_MISS_QUERY) == DataItem::REMOTE_DEVICE_DATA_MISS_QUERY)) {
         hashKey = itemPut.key;
-    } else {
-        int errCode = DBCommon::CalcValueHash(itemPut.key, hashKey);
-        if (errCode != E_OK) {
-            return errCode;
-        }
+    } else if (hashKey.empty()) {
+        return DBCommon::CalcValueHash(itemPut.key, hashKey);
     }
-
-    return GetSyncDataPreByHashKey(hashKey, itemGet);
+    return E_OK;
 }
 
 int SQLiteSingleVerStorageExecutor::GetSyncDataPreByHashKey(const Key &hashKey, DataItem &itemGet) const
@@ -1598,8 +1630,8 @@ int SQLiteSingleVerStorageExecutor::GetSyncDataPreByHashKey(const Key &hashKey,
 int SQLiteSingleVerStorageExecutor::DeleteLocalDataInner(SingleVerNaturalStoreCommitNotifyData *committedData,
     const Key &key, const Value &value)
 {
+    Key hashKey;
     if (committedData != nullptr) {
-        Key hashKey;
         int innerErrCode = DBCommon::CalcValueHash(key, hashKey);
         if (innerErrCode != E_OK) {
             return innerErrCode;
@@ -1628,7 +1660,7 @@ int SQLiteSingleVerStorageExecutor::DeleteLocalDataInner(SingleVerNaturalStoreCo
         if (sqlite3_changes(dbHandle_) > 0) {
             if (committedData != nullptr) {
                 Entry entry = {key, value};
-                committedData->InsertCommittedData(std::move(entry), DataType::DELETE, true);
+                committedData->InsertCommittedData(std::move(entry), DataType::DELETE, true, hashKey);
             } else {
                 LOGE("DeleteLocalKvData failed to do commit notify because of OOM.");
             }
@@ -16,6 +16,9 @@
 #ifndef SQLITE_SINGLE_VER_STORAGE_EXECUTOR_H
 #define SQLITE_SINGLE_VER_STORAGE_EXECUTOR_H
 
+#include <map>
+#include <optional>
+
 #include "macro_utils.h"
 #include "db_types.h"
 #include "query_object.h"
@@ -62,6 +65,10 @@ public:
     int SaveSyncDataItem(DataItem &dataItem, const DeviceInfo &deviceInfo,
         Timestamp &maxStamp, SingleVerNaturalStoreCommitNotifyData *committedData, bool isPermitForceWrite = true);
 
+    // hashKey is the hash of dataItem.key calculated by caller in advance, it will be calculated here if empty.
+    int SaveSyncDataItem(DataItem &dataItem, const Key &hashKey, const DeviceInfo &deviceInfo,
+        Timestamp &maxStamp, SingleVerNaturalStoreCommitNotifyData *committedData, bool isPermitForceWrite);
+
     virtual int DeleteLocalKvData(const Key &key, SingleVerNaturalStoreCommitNotifyData *committedData, Value &value,
         Timestamp &timestamp);
 
@@ -118,6 +125,17 @@ public:
 
     int GetEntryByRowId(int64_t rowId, Entry &entry);
 
+    // Start the read transaction of paged result set, all pages are read in this snapshot
+    int OpenResultSetForCachePagedMode();
+
+    // Get at most limit entries after(isForward) or before the anchor key in key order, entries are in key order
+    int GetResultSetPageByKey(const Key &keyPrefix, const Key &anchorKey, bool isForward, uint32_t limit,
+        std::vector<Entry> &entries);
+
+    int GetResultSetPageByOffset(const Key &keyPrefix, uint32_t offset, uint32_t limit, std::vector<Entry> &entries);
+
+    int GetResultSetCount(const Key &keyPrefix, int &count);
+
     void CloseResultSet();
 
     int StartTransaction(TransactType type);
@@ -133,6 +151,13 @@ public:
 
     int ResetForSavingData(SingleVerDataType type);
 
+    // Load the existed records of the whole batch by hash key at once and delay removing the cloud upload flag to
+    // the end of the batch. Called after PrepareForSavingData(SYNC_TYPE), and the hashKeys is matched to dataItems.
+    int StartBatchSavingSyncData(const std::vector<DataItem> &dataItems, const std::vector<Key> &hashKeys);
+
+    // Return the first error of saving and finishing
+    int FinishBatchSavingSyncData(int errCode);
+
     int Reset() override;
 
     int UpdateLocalDataTimestamp(Timestamp timestamp);
@@ -258,6 +283,8 @@ private:
 
     int GetSyncDataItemPre(const DataItem &itemPut, DataItem &itemGet, Key &hashKey) const;
 
+    int GetSyncDataHashKey(const DataItem &itemPut, Key &hashKey) const;
+
     int GetSyncDataItemExt(const DataItem &dataItem, DataItem &itemGet, const DataOperStatus &dataStatus) const;
 
     int GetSyncDataPreByHashKey(const Key &hashKey, DataItem &itemGet) const;
@@ -293,6 +320,8 @@ private:
 
     int OpenResultSetForCacheRowIdModeCommon(std::vector<int64_t> &rowIdCache, uint32_t cacheLimit, int &count);
 
+    int ResultSetLoadPage(sqlite3_stmt *statement, std::vector<Entry> &entries);
+
     int ResultSetLoadRowIdCache(std::vector<int64_t> &rowIdCache, uint32_t cacheLimit,
         uint32_t cacheStartPos, int &count);
 
@@ -396,6 +425,13 @@ private:
 
     int RemoveCloudUploadFlag(const std::vector<uint8_t> &hashKey);
 
+    int RemoveCloudUploadFlag(const std::vector<Key> &hashKeys);
+
+    int PrefetchSyncDataByHashKeys(const std::vector<Key> &hashKeys);
+
+    // isPrefetched is false when the record is not loaded in batch, then it should be got from db
+    int GetPrefetchedSyncDataItemPre(const DataItem &itemPut, DataItem &itemGet, Key &hashKey, bool &isPrefetched);
+
     bool IsFromDataOwner(const DataItem &itemGet, const std::string &syncDev);
     sqlite3_stmt *getSyncStatement_;
     sqlite3_stmt *getResultRowIdStatement_;
@@ -420,6 +456,12 @@ private:
     bool isSyncMigrating_;
     int conflictResolvePolicy_;
 
+    // Batch saving sync data flag. When the flag is true, prefetchedSyncData_ keeps the records not saved yet in this
+    // batch, nullopt for not existed, and the cloud upload flag of pendingCloudFlagKeys_ is removed when finished.
+    bool isBatchSaving_ = false;
+    std::map<Key, std::optional<DataItem>> prefetchedSyncData_;
+    std::vector<Key> pendingCloudFlagKeys_;
+
     // Record log print count.
     static constexpr uint64_t maxLogTimesPerSecond = 100;
     static constexpr Timestamp printIntervalSeconds = (1000*TimeHelper::MS_TO_100_NS);
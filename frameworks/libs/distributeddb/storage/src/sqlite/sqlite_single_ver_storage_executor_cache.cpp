@@ -21,6 +21,7 @@
 #include "db_constant.h"
 #include "db_common.h"
 #include "db_errno.h"
+#include "hash_identifier_cache.h"
 #include "parcel.h"
 #include "runtime_context.h"
 #include "sqlite_single_ver_storage_executor_sql.h"
@@ -577,7 +578,7 @@ int SQLiteSingleVerStorageExecutor::BindTimestampSyncDataInCacheMode(
 int SQLiteSingleVerStorageExecutor::BindDevSyncDataInCacheMode(sqlite3_stmt *statement,
     const std::string &origDev, const std::string &deviceName) const
 {
-    std::string devName = DBCommon::TransferHashString(deviceName);
+    std::string devName = HashIdentifierCache::GetInstance().GetHashString(deviceName);
     std::vector<uint8_t> devVect(devName.begin(), devName.end());
     int errCode = SQLiteUtils::BindBlobToStatement(statement, BIND_CACHE_SYNC_DEV_INDEX, devVect, true);
     if (errCode != E_OK) {
@@ -34,6 +34,31 @@
 namespace DistributedDB {
 namespace {
 constexpr const char *HWM_HEAD = "naturalbase_cloud_meta_sync_data_";
+constexpr const char *KV_AUX_SYNC_DATA_LOG_TABLE = "naturalbase_kv_aux_sync_data_log";
+constexpr size_t BATCH_HASH_KEY_LIMIT = 100; // Max number of hash key bound in one statement
+
+std::string GetInHashKeysSql(const std::string &sqlHead, size_t count)
+{
+    std::string sql = sqlHead + " WHERE hash_key IN (";
+    for (size_t i = 0; i < count; i++) {
+        sql += "?,";
+    }
+    sql.pop_back();
+    sql += ");";
+    return sql;
+}
+
+int BindHashKeys(sqlite3_stmt *statement, const std::vector<Key> &hashKeys, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++) {
+        int errCode = SQLiteUtils::BindBlobToStatement(statement, static_cast<int>(i - begin + 1), hashKeys[i], false);
+        if (errCode != E_OK) {
+            LOGE("[SingleVerExe] Bind hash key failed:%d", errCode);
+            return errCode;
+        }
+    }
+    return E_OK;
+}
 }
 
 int SQLiteSingleVerStorageExecutor::BindSyncDataTime(sqlite3_stmt *statement, const DataItem &dataItem, bool isUpdate)
@@ -469,7 +494,7 @@ int SQLiteSingleVerStorageExecutor::GetSyncTotalWithQuery(QueryObject &query,
 
 int SQLiteSingleVerStorageExecutor::RemoveCloudUploadFlag(const std::vector<uint8_t> &hashKey)
 {
-    const std::string tableName = "naturalbase_kv_aux_sync_data_log";
+    const std::string tableName = KV_AUX_SYNC_DATA_LOG_TABLE;
     bool isCreate = false;
     int errCode = SQLiteUtils::CheckTableExists(dbHandle_, tableName, isCreate);
     if (errCode != E_OK) {
@@ -502,6 +527,171 @@ int SQLiteSingleVerStorageExecutor::RemoveCloudUploadFlag(const std::vector<uint
     return errCode == E_OK ? ret : errCode;
 }
 
+int SQLiteSingleVerStorageExecutor::RemoveCloudUploadFlag(const std::vector<Key> &hashKeys)
+{
+    bool isCreate = false;
+    int errCode = SQLiteUtils::CheckTableExists(dbHandle_, KV_AUX_SYNC_DATA_LOG_TABLE, isCreate);
+    if (errCode != E_OK || !isCreate) {
+        return errCode;
+    }
+    const std::string sqlHead = std::string("UPDATE ") + KV_AUX_SYNC_DATA_LOG_TABLE + " SET cloud_flag=0";
+    for (size_t begin = 0; begin < hashKeys.size(); begin += BATCH_HASH_KEY_LIMIT) {
+        size_t end = std::min(begin + BATCH_HASH_KEY_LIMIT, hashKeys.size());
+        sqlite3_stmt *stmt = nullptr;
+        errCode = SQLiteUtils::GetStatement(dbHandle_, GetInHashKeysSql(sqlHead, end - begin), stmt);
+        if (errCode != E_OK) {
+            LOGE("[SQLiteSingleVerStorageExecutor] Remove cloud flag in batch get stmt failed %d", errCode);
+            return errCode;
+        }
+        errCode = BindHashKeys(stmt, hashKeys, begin, end);
+        if (errCode == E_OK) {
+            errCode = SQLiteUtils::StepWithRetry(stmt, isMemDb_);
+            if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_DONE)) {
+                errCode = E_OK;
+            }
+        }
+        int ret = E_OK;
+        SQLiteUtils::ResetStatement(stmt, true, ret);
+        errCode = (errCode == E_OK) ? ret : errCode;
+        if (errCode != E_OK) {
+            LOGE("[SQLiteSingleVerStorageExecutor] Remove cloud flag in batch failed %d", errCode);
+            return errCode;
+        }
+    }
+    return E_OK;
+}
+
+int SQLiteSingleVerStorageExecutor::StartBatchSavingSyncData(const std::vector<DataItem> &dataItems,
+    const std::vector<Key> &hashKeys)
+{
+    if (isSyncMigrating_) {
+        return E_OK; // Migrating data has its own hash key, save it one by one
+    }
+    if (dataItems.size() != hashKeys.size()) {
+        return -E_INVALID_ARGS;
+    }
+    std::vector<Key> searchKeys;
+    searchKeys.reserve(dataItems.size());
+    for (size_t i = 0; i < dataItems.size(); ++i) {
+        if (dataItems[i].neglect) {
+            continue;
+        }
+        Key hashKey = hashKeys[i];
+        int errCode = GetSyncDataHashKey(dataItems[i], hashKey);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        searchKeys.push_back(std::move(hashKey));
+    }
+    // Search in the index order, and the duplicate hash key only need once
+    std::sort(searchKeys.begin(), searchKeys.end());
+    searchKeys.erase(std::unique(searchKeys.begin(), searchKeys.end()), searchKeys.end());
+    prefetchedSyncData_.clear();
+    pendingCloudFlagKeys_.clear();
+    int errCode = PrefetchSyncDataByHashKeys(searchKeys);
+    if (errCode != E_OK) {
+        prefetchedSyncData_.clear();
+        return CheckCorruptedStatus(errCode);
+    }
+    isBatchSaving_ = true;
+    return E_OK;
+}
+
+int SQLiteSingleVerStorageExecutor::FinishBatchSavingSyncData(int errCode)
+{
+    if (errCode == E_OK && isBatchSaving_ && !pendingCloudFlagKeys_.empty()) {
+        errCode = RemoveCloudUploadFlag(pendingCloudFlagKeys_);
+    }
+    isBatchSaving_ = false;
+    prefetchedSyncData_.clear();
+    pendingCloudFlagKeys_.clear();
+    return CheckCorruptedStatus(errCode);
+}
+
+int SQLiteSingleVerStorageExecutor::PrefetchSyncDataByHashKeys(const std::vector<Key> &hashKeys)
+{
+    for (const auto &hashKey : hashKeys) {
+        prefetchedSyncData_[hashKey] = std::nullopt;
+    }
+    for (size_t begin = 0; begin < hashKeys.size(); begin += BATCH_HASH_KEY_LIMIT) {
+        size_t end = std::min(begin + BATCH_HASH_KEY_LIMIT, hashKeys.size());
+        sqlite3_stmt *stmt = nullptr;
+        int errCode = SQLiteUtils::GetStatement(dbHandle_, GetInHashKeysSql("SELECT * FROM sync_data", end - begin),
+            stmt);
+        if (errCode != E_OK) {
+            LOGE("[SingleVerExe] Get prefetch sync data stmt failed:%d", errCode);
+            return errCode;
+        }
+        errCode = BindHashKeys(stmt, hashKeys, begin, end);
+        while (errCode == E_OK) {
+            errCode = SQLiteUtils::StepWithRetry(stmt, isMemDb_);
+            if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_DONE)) {
+                errCode = E_OK;
+                break;
+            } else if (errCode != SQLiteUtils::MapSQLiteErrno(SQLITE_ROW)) {
+                break;
+            }
+            DataItem itemGet;
+            itemGet.timestamp = static_cast<Timestamp>(sqlite3_column_int64(stmt, SYNC_RES_TIME_INDEX));
+            itemGet.writeTimestamp = static_cast<Timestamp>(sqlite3_column_int64(stmt, SYNC_RES_W_TIME_INDEX));
+            itemGet.flag = static_cast<uint64_t>(sqlite3_column_int64(stmt, SYNC_RES_FLAG_INDEX));
+            std::vector<uint8_t> devVect;
+            std::vector<uint8_t> origDevVect;
+            Key hashKey;
+            errCode = SQLiteUtils::GetColumnBlobValue(stmt, SYNC_RES_KEY_INDEX, itemGet.key);
+            errCode = (errCode == E_OK) ? SQLiteUtils::GetColumnBlobValue(stmt, SYNC_RES_VAL_INDEX, itemGet.value) :
+                errCode;
+            errCode = (errCode == E_OK) ? SQLiteUtils::GetColumnBlobValue(stmt, SYNC_RES_DEVICE_INDEX, devVect) :
+                errCode;
+            errCode = (errCode == E_OK) ? SQLiteUtils::GetColumnBlobValue(stmt, SYNC_RES_ORI_DEV_INDEX, origDevVect) :
+                errCode;
+            errCode = (errCode == E_OK) ? SQLiteUtils::GetColumnBlobValue(stmt, SYNC_RES_HASH_KEY_INDEX, hashKey) :
+                errCode;
+            if (errCode == E_OK) {
+                itemGet.dev.assign(devVect.begin(), devVect.end());
+                itemGet.origDev.assign(origDevVect.begin(), origDevVect.end());
+                prefetchedSyncData_[hashKey] = std::move(itemGet);
+            }
+        }
+        int ret = E_OK;
+        SQLiteUtils::ResetStatement(stmt, true, ret);
+        errCode = (errCode == E_OK) ? ret : errCode;
+        if (errCode != E_OK) {
+            LOGE("[SingleVerExe] Prefetch sync data failed:%d", errCode);
+            return errCode;
+        }
+    }
+    return E_OK;
+}
+
+int SQLiteSingleVerStorageExecutor::GetPrefetchedSyncDataItemPre(const DataItem &itemPut, DataItem &itemGet,
+    Key &hashKey, bool &isPrefetched)
+{
+    isPrefetched = false;
+    if (!isBatchSaving_ || isSyncMigrating_) {
+        return E_OK;
+    }
+    Key searchKey = hashKey;
+    int errCode = GetSyncDataHashKey(itemPut, searchKey);
+    if (errCode != E_OK) {
+        return E_OK; // Let the normal way handle the error
+    }
+    auto iter = prefetchedSyncData_.find(searchKey);
+    if (iter == prefetchedSyncData_.end()) {
+        return E_OK;
+    }
+    isPrefetched = true;
+    hashKey = std::move(searchKey);
+    errCode = -E_NOT_FOUND;
+    if (iter->second.has_value()) {
+        itemGet = std::move(iter->second.value());
+        errCode = E_OK;
+    }
+    // The record may be changed by this item, so the same hash key in this batch should be got from db
+    prefetchedSyncData_.erase(iter);
+    return errCode;
+}
+
 bool SQLiteSingleVerStorageExecutor::IsFromDataOwner(const DataItem &itemGet, const std::string &syncDev)
 {
     return itemGet.dev == syncDev ||
@@ -582,9 +772,9 @@ int SQLiteSingleVerStorageExecutor::PutKvDataInner(SingleVerDataType type, const
     if (errCode != E_OK) {
         return errCode;
     }
+    Key hashKey;
     if (isLocal && committedData != nullptr) {
         ExistStatus existedStatus = isExisted ? ExistStatus::EXIST : ExistStatus::NONE;
-        Key hashKey;
         int innerErrCode = DBCommon::CalcValueHash(key, hashKey);
         if (innerErrCode != E_OK) {
             return innerErrCode;
@@ -598,7 +788,8 @@ int SQLiteSingleVerStorageExecutor::PutKvDataInner(SingleVerDataType type, const
 
     if (isLocal && committedData != nullptr) {
         Entry entry = {key, value};
-        committedData->InsertCommittedData(std::move(entry), isExisted ? DataType::UPDATE : DataType::INSERT, true);
+        committedData->InsertCommittedData(std::move(entry), isExisted ? DataType::UPDATE : DataType::INSERT, true,
+            hashKey);
     }
     return errCode;
 }
@@ -632,4 +823,139 @@ int SQLiteSingleVerStorageExecutor::RemoveLocalDataByKeyPattern(uint32_t limit,
 
     return SQLiteUtils::ProcessStatementErrCode(statement, true, errCode);
 }
+
+int SQLiteSingleVerStorageExecutor::OpenResultSetForCachePagedMode()
+{
+    if (dbHandle_ == nullptr) {
+        return -E_INVALID_DB;
+    }
+    int errCode = StartTransaction(TransactType::DEFERRED);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinExe][OpenResSetPaged] Start transaction fail, errCode=%d", errCode);
+    }
+    return CheckCorruptedStatus(errCode);
+}
+
+int SQLiteSingleVerStorageExecutor::ResultSetLoadPage(sqlite3_stmt *statement, std::vector<Entry> &entries)
+{
+    int errCode = E_OK;
+    do {
+        errCode = SQLiteUtils::StepWithRetry(statement, isMemDb_);
+        if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_DONE)) {
+            errCode = E_OK;
+            break;
+        }
+        if (errCode != SQLiteUtils::MapSQLiteErrno(SQLITE_ROW)) {
+            LOGE("[SqlSinExe][ResSetLoadPage] Step fail, errCode=%d", errCode);
+            break;
+        }
+        Entry entry;
+        errCode = SQLiteUtils::GetColumnBlobValue(statement, 0, entry.key);
+        if (errCode != E_OK) {
+            break;
+        }
+        errCode = SQLiteUtils::GetColumnBlobValue(statement, 1, entry.value);
+        if (errCode != E_OK) {
+            break;
+        }
+        entries.push_back(std::move(entry));
+    } while (true);
+    if (errCode != E_OK) {
+        entries.clear();
+    }
+    return errCode;
+}
+
+int SQLiteSingleVerStorageExecutor::GetResultSetPageByKey(const Key &keyPrefix, const Key &anchorKey, bool isForward,
+    uint32_t limit, std::vector<Entry> &entries)
+{
+    entries.clear();
+    if (dbHandle_ == nullptr) {
+        return -E_INVALID_DB;
+    }
+    sqlite3_stmt *statement = nullptr;
+    int errCode = SQLiteUtils::GetStatement(dbHandle_,
+        isForward ? SELECT_SYNC_PREFIX_PAGE_AFTER_KEY_SQL : SELECT_SYNC_PREFIX_PAGE_BEFORE_KEY_SQL, statement);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinExe][GetResSetPageByKey] Get statement fail, errCode=%d", errCode);
+        return CheckCorruptedStatus(errCode);
+    }
+    errCode = SQLiteUtils::BindPrefixKey(statement, 1, keyPrefix); // 1st and 2nd is the prefix range
+    if (errCode == E_OK) {
+        errCode = SQLiteUtils::BindBlobToStatement(statement, 3, anchorKey, true); // 3rd is the anchor key
+    }
+    if (errCode == E_OK) {
+        errCode = SQLiteUtils::BindInt64ToStatement(statement, 4, static_cast<int64_t>(limit)); // 4th is the limit
+    }
+    if (errCode == E_OK) {
+        errCode = ResultSetLoadPage(statement, entries);
+    }
+    if (errCode == E_OK && !isForward) {
+        std::reverse(entries.begin(), entries.end());
+    }
+    int ret = E_OK;
+    SQLiteUtils::ResetStatement(statement, true, ret);
+    return CheckCorruptedStatus(errCode != E_OK ? errCode : ret);
+}
+
+int SQLiteSingleVerStorageExecutor::GetResultSetPageByOffset(const Key &keyPrefix, uint32_t offset, uint32_t limit,
+    std::vector<Entry> &entries)
+{
+    entries.clear();
+    if (dbHandle_ == nullptr) {
+        return -E_INVALID_DB;
+    }
+    sqlite3_stmt *statement = nullptr;
+    int errCode = SQLiteUtils::GetStatement(dbHandle_, SELECT_SYNC_PREFIX_PAGE_BY_OFFSET_SQL, statement);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinExe][GetResSetPageByOffset] Get statement fail, errCode=%d", errCode);
+        return CheckCorruptedStatus(errCode);
+    }
+    errCode = SQLiteUtils::BindPrefixKey(statement, 1, keyPrefix); // 1st and 2nd is the prefix range
+    if (errCode == E_OK) {
+        errCode = SQLiteUtils::BindInt64ToStatement(statement, 3, static_cast<int64_t>(limit)); // 3rd is the limit
+    }
+    if (errCode == E_OK) {
+        errCode = SQLiteUtils::BindInt64ToStatement(statement, 4, static_cast<int64_t>(offset)); // 4th is the offset
+    }
+    if (errCode == E_OK) {
+        errCode = ResultSetLoadPage(statement, entries);
+    }
+    int ret = E_OK;
+    SQLiteUtils::ResetStatement(statement, true, ret);
+    return CheckCorruptedStatus(errCode != E_OK ? errCode : ret);
+}
+
+int SQLiteSingleVerStorageExecutor::GetResultSetCount(const Key &keyPrefix, int &count)
+{
+    count = 0;
+    if (dbHandle_ == nullptr) {
+        return -E_INVALID_DB;
+    }
+    sqlite3_stmt *statement = nullptr;
+    int errCode = SQLiteUtils::GetStatement(dbHandle_, SELECT_COUNT_SYNC_PREFIX_SQL, statement);
+    if (errCode != E_OK) {
+        LOGE("[SqlSinExe][GetResSetCount] Get statement fail, errCode=%d", errCode);
+        return CheckCorruptedStatus(errCode);
+    }
+    errCode = SQLiteUtils::BindPrefixKey(statement, 1, keyPrefix); // 1st and 2nd is the prefix range
+    if (errCode == E_OK) {
+        errCode = SQLiteUtils::StepWithRetry(statement, isMemDb_);
+        if (errCode == SQLiteUtils::MapSQLiteErrno(SQLITE_ROW)) {
+            int64_t readCount = sqlite3_column_int64(statement, 0);
+            if (readCount > INT32_MAX) {
+                LOGW("[SqlSinExe][GetResSetCount] total count is beyond the max count");
+                errCode = -E_UNEXPECTED_DATA;
+            } else {
+                count = static_cast<int>(readCount);
+                errCode = E_OK;
+            }
+        } else {
+            errCode = -E_UNEXPECTED_DATA;
+        }
+    }
+    int ret = E_OK;
+    SQLiteUtils::ResetStatement(statement, true, ret);
+    return CheckCorruptedStatus(errCode != E_OK ? errCode : ret);
+}
 } // namespace DistributedDB
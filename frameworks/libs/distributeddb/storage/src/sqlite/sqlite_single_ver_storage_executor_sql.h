@@ -150,23 +150,35 @@ namespace DistributedDB {
         "ORDER BY timestamp ASC;";
 
     constexpr const char *SELECT_SYNC_PREFIX_SQL =
-        "SELECT key, value FROM sync_data WHERE key>=? AND key<=? AND (flag&0x01=0) AND (flag&0x200=0) "
+        "SELECT key, value FROM sync_data WHERE key>=? AND key<? AND (flag&0x01=0) AND (flag&0x200=0) "
         "ORDER BY key ASC;";
 
     constexpr const char *SELECT_SYNC_KEY_PREFIX_SQL =
-        "SELECT key FROM sync_data WHERE key>=? AND key<=? AND (flag&0x01=0) AND (flag&0x200=0) ORDER BY key ASC;";
+        "SELECT key FROM sync_data WHERE key>=? AND key<? AND (flag&0x01=0) AND (flag&0x200=0) ORDER BY key ASC;";
 
     constexpr const char *SELECT_SYNC_ROWID_PREFIX_SQL =
-        "SELECT rowid FROM sync_data WHERE key>=? AND key<=? AND (flag&0x01=0) AND (flag&0x200=0) ORDER BY key ASC;";
+        "SELECT rowid FROM sync_data WHERE key>=? AND key<? AND (flag&0x01=0) AND (flag&0x200=0) ORDER BY key ASC;";
 
     constexpr const char *SELECT_SYNC_DATA_BY_ROWID_SQL =
         "SELECT key, value FROM sync_data WHERE rowid=?;";
 
     constexpr const char *SELECT_LOCAL_PREFIX_SQL =
-        "SELECT key, value FROM local_data WHERE key>=? AND key<=? ORDER BY key ASC;";
+        "SELECT key, value FROM local_data WHERE key>=? AND key<? ORDER BY key ASC;";
 
     constexpr const char *SELECT_COUNT_SYNC_PREFIX_SQL =
-        "SELECT count(key) FROM sync_data WHERE key>=? AND key<=? AND (flag&0x01=0) AND (flag&0x200=0);";
+        "SELECT count(key) FROM sync_data WHERE key>=? AND key<? AND (flag&0x01=0) AND (flag&0x200=0);";
+
+    constexpr const char *SELECT_SYNC_PREFIX_PAGE_AFTER_KEY_SQL =
+        "SELECT key, value FROM sync_data WHERE key>=? AND key<? AND key>? AND (flag&0x01=0) AND (flag&0x200=0) "
+        "ORDER BY key ASC LIMIT ?;";
+
+    constexpr const char *SELECT_SYNC_PREFIX_PAGE_BEFORE_KEY_SQL =
+        "SELECT key, value FROM sync_data WHERE key>=? AND key<? AND key<? AND (flag&0x01=0) AND (flag&0x200=0) "
+        "ORDER BY key DESC LIMIT ?;";
+
+    constexpr const char *SELECT_SYNC_PREFIX_PAGE_BY_OFFSET_SQL =
+        "SELECT key, value FROM sync_data WHERE key>=? AND key<? AND (flag&0x01=0) AND (flag&0x200=0) "
+        "ORDER BY key ASC LIMIT ? OFFSET ?;";
 
     constexpr const char *REMOVE_DEV_DATA_SQL =
         "DELETE FROM sync_data WHERE device=? AND (flag&0x02=0);";
@@ -233,9 +245,9 @@ namespace DistributedDB {
     constexpr const char *CHECK_DB_INTEGRITY_SQL = "PRAGMA integrity_check;";
 
     constexpr const char *REMOVE_META_VALUE_BY_KEY_PREFIX_SQL =
-        "DELETE FROM meta_data WHERE key>=? AND key<=?;";
+        "DELETE FROM meta_data WHERE key>=? AND key<?;";
     constexpr const char *REMOVE_ATTACH_META_VALUE_BY_KEY_PREFIX_SQL =
-        "DELETE FROM meta.meta_data WHERE key>=? AND key<=?;";
+        "DELETE FROM meta.meta_data WHERE key>=? AND key<?;";
 
     constexpr const char *DELETE_SYNC_DATA_WITH_HASHKEY = "DELETE FROM sync_data where hash_key = ?;";
 
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sqlite_statement_cache.h"
+
+#include <algorithm>
+#include <strings.h>
+#include <vector>
+
+#include "log_print.h"
+
+namespace DistributedDB {
+namespace {
+    // Only the dml and transaction statements are cached, ddl and pragma may change the handle or carry the password
+    const std::vector<std::string> CACHEABLE_SQL_HEADS = {
+        "SELECT", "INSERT", "UPDATE", "DELETE", "REPLACE", "WITH", "BEGIN", "COMMIT", "ROLLBACK"
+    };
+}
+
+SQLiteStatementCache &SQLiteStatementCache::GetInstance()
+{
+    static SQLiteStatementCache instance;
+    return instance;
+}
+
+void SQLiteStatementCache::RegisterHandle(sqlite3 *db, uint32_t capacity)
+{
+    if (db == nullptr || capacity == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(db);
+    if (iter != handleCaches_.end()) {
+        iter->second.capacity = capacity;
+        return;
+    }
+    handleCaches_[db].capacity = capacity;
+    handleCount_.store(static_cast<uint32_t>(handleCaches_.size()));
+}
+
+void SQLiteStatementCache::UnregisterHandle(sqlite3 *db)
+{
+    if (db == nullptr || handleCount_.load() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(db);
+    if (iter == handleCaches_.end()) {
+        return;
+    }
+    FinalizeIdleStatements(iter->second);
+    handleCaches_.erase(iter);
+    handleCount_.store(static_cast<uint32_t>(handleCaches_.size()));
+}
+
+bool SQLiteStatementCache::AcquireStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt *&statement)
+{
+    if (handleCount_.load() == 0 || !IsCacheableSql(sql)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(db);
+    if (iter == handleCaches_.end()) {
+        return false;
+    }
+    HandleCache &handleCache = iter->second;
+    auto idleIter = handleCache.idleStatements.find(sql);
+    if (idleIter == handleCache.idleStatements.end()) {
+        missCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    statement = idleIter->second.first;
+    handleCache.lruList.erase(idleIter->second.second);
+    handleCache.idleStatements.erase(idleIter);
+    handleCache.usingStatements[statement] = sql;
+    hitCount_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void SQLiteStatementCache::TrackStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt *statement)
+{
+    if (statement == nullptr || handleCount_.load() == 0 || !IsCacheableSql(sql)) {
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(db);
+    if (iter == handleCaches_.end()) {
+        return;
+    }
+    iter->second.usingStatements[statement] = sql;
+}
+
+bool SQLiteStatementCache::ReleaseStatement(sqlite3_stmt *statement, int &resetRet)
+{
+    if (statement == nullptr || handleCount_.load() == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(sqlite3_db_handle(statement));
+    if (iter == handleCaches_.end()) {
+        return false;
+    }
+    HandleCache &handleCache = iter->second;
+    auto usingIter = handleCache.usingStatements.find(statement);
+    if (usingIter == handleCache.usingStatements.end()) {
+        return false;
+    }
+    std::string sql = std::move(usingIter->second);
+    handleCache.usingStatements.erase(usingIter);
+    resetRet = sqlite3_reset(statement);
+    if (resetRet != SQLITE_OK || handleCache.idleStatements.count(sql) != 0) {
+        // Do not cache the statement which may be in bad status, or the same sql is already cached
+        (void)sqlite3_finalize(statement);
+        return true;
+    }
+    (void)sqlite3_clear_bindings(statement);
+    handleCache.lruList.push_front(sql);
+    handleCache.idleStatements[sql] = { statement, handleCache.lruList.begin() };
+    while (handleCache.lruList.size() > handleCache.capacity) {
+        auto idleIter = handleCache.idleStatements.find(handleCache.lruList.back());
+        if (idleIter != handleCache.idleStatements.end()) {
+            (void)sqlite3_finalize(idleIter->second.first);
+            handleCache.idleStatements.erase(idleIter);
+        }
+        handleCache.lruList.pop_back();
+    }
+    return true;
+}
+
+void SQLiteStatementCache::UntrackStatement(sqlite3_stmt *statement)
+{
+    if (statement == nullptr || handleCount_.load() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> autoLock(cacheLock_);
+    auto iter = handleCaches_.find(sqlite3_db_handle(statement));
+    if (iter == handleCaches_.end()) {
+        return;
+    }
+    iter->second.usingStatements.erase(statement);
+}
+
+void SQLiteStatementCache::GetStatistics(uint64_t &hitCount, uint64_t &missCount) const
+{
+    hitCount = hitCount_.load(std::memory_order_relaxed);
+    missCount = missCount_.load(std::memory_order_relaxed);
+}
+
+bool SQLiteStatementCache::IsCacheableSql(const std::string &sql)
+{
+    size_t pos = sql.find_first_not_of(" \t\r\n");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    return std::any_of(CACHEABLE_SQL_HEADS.begin(), CACHEABLE_SQL_HEADS.end(), [&sql, pos](const std::string &head) {
+        return sql.size() - pos >= head.size() &&
+            strncasecmp(sql.c_str() + pos, head.c_str(), head.size()) == 0;
+    });
+}
+
+void SQLiteStatementCache::FinalizeIdleStatements(HandleCache &handleCache)
+{
+    for (auto &item : handleCache.idleStatements) {
+        int errCode = sqlite3_finalize(item.second.first);
+        if (errCode != SQLITE_OK) {
+            LOGW("[SQLiteStatementCache] finalize cached statement error:%d", errCode);
+        }
+    }
+    handleCache.idleStatements.clear();
+    handleCache.lruList.clear();
+    handleCache.usingStatements.clear();
+}
+} // namespace DistributedDB
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SQLITE_STATEMENT_CACHE_H
+#define SQLITE_STATEMENT_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "macro_utils.h"
+#include "sqlite_import.h"
+
+namespace DistributedDB {
+// Process wide LRU cache of prepared statements for the registered sqlite handles, keyed by sql text.
+// SQLiteUtils::GetStatement takes the statement from the cache, and SQLiteUtils::ResetStatement with finalize gives
+// it back after reset and clear bindings, so callers keep the prepare-use-finalize pattern without any change.
+class SQLiteStatementCache final {
+public:
+    static SQLiteStatementCache &GetInstance();
+
+    DISABLE_COPY_ASSIGN_MOVE(SQLiteStatementCache);
+
+    void RegisterHandle(sqlite3 *db, uint32_t capacity = DEFAULT_CAPACITY);
+
+    // Finalize all cached statements of the handle, should be called before the handle closed.
+    // The statements in use are finalized as usual by their owners.
+    void UnregisterHandle(sqlite3 *db);
+
+    // Return true if an idle statement of the sql is found, otherwise the caller prepares it and calls TrackStatement
+    bool AcquireStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt *&statement);
+
+    // Mark the new prepared statement to be cached when it is finalized, do nothing if the handle is not registered
+    void TrackStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt *statement);
+
+    // Return true if the statement is taken back by the cache, resetRet is the result of sqlite3_reset.
+    // The statement is finalized when reset failed or there is no room, it should not be used anymore in both case.
+    bool ReleaseStatement(sqlite3_stmt *statement, int &resetRet);
+
+    // Forget the statement which failed to reset, the caller finalizes it and keeps the reset error.
+    void UntrackStatement(sqlite3_stmt *statement);
+
+    void GetStatistics(uint64_t &hitCount, uint64_t &missCount) const;
+
+    static constexpr uint32_t DEFAULT_CAPACITY = 32;
+
+private:
+    SQLiteStatementCache() = default;
+    ~SQLiteStatementCache() = default;
+
+    struct HandleCache {
+        uint32_t capacity = DEFAULT_CAPACITY;
+        std::list<std::string> lruList; // The front is the most recently used idle statement
+        std::unordered_map<std::string, std::pair<sqlite3_stmt *, std::list<std::string>::iterator>> idleStatements;
+        std::unordered_map<sqlite3_stmt *, std::string> usingStatements;
+    };
+
+    static bool IsCacheableSql(const std::string &sql);
+
+    static void FinalizeIdleStatements(HandleCache &handleCache);
+
+    std::mutex cacheLock_;
+    std::map<sqlite3 *, HandleCache> handleCaches_;
+    std::atomic<uint32_t> handleCount_ = 0; // Skip the lock when there is no registered handle
+    std::atomic<uint64_t> hitCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+};
+} // namespace DistributedDB
+#endif // SQLITE_STATEMENT_CACHE_H
@@ -17,6 +17,7 @@
 
 #include "db_errno.h"
 #include "log_print.h"
+#include "sqlite_statement_cache.h"
 #include "sqlite_utils.h"
 
 namespace DistributedDB {
@@ -29,6 +30,8 @@ SQLiteStorageExecutor::SQLiteStorageExecutor(sqlite3 *dbHandle, bool writable, b
 SQLiteStorageExecutor::~SQLiteStorageExecutor()
 {
     if (dbHandle_ != nullptr) {
+        // Cached statements must be finalized before close, otherwise the handle can not be released
+        SQLiteStatementCache::GetInstance().UnregisterHandle(dbHandle_);
         (void)sqlite3_close_v2(dbHandle_);
         dbHandle_ = nullptr;
     }
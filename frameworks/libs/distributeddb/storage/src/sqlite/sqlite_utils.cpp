@@ -215,13 +215,29 @@ END:
     return errCode;
 }
 
+Key SQLiteUtils::GetPrefixKeyUpperBound(const Key &keyPrefix)
+{
+    // The smallest key greater than every key starting with the prefix: drop the trailing 0xFF bytes and
+    // increase the last remaining byte, so the range [prefix, upperBound) can be searched through the key index.
+    Key upperBound = keyPrefix;
+    while (!upperBound.empty() && upperBound.back() == UCHAR_MAX) {
+        upperBound.pop_back();
+    }
+    if (!upperBound.empty()) {
+        upperBound.back()++;
+        return upperBound;
+    }
+    // No successor exists, use a bound longer than the max key size which is greater than all valid keys.
+    upperBound.assign(DBConstant::MAX_KEY_SIZE + 1, UCHAR_MAX);
+    return upperBound;
+}
+
 int SQLiteUtils::BindPrefixKey(sqlite3_stmt *statement, int index, const Key &keyPrefix)
 {
     if (statement == nullptr) {
         return -E_INVALID_ARGS;
     }
 
-    const size_t maxKeySize = DBConstant::MAX_KEY_SIZE;
     // bind the first prefix key
     int errCode = BindBlobToStatement(statement, index, keyPrefix, true);
     if (errCode != SQLITE_OK) {
@@ -229,24 +245,9 @@ int SQLiteUtils::BindPrefixKey(sqlite3_stmt *statement, int index, const Key &ke
         return SQLiteUtils::MapSQLiteErrno(errCode);
     }
 
-    // bind the second prefix key
-    uint8_t end[maxKeySize];
-    errno_t status = memset_s(end, maxKeySize, UCHAR_MAX, maxKeySize); // max byte value is 0xFF.
-    if (status != EOK) {
-        LOGE("memset error:%d", status);
-        return -E_SECUREC_ERROR;
-    }
-
-    if (!keyPrefix.empty()) {
-        status = memcpy_s(end, maxKeySize, keyPrefix.data(), keyPrefix.size());
-        if (status != EOK) {
-            LOGE("memcpy error:%d", status);
-            return -E_SECUREC_ERROR;
-        }
-    }
-
-    // index wouldn't be too large, just add one to the first index.
-    errCode = sqlite3_bind_blob(statement, index + 1, end, maxKeySize, SQLITE_TRANSIENT);
+    // bind the exclusive upper bound of the prefix range, index wouldn't be too large, just add one to the first.
+    Key upperBound = GetPrefixKeyUpperBound(keyPrefix);
+    errCode = sqlite3_bind_blob(statement, index + 1, upperBound.data(), upperBound.size(), SQLITE_TRANSIENT);
     if (errCode != SQLITE_OK) {
         LOGE("Bind the prefix second error:%d", errCode);
         return SQLiteUtils::MapSQLiteErrno(errCode);
@@ -78,9 +78,12 @@ public:
     // Step the statement
     static int StepWithRetry(sqlite3_stmt *statement, bool isMemDb = false);
 
-    // Bind the prefix key range
+    // Bind the prefix key range, the statement must use the half-open condition "key>=? AND key<?"
     static int BindPrefixKey(sqlite3_stmt *statement, int index, const Key &keyPrefix);
 
+    // Get the exclusive upper bound of all keys which start with the prefix
+    static Key GetPrefixKeyUpperBound(const Key &keyPrefix);
+
     static int BeginTransaction(sqlite3 *db, TransactType type = TransactType::DEFERRED);
 
     static int CommitTransaction(sqlite3 *db);
@@ -139,6 +142,10 @@ public:
 
     static int GetDbSize(const std::string &dir, const std::string &dbName, uint64_t &size);
 
+    // Copy all pages of an unencrypted database by the sqlite backup api, target is removed if failed.
+    // It is always a full copy, pages unchanged since a previous backup are copied again.
+    static int BackupDatabase(const std::string &srcFile, const std::string &targetFile);
+
     static int AttachNewDatabase(sqlite3 *db, CipherType type, const CipherPassword &password,
         const std::string &attachDbAbsPath, const std::string &attachAsName = "backup");
 
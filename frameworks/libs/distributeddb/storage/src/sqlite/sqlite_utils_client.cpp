@@ -17,6 +17,7 @@
 
 #include "db_common.h"
 #include "platform_specific.h"
+#include "sqlite_statement_cache.h"
 
 namespace DistributedDB {
 namespace {
@@ -171,6 +172,9 @@ int SQLiteUtils::GetStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt
     if (statement != nullptr) {
         return E_OK;
     }
+    if (SQLiteStatementCache::GetInstance().AcquireStatement(db, sql, statement)) {
+        return E_OK;
+    }
     int errCode = sqlite3_prepare_v2(db, sql.c_str(), NO_SIZE_LIMIT, &statement, nullptr);
     if (errCode != SQLITE_OK) {
         LOGE("Prepare SQLite statement failed:%d, sys:%d", errCode, errno);
@@ -182,7 +186,7 @@ int SQLiteUtils::GetStatement(sqlite3 *db, const std::string &sql, sqlite3_stmt
     if (statement == nullptr) {
         return -E_INVALID_DB;
     }
-
+    SQLiteStatementCache::GetInstance().TrackStatement(db, sql, statement);
     return E_OK;
 }
 
@@ -198,6 +202,7 @@ void SQLiteUtils::ResetStatement(sqlite3_stmt *&statement, bool isNeedFinalize,
     }
 
     int innerCode = SQLITE_OK;
+    bool isResetFailed = false;
     // if need finalize the statement, just goto finalize.
     if (!isNeedFinalize) {
         // reset the statement firstly.
@@ -205,12 +210,23 @@ void SQLiteUtils::ResetStatement(sqlite3_stmt *&statement, bool isNeedFinalize,
         if (innerCode != SQLITE_OK && !isIgnoreResetRet) {
             LOGE("[SQLiteUtils] reset statement error:%d, sys:%d", innerCode, errno);
             isNeedFinalize = true;
+            isResetFailed = true;
         } else {
             sqlite3_clear_bindings(statement);
         }
     }
 
-    if (isNeedFinalize) {
+    if (isResetFailed) {
+        // Reset again in the cache would return ok and lose the error, the statement should not be cached either
+        SQLiteStatementCache::GetInstance().UntrackStatement(statement);
+    } else if (isNeedFinalize && SQLiteStatementCache::GetInstance().ReleaseStatement(statement, innerCode)) {
+        // The statement is taken back by the cache, reset result is the same as finalize result
+        if (innerCode != SQLITE_OK) {
+            LOGE("[SQLiteUtils] reset cached statement error:%d, sys:%d", innerCode, errno);
+        }
+        statement = nullptr;
+    }
+    if (isNeedFinalize && statement != nullptr) {
         int finalizeResult = sqlite3_finalize(statement);
         if (finalizeResult != SQLITE_OK) {
             LOGE("[SQLiteUtils] finalize statement error:%d, sys:%d", finalizeResult, errno);
@@ -55,6 +55,11 @@ struct ValueParseCache {
     std::vector<uint8_t> valueOriginal;
 };
 
+struct FieldPathCache {
+    std::string pathOriginal;
+    FieldPath pathParsed;
+};
+
 namespace {
 inline bool IsDeleteRecord(const uint8_t *valueBlob, int valueBlobLen)
 {
@@ -64,6 +69,8 @@ inline bool IsDeleteRecord(const uint8_t *valueBlob, int valueBlobLen)
 // Use the same cache id as sqlite use for json_extract which is substituted by our json_extract_by_path
 // A negative cache-id enables sharing of cache between different operation during the same statement
 constexpr int VALUE_CACHE_ID = -429938;
+// The path is the second argument, sqlite keeps its auxdata across rows as long as the argument is constant
+constexpr int PATH_CACHE_ID = 1;
 
 void ValueParseCacheFree(ValueParseCache *inCache)
 {
@@ -72,6 +79,13 @@ void ValueParseCacheFree(ValueParseCache *inCache)
     }
 }
 
+void FieldPathCacheFree(FieldPathCache *inCache)
+{
+    if (inCache != nullptr) {
+        delete inCache;
+    }
+}
+
 // We don't use cache array since we only cache value column of sqlite table, see sqlite implementation for compare.
 const ValueObject *ParseValueThenCacheOrGetFromCache(sqlite3_context *ctx, const uint8_t *valueBlob,
     uint32_t valueBlobLen, uint32_t offset)
@@ -85,8 +99,20 @@ const ValueObject *ParseValueThenCacheOrGetFromCache(sqlite3_context *ctx, const
                 return &(cached->valueParsed);
             }
         }
+        // Cache mismatch means the statement stepped to another row, reuse the cache rather than reallocate it
+        const ValueObject emptyValue;
+        cached->valueOriginal.clear();
+        cached->valueParsed = emptyValue;
+        int errCode = cached->valueParsed.Parse(valueBlob, valueBlob + valueBlobLen, offset);
+        if (errCode != E_OK) {
+            sqlite3_result_error(ctx, "[ParseValueCache] Parse fail.", USING_STR_LEN);
+            LOGE("[ParseValueCache] Parse fail, errCode=%d.", errCode);
+            return nullptr;
+        }
+        cached->valueOriginal.assign(valueBlob, valueBlob + valueBlobLen);
+        return &(cached->valueParsed);
     }
-    // No cache or cache mismatch
+    // No cache
     auto newCache = new (std::nothrow) ValueParseCache;
     if (newCache == nullptr) {
         sqlite3_result_error(ctx, "[ParseValueCache] OOM.", USING_STR_LEN);
@@ -113,6 +139,39 @@ const ValueObject *ParseValueThenCacheOrGetFromCache(sqlite3_context *ctx, const
     }
     return &(cacheInAuxdata->valueParsed);
 }
+
+// The path of each predicate is a constant in query sql, parse it once for the statement instead of once per row.
+const FieldPath *ParsePathThenCacheOrGetFromCache(sqlite3_context *ctx, const char *path)
+{
+    auto cached = static_cast<FieldPathCache *>(sqlite3_get_auxdata(ctx, PATH_CACHE_ID));
+    if (cached != nullptr && cached->pathOriginal == path) {
+        return &(cached->pathParsed);
+    }
+    auto newCache = new (std::nothrow) FieldPathCache;
+    if (newCache == nullptr) {
+        sqlite3_result_error(ctx, "[JsonExtract] OOM.", USING_STR_LEN);
+        LOGE("[JsonExtract] Path cache OOM.");
+        return nullptr;
+    }
+    int errCode = SchemaUtils::ParseAndCheckFieldPath(path, newCache->pathParsed);
+    if (errCode != E_OK) {
+        sqlite3_result_error(ctx, "[JsonExtract] Path illegal.", USING_STR_LEN);
+        LOGE("[JsonExtract] Path illegal.");
+        delete newCache;
+        newCache = nullptr;
+        return nullptr;
+    }
+    newCache->pathOriginal = path;
+    sqlite3_set_auxdata(ctx, PATH_CACHE_ID, newCache, reinterpret_cast<void(*)(void*)>(FieldPathCacheFree));
+    // Same as value cache, sqlite3_set_auxdata may fail and delete newCache immediately.
+    auto cacheInAuxdata = static_cast<FieldPathCache *>(sqlite3_get_auxdata(ctx, PATH_CACHE_ID));
+    if (cacheInAuxdata == nullptr) {
+        sqlite3_result_error(ctx, "[JsonExtract] Cache path fail.", USING_STR_LEN);
+        LOGE("[JsonExtract] Cache path fail.");
+        return nullptr;
+    }
+    return &(cacheInAuxdata->pathParsed);
+}
 }
 
 void SQLiteUtils::JsonExtractByPath(sqlite3_context *ctx, int argc, sqlite3_value **argv)
@@ -136,12 +195,9 @@ void SQLiteUtils::JsonExtractByPath(sqlite3_context *ctx, int argc, sqlite3_valu
         LOGE("[JsonExtract] Path nullptr or offset=%d invalid.", offset);
         return;
     }
-    FieldPath outPath;
-    int errCode = SchemaUtils::ParseAndCheckFieldPath(path, outPath);
-    if (errCode != E_OK) {
-        sqlite3_result_error(ctx, "[JsonExtract] Path illegal.", USING_STR_LEN);
-        LOGE("[JsonExtract] Path illegal.");
-        return;
+    const FieldPath *outPath = ParsePathThenCacheOrGetFromCache(ctx, path);
+    if (outPath == nullptr) {
+        return; // Necessary had been printed in ParsePathThenCacheOrGetFromCache
     }
     // Parameter Check Done Here
     const ValueObject *valueObj = ParseValueThenCacheOrGetFromCache(ctx, valueBlob, static_cast<uint32_t>(valueBlobLen),
@@ -149,7 +205,7 @@ void SQLiteUtils::JsonExtractByPath(sqlite3_context *ctx, int argc, sqlite3_valu
     if (valueObj == nullptr) {
         return; // Necessary had been printed in ParseValueThenCacheOrGetFromCache
     }
-    JsonExtractInnerFunc(ctx, *valueObj, outPath);
+    JsonExtractInnerFunc(ctx, *valueObj, *outPath);
 }
 
 namespace {
@@ -424,6 +480,49 @@ int SQLiteUtils::GetDbSize(const std::string &dir, const std::string &dbName, ui
     return E_OK;
 }
 
+int SQLiteUtils::BackupDatabase(const std::string &srcFile, const std::string &targetFile)
+{
+    std::vector<std::string> createTableSqls;
+    OpenDbProperties srcOption = {srcFile, false, false, createTableSqls, CipherType::DEFAULT, CipherPassword()};
+    sqlite3 *srcDb = nullptr;
+    int errCode = SQLiteUtils::OpenDatabase(srcOption, srcDb);
+    if (errCode != E_OK) {
+        LOGE("[SQLiteUtils][Backup] open src db failed:%d", errCode);
+        return errCode;
+    }
+    OpenDbProperties targetOption = {targetFile, true, false, createTableSqls, CipherType::DEFAULT, CipherPassword()};
+    sqlite3 *targetDb = nullptr;
+    errCode = SQLiteUtils::OpenDatabase(targetOption, targetDb);
+    if (errCode != E_OK) {
+        LOGE("[SQLiteUtils][Backup] open target db failed:%d", errCode);
+        (void)sqlite3_close_v2(srcDb);
+        return errCode;
+    }
+    sqlite3_backup *backup = sqlite3_backup_init(targetDb, "main", srcDb, "main");
+    if (backup == nullptr) {
+        errCode = SQLiteUtils::MapSQLiteErrno(sqlite3_errcode(targetDb));
+        LOGE("[SQLiteUtils][Backup] init backup failed:%d", errCode);
+    } else {
+        // Copy all pages in one step, which reads a consistent snapshot of the source
+        int ret = sqlite3_backup_step(backup, -1);
+        (void)sqlite3_backup_finish(backup);
+        if (ret != SQLITE_DONE) {
+            errCode = SQLiteUtils::MapSQLiteErrno(ret);
+            LOGE("[SQLiteUtils][Backup] backup step failed:%d", ret);
+        }
+    }
+    (void)sqlite3_close_v2(targetDb);
+    (void)sqlite3_close_v2(srcDb);
+    if (errCode != E_OK) {
+        for (const auto &file : { targetFile, targetFile + "-wal", targetFile + "-shm" }) {
+            if (OS::CheckPathExistence(file)) {
+                (void)OS::RemoveFile(file);
+            }
+        }
+    }
+    return errCode;
+}
+
 int SQLiteUtils::SetDataBaseProperty(sqlite3 *db, const OpenDbProperties &properties, bool setWal,
     const std::vector<std::string> &sqls)
 {
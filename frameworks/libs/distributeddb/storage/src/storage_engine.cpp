@@ -261,7 +261,7 @@ StorageExecutor *StorageEngine::FindExecutor(bool writable, OperatePerm perm, in
         return nullptr;
     }
 
-    {
+    if (!isInitialized_.load()) {
         std::unique_lock<std::mutex> lock(initMutex_);
         bool result = initCondition_.wait_for(lock, std::chrono::seconds(waitTime), [this]() {
             return isInitialized_.load();
@@ -329,8 +329,18 @@ StorageExecutor *StorageEngine::FindReadExecutor(OperatePerm perm, int &errCode,
             LOGI("Not permitted to get the executor[%u]", static_cast<unsigned>(perm_));
             return nullptr;
         }
+        if (operateAbort_) {
+            LOGI("Abort find read executor and busy for operate!");
+            return nullptr;
+        }
         std::list<StorageExecutor *> &readUsingList = isExternal ? externalReadUsingList_ : readUsingList_;
         std::list<StorageExecutor *> &readIdleList = isExternal ?  externalReadIdleList_ : readIdleList_;
+        StorageExecutor *idleHandle = TakeIdleReadExecutor(readIdleList, readUsingList, pendingCount.load(),
+            (waitTime <= 0) ? engineAttr_.maxReadNum : (isExternal ? 1 : engineAttr_.maxReadNum));
+        if (idleHandle != nullptr) {
+            errCode = E_OK;
+            return idleHandle;
+        }
         if (waitTime <= 0) { // non-blocking.
             auto pending = static_cast<size_t>(pendingCount.load());
             if (readIdleList.empty() && readUsingList.size() + pending == engineAttr_.maxReadNum) {
@@ -403,8 +413,7 @@ StorageExecutor *StorageEngine::FetchReadStorageExecutor(int &errCode, bool isEx
     auto &usingList = isExternal ? externalReadUsingList_ : readUsingList_;
     auto &idleList = isExternal ?  externalReadIdleList_ : readIdleList_;
     auto item = idleList.front();
-    usingList.push_back(item);
-    idleList.remove(item);
+    usingList.splice(usingList.end(), idleList, idleList.begin());
     if (!isEnhance_) {
         LOGD("Get executor[0] from [%.3s]", hashIdentifier_.c_str());
     }
@@ -412,6 +421,22 @@ StorageExecutor *StorageEngine::FetchReadStorageExecutor(int &errCode, bool isEx
     return item;
 }
 
+StorageExecutor *StorageEngine::TakeIdleReadExecutor(std::list<StorageExecutor *> &idleList,
+    std::list<StorageExecutor *> &usingList, int pendingCount, uint32_t maxReadHandleNum)
+{
+    // Caller holds readMutex_. Hot reads reuse an idle handle under this single lock; creating a handle or
+    // waiting for one still goes through the pending count path.
+    if (idleList.empty() || pendingCount != 0 || idleList.size() + usingList.size() > maxReadHandleNum) {
+        return nullptr;
+    }
+    auto item = idleList.front();
+    usingList.splice(usingList.end(), idleList, idleList.begin());
+    if (!isEnhance_) {
+        LOGD("Get executor[0] from [%.3s]", hashIdentifier_.c_str());
+    }
+    return item;
+}
+
 void StorageEngine::Recycle(StorageExecutor *&handle, bool isExternal)
 {
     if (handle == nullptr) {
@@ -426,14 +451,14 @@ void StorageEngine::Recycle(StorageExecutor *&handle, bool isExternal)
         std::list<StorageExecutor *> &writeIdleList = isExternal ?  externalWriteIdleList_ : writeIdleList_;
         auto iter = std::find(writeUsingList.begin(), writeUsingList.end(), handle);
         if (iter != writeUsingList.end()) {
-            writeUsingList.remove(handle);
             if (!writeIdleList.empty()) {
+                writeUsingList.erase(iter);
                 delete handle;
                 handle = nullptr;
                 return;
             }
             handle->Reset();
-            writeIdleList.push_back(handle);
+            writeIdleList.splice(writeIdleList.end(), writeUsingList, iter);
             writeCondition_.notify_one();
             idleCondition_.notify_all();
         }
@@ -460,13 +485,13 @@ StorageExecutor *StorageEngine::RecycleExcessReadExecutor(StorageExecutor *handl
     if (iter == readUsingList.end()) {
         return nullptr;
     }
-    readUsingList.remove(handle);
     if (readIdleList.empty()) {
         handle->Reset();
-        readIdleList.push_back(handle);
+        readIdleList.splice(readIdleList.end(), readUsingList, iter);
         readCondition_.notify_one();
         return nullptr;
     }
+    readUsingList.erase(iter);
     if (isDelayRelease_) {
         handle->Reset();
         AddToDelayedRelease(handle, isExternal);
@@ -771,8 +796,7 @@ StorageExecutor *StorageEngine::FetchStorageExecutor(bool isWrite, std::list<Sto
         AddStorageExecutor(handle, isExternal);
     }
     auto item = idleList.front();
-    usingList.push_back(item);
-    idleList.remove(item);
+    usingList.splice(usingList.end(), idleList, idleList.begin());
     if (!isEnhance_) {
         LOGD("Get executor[%d] from [%.3s]", isWrite, hashIdentifier_.c_str());
     }
@@ -160,6 +160,9 @@ private:
 
     StorageExecutor *FetchReadStorageExecutor(int &errCode, bool isExternal, bool isNeedCreate);
 
+    StorageExecutor *TakeIdleReadExecutor(std::list<StorageExecutor *> &idleList,
+        std::list<StorageExecutor *> &usingList, int pendingCount, uint32_t maxReadHandleNum);
+
     // Put an excess read executor into the delayed release list instead of deleting it immediately.
     void AddToDelayedRelease(StorageExecutor *handle, bool isExternal);
 
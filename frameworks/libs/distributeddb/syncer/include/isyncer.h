@@ -135,6 +135,9 @@ public:
 
     virtual int UpgradeSchemaVerInMeta() = 0;
 
+    // Save the advanced watermark into db after the count of update reach threshold, 0 means save at once
+    virtual int SetWaterMarkFlushThreshold(uint32_t threshold) = 0;
+
     virtual void ResetSyncStatus() = 0;
 
     virtual int64_t GetLocalTimeOffset() = 0;
@@ -116,6 +116,8 @@ public:
 
     int UpgradeSchemaVerInMeta() override;
 
+    int SetWaterMarkFlushThreshold(uint32_t threshold) override;
+
     void ResetSyncStatus() override;
 
     int64_t GetLocalTimeOffset() override;
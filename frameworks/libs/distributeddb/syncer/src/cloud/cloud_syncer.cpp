@@ -46,7 +46,8 @@ CloudSyncer::CloudSyncer(
       asyncTaskId_(INVALID_TASK_ID),
       cancelAsyncTask_(false),
       scheduleTaskCount_(0),
-      waitDownloadListener_(nullptr)
+      waitDownloadListener_(nullptr),
+      prefetchTaskCount_(0u)
 {
     if (storageProxy_ != nullptr) {
         id_ = storageProxy_->GetIdentify();
@@ -131,6 +132,7 @@ void CloudSyncer::Close()
     UnlockIfNeed();
     cloudDB_.Close();
     IfNeedWaitCurTaskFinished(true);
+    WaitPrefetchTaskFinished();
 
     // copy all task from queue
     std::vector<CloudTaskInfo> infoList = CopyAndClearTaskInfos();
@@ -1397,7 +1399,7 @@ int CloudSyncer::QueryCloudData(TaskId taskId, const std::string &tableName, std
     if (ret != E_OK) {
         return ret;
     }
-    ret = cloudDB_.Query(tableName, extend, downloadData.data);
+    ret = QueryCloudDataWithPrefetch(tableName, cloudWaterMark, extend, downloadData.data);
     storageProxy_->FilterDownloadRecordNotFound(tableName, downloadData);
     storageProxy_->FilterDownloadRecordNoneSchemaField(tableName, downloadData);
     if ((ret == E_OK || ret == -E_QUERY_END) && downloadData.data.empty()) {
@@ -1942,6 +1944,9 @@ int CloudSyncer::DownloadOneBatch(TaskId taskId, SyncParam &param, bool isFirstD
         }
         LOGI("[CloudSyncer] Resume task need download assets");
         downloadAssetOnly = true;
+    } else {
+        // Query next batch from cloud while this batch is saving
+        PrefetchNextBatch(taskId, param);
     }
     // Save data in transaction, update cloud water mark, notify process and changed data
     ret = SaveDataNotifyProcess(taskId, param, downloadAssetOnly);
@@ -135,6 +135,19 @@ protected:
         Timestamp timestamp;
         bool recordConflict = false;
     };
+    // next batch queried from cloud in advance, only used when cursor not changed after current batch saved
+    struct DownloadPrefetch {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool started = false;
+        bool canceled = false;
+        bool finished = false;
+        int errCode = E_OK;
+        std::string tableName;
+        std::string cloudWaterMark;
+        VBucket extend;
+        std::vector<VBucket> data;
+    };
     struct ResumeTaskInfo {
         TaskContext context;
         SyncParam syncParam;
@@ -343,6 +356,17 @@ protected:
 
     int DownloadOneBatch(TaskId taskId, SyncParam &param, bool isFirstDownload);
 
+    bool IsNeedPrefetchNextBatch(TaskId taskId, const SyncParam &param);
+
+    void PrefetchNextBatch(TaskId taskId, const SyncParam &param);
+
+    void FinishPrefetchTask();
+
+    void WaitPrefetchTaskFinished();
+
+    int QueryCloudDataWithPrefetch(const std::string &tableName, const std::string &cloudWaterMark, VBucket &extend,
+        std::vector<VBucket> &data);
+
     int DownloadOneAssetRecord(const std::set<Key> &dupHashKeySet, const DownloadList &downloadList,
         DownloadItem &downloadItem, InnerProcessInfo &info, ChangedData &changedAssets);
 
@@ -668,6 +692,11 @@ protected:
     std::atomic<int> scheduleTaskCount_;
     std::mutex listenerMutex_;
     NotificationChain::Listener *waitDownloadListener_;
+    // only accessed in sync task thread
+    std::shared_ptr<DownloadPrefetch> downloadPrefetch_;
+    std::mutex prefetchMutex_;
+    std::condition_variable prefetchCv_;
+    uint32_t prefetchTaskCount_;
 
     static constexpr const TaskId INVALID_TASK_ID = 0u;
     static constexpr const int MAX_HEARTBEAT_FAILED_LIMIT = 2;
@@ -1044,6 +1044,7 @@ bool CloudSyncer::IsTasksCanMerge(TaskId taskId, TaskId tryMergeTaskId)
     return IsTaskCanMerge(taskInfo) && IsTaskCanMerge(tryMergeTaskInfo) &&
         taskInfo.devices == tryMergeTaskInfo.devices &&
         taskInfo.asyncDownloadAssets == tryMergeTaskInfo.asyncDownloadAssets &&
+        taskInfo.pipelineDownload == tryMergeTaskInfo.pipelineDownload &&
         taskInfo.syncFlowType == tryMergeTaskInfo.syncFlowType;
 }
 
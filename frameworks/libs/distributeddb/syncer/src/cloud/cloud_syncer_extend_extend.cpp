@@ -242,6 +242,11 @@ int CloudSyncer::DoDownloadInner(CloudSyncer::TaskId taskId, SyncParam &param, b
     }
     int expiredCursorCount = 0;
     uint64_t loopCount = 0;
+    // Prefetched batch can not be used by other table or task
+    downloadPrefetch_ = nullptr;
+    ResFinalizer finalizer([this]() {
+        downloadPrefetch_ = nullptr;
+    });
     do {
         ret = DownloadOneBatch(taskId, param, isFirstDownload);
         if (ret == -E_EXPIRED_CURSOR) {
@@ -266,6 +271,132 @@ int CloudSyncer::DoDownloadInner(CloudSyncer::TaskId taskId, SyncParam &param, b
     return E_OK;
 }
 
+bool CloudSyncer::IsNeedPrefetchNextBatch(TaskId taskId, const SyncParam &param)
+{
+    if (closed_) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(dataLock_);
+        if (!cloudTaskInfos_[taskId].pipelineDownload) {
+            return false;
+        }
+    }
+    if (param.isLastBatch || param.isAssetsOnly || param.downloadData.data.empty()) {
+        return false;
+    }
+    // extend of query nodes and compensated task depends on local data which is changing by current batch
+    if (IsCompensatedTask(taskId)) {
+        return false;
+    }
+    return !GetQuerySyncObject(param.tableName).IsContainQueryNodes();
+}
+
+void CloudSyncer::PrefetchNextBatch(TaskId taskId, const SyncParam &param)
+{
+    downloadPrefetch_ = nullptr;
+    if (!IsNeedPrefetchNextBatch(taskId, param)) {
+        return;
+    }
+    // the cursor of last record will be the cloud water mark after current batch saved
+    const VBucket &lastData = param.downloadData.data.back();
+    auto iter = lastData.find(CloudDbConstant::CURSOR_FIELD);
+    if (iter == lastData.end() || iter->second.index() != TYPE_INDEX<std::string>) {
+        return;
+    }
+    auto prefetch = std::make_shared<DownloadPrefetch>();
+    prefetch->tableName = param.info.tableName;
+    prefetch->cloudWaterMark = std::get<std::string>(iter->second);
+    int errCode = FillDownloadExtend(taskId, prefetch->tableName, prefetch->cloudWaterMark, prefetch->extend);
+    if (errCode != E_OK) {
+        LOGW("[CloudSyncer] Fill extend for prefetch failed %d", errCode);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> autoLock(prefetchMutex_);
+        prefetchTaskCount_++;
+    }
+    IncObjRef(this);
+    errCode = RuntimeContext::GetInstance()->ScheduleTask([this, prefetch]() {
+        {
+            std::lock_guard<std::mutex> autoLock(prefetch->mutex);
+            if (prefetch->canceled) {
+                FinishPrefetchTask();
+                DecObjRef(this);
+                return;
+            }
+            prefetch->started = true;
+        }
+        int ret = cloudDB_.Query(prefetch->tableName, prefetch->extend, prefetch->data);
+        {
+            std::lock_guard<std::mutex> autoLock(prefetch->mutex);
+            prefetch->errCode = ret;
+            prefetch->finished = true;
+        }
+        prefetch->cv.notify_all();
+        FinishPrefetchTask();
+        DecObjRef(this);
+    });
+    if (errCode != E_OK) {
+        LOGW("[CloudSyncer] Schedule prefetch task failed %d", errCode);
+        FinishPrefetchTask();
+        DecObjRef(this);
+        return;
+    }
+    downloadPrefetch_ = prefetch;
+}
+
+void CloudSyncer::FinishPrefetchTask()
+{
+    {
+        std::lock_guard<std::mutex> autoLock(prefetchMutex_);
+        prefetchTaskCount_--;
+    }
+    prefetchCv_.notify_all();
+}
+
+void CloudSyncer::WaitPrefetchTaskFinished()
+{
+    std::unique_lock<std::mutex> uniqueLock(prefetchMutex_);
+    if (prefetchTaskCount_ == 0u) {
+        return;
+    }
+    LOGI("[CloudSyncer] Wait %" PRIu32 " prefetch task finished", prefetchTaskCount_);
+    prefetchCv_.wait(uniqueLock, [this]() {
+        return prefetchTaskCount_ == 0u;
+    });
+    LOGI("[CloudSyncer] Prefetch task finished");
+}
+
+int CloudSyncer::QueryCloudDataWithPrefetch(const std::string &tableName, const std::string &cloudWaterMark,
+    VBucket &extend, std::vector<VBucket> &data)
+{
+    std::shared_ptr<DownloadPrefetch> prefetch = downloadPrefetch_;
+    downloadPrefetch_ = nullptr;
+    if (prefetch == nullptr) {
+        return cloudDB_.Query(tableName, extend, data);
+    }
+    std::unique_lock<std::mutex> uniqueLock(prefetch->mutex);
+    if (!prefetch->started) {
+        // Query in current thread rather than wait for a busy pool
+        prefetch->canceled = true;
+        uniqueLock.unlock();
+        return cloudDB_.Query(tableName, extend, data);
+    }
+    prefetch->cv.wait(uniqueLock, [&prefetch]() {
+        return prefetch->finished;
+    });
+    if (prefetch->tableName != tableName || prefetch->cloudWaterMark != cloudWaterMark) {
+        LOGI("[CloudSyncer] Cloud water mark changed, discard prefetched batch");
+        uniqueLock.unlock();
+        return cloudDB_.Query(tableName, extend, data);
+    }
+    LOGD("[CloudSyncer] Use prefetched batch, size=%zu", prefetch->data.size());
+    extend = std::move(prefetch->extend);
+    data = std::move(prefetch->data);
+    return prefetch->errCode;
+}
+
 int CloudSyncer::DoUpdateExpiredCursor(TaskId taskId, const std::string &table, std::string &newCursor)
 {
     LOGI("[CloudSyncer] Update expired cursor now, table[%s]", DBCommon::StringMiddleMasking(table).c_str());
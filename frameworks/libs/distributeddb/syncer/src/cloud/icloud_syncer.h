@@ -36,6 +36,7 @@ public:
         bool merge = false;
         bool asyncDownloadAssets = false;
         bool fullSync = false; // reset download and upload mark when sync
+        bool pipelineDownload = false;
         int errCode = 0;
         int tempErrCode = 0;
         int32_t priorityLevel = 0;
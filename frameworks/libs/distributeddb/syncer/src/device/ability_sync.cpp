@@ -15,6 +15,7 @@
 
 #include "ability_sync.h"
 
+#include "data_compression.h"
 #include "message_transform.h"
 #include "version.h"
 #include "db_errno.h"
@@ -1085,8 +1086,18 @@ void AbilitySync::SetAbilityAckSyncOpinionInfo(AbilitySyncAckPacket &ackPacket,
 
 int AbilitySync::GetDbAbilityInfo(DbAbility &dbAbility)
 {
+    std::set<AbilityItem> unsupportedItems;
+    for (const auto &algo : SyncConfig::COMPRESSALGOMAP) {
+        // The compression algorithm is optional in build, only announce the one could be uncompressed here
+        if (DataCompression::GetInstance(static_cast<CompressAlgorithm>(algo.first)) == nullptr) {
+            unsupportedItems.insert(algo.second);
+        }
+    }
     int errCode = E_OK;
     for (const auto &item : SyncConfig::ABILITYBITS) {
+        if (unsupportedItems.count(item) != 0) {
+            continue;
+        }
         errCode = dbAbility.SetAbilityItem(item, SUPPORT_MARK);
         if (errCode != E_OK) {
             return errCode;
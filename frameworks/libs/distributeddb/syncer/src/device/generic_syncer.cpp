@@ -447,6 +447,8 @@ int GenericSyncer::InitMetaData(ISyncInterface *syncInterface)
     if (errCode != E_OK) {
         LOGE("[Syncer] metadata Initializeate failed! err %d.", errCode);
         metadata_ = nullptr;
+    } else {
+        metadata_->SetWaterMarkFlushThreshold(waterMarkFlushThreshold_);
     }
     syncInterface_ = syncInterface;
     return errCode;
@@ -1096,11 +1098,28 @@ int GenericSyncer::CloseInner(bool isClosedOperation)
         syncEngine_->Close();
         LOGD("[Syncer] Close SyncEngine!");
         std::lock_guard<std::mutex> lock(syncerLock_);
+        if (metadata_ != nullptr) {
+            (void)metadata_->FlushWaterMark();
+        }
         closing_ = false;
     }
     return E_OK;
 }
 
+int GenericSyncer::SetWaterMarkFlushThreshold(uint32_t threshold)
+{
+    if (threshold > DBConstant::MAX_WATERMARK_FLUSH_THRESHOLD) {
+        LOGE("[Syncer] Invalid watermark flush threshold %" PRIu32, threshold);
+        return -E_INVALID_ARGS;
+    }
+    std::lock_guard<std::mutex> lock(syncerLock_);
+    waterMarkFlushThreshold_ = threshold;
+    if (metadata_ != nullptr) {
+        metadata_->SetWaterMarkFlushThreshold(threshold);
+    }
+    return E_OK;
+}
+
 int GenericSyncer::GetSyncDataSize(const std::string &device, size_t &size) const
 {
     uint64_t localWaterMark = 0;
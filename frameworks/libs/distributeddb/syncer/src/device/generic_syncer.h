@@ -113,6 +113,8 @@ public:
 
     int UpgradeSchemaVerInMeta() override;
 
+    int SetWaterMarkFlushThreshold(uint32_t threshold) override;
+
     void ResetSyncStatus() override;
 
     int64_t GetLocalTimeOffset() override;
@@ -238,6 +240,7 @@ protected:
     bool closing_;
     mutable std::mutex queuedManualSyncLock_;
     mutable std::mutex syncerLock_;
+    uint32_t waterMarkFlushThreshold_ = 0;
     std::string label_;
     std::mutex engineMutex_;
     bool engineFinalize_;
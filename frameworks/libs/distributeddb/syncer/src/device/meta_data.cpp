@@ -21,6 +21,7 @@
 #include "db_constant.h"
 #include "db_errno.h"
 #include "hash.h"
+#include "hash_identifier_cache.h"
 #include "log_print.h"
 #include "platform_specific.h"
 #include "securec.h"
@@ -102,9 +103,14 @@ int Metadata::SaveLocalWaterMark(const DeviceID &deviceId, const DeviceID &userI
     MetaDataValue metadata;
     std::lock_guard<std::mutex> lockGuard(metadataLock_);
     GetMetaDataValue(deviceId, userId, metadata, true);
+    bool isAdvance = (inValue >= metadata.localWaterMark);
     metadata.localWaterMark = inValue;
     LOGD("Metadata::SaveLocalWaterMark = %" PRIu64, inValue);
-    return SaveMetaDataValue(deviceId, userId, metadata);
+    DeviceID hashDeviceId;
+    GetHashDeviceId(deviceId, userId, hashDeviceId, true);
+    Key key;
+    DBCommon::StringToVector(hashDeviceId, key);
+    return SaveWaterMarkValue(key, metadata, isAdvance);
 }
 
 void Metadata::GetPeerWaterMark(const DeviceID &deviceId, const DeviceID &userId, uint64_t &outValue, bool isNeedHash)
@@ -136,14 +142,10 @@ int Metadata::SavePeerWaterMark(const DeviceID &deviceId, const DeviceID &userId
     }
 
     for (auto &oneMetadata : metadata) {
+        bool isAdvance = (inValue >= oneMetadata.second.peerWaterMark);
         oneMetadata.second.peerWaterMark = inValue;
         LOGD("Metadata::SavePeerWaterMark = %" PRIu64, inValue);
-        Value metadataValue;
-        errCode = SerializeMetaData(oneMetadata.second, metadataValue);
-        if (errCode != E_OK) {
-            return errCode;
-        }
-        errCode = SetMetadataToDb(oneMetadata.first, metadataValue);
+        errCode = SaveWaterMarkValue(oneMetadata.first, oneMetadata.second, isAdvance);
         if (errCode != E_OK) {
             return errCode;
         }
@@ -241,10 +243,82 @@ int Metadata::SaveMetaDataValue(const DeviceID &deviceId, const DeviceID &userId
     errCode = SetMetadataToDb(key, value);
     if (errCode != E_OK) {
         LOGE("Metadata::SetMetadataToDb failed errCode:%d", errCode);
+        return errCode;
     }
+    // the value is read with the watermark in memory, no need to save it again
+    pendingMetaData_.erase(key);
     return errCode;
 }
 
+int Metadata::SaveWaterMarkValue(const Key &key, const MetaDataValue &inValue, bool isAdvance)
+{
+    // the decrease of watermark is saved into db at once, otherwise the data might not be resent after crash
+    if (waterMarkFlushThreshold_ == 0 || !isAdvance) {
+        Value value;
+        int errCode = SerializeMetaData(inValue, value);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        errCode = SetMetadataToDb(key, value);
+        if (errCode != E_OK) {
+            LOGE("[Metadata] Save watermark failed errCode:%d", errCode);
+            return errCode;
+        }
+        pendingMetaData_.erase(key);
+        return E_OK;
+    }
+    pendingMetaData_[key] = inValue;
+    pendingUpdateCount_++;
+    if (pendingUpdateCount_ < waterMarkFlushThreshold_) {
+        return E_OK;
+    }
+    return FlushWaterMarkInner();
+}
+
+int Metadata::FlushWaterMarkInner()
+{
+    if (pendingMetaData_.empty()) {
+        pendingUpdateCount_ = 0;
+        return E_OK;
+    }
+    if (naturalStoragePtr_ == nullptr) {
+        return -E_INVALID_DB;
+    }
+    std::map<Key, Value> data;
+    for (const auto &[key, metaData] : pendingMetaData_) {
+        Value value;
+        int errCode = SerializeMetaData(metaData, value);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        data[key] = std::move(value);
+    }
+    int errCode = naturalStoragePtr_->PutMetaDataBatch(data);
+    if (errCode != E_OK) {
+        LOGE("[Metadata] Flush %zu watermark failed errCode:%d", data.size(), errCode);
+        return errCode;
+    }
+    LOGD("[Metadata] Flush %zu watermark after %" PRIu32 " update", data.size(), pendingUpdateCount_);
+    pendingMetaData_.clear();
+    pendingUpdateCount_ = 0;
+    return E_OK;
+}
+
+void Metadata::SetWaterMarkFlushThreshold(uint32_t threshold)
+{
+    std::lock_guard<std::mutex> lockGuard(metadataLock_);
+    waterMarkFlushThreshold_ = threshold;
+    if (threshold == 0) {
+        (void)FlushWaterMarkInner();
+    }
+}
+
+int Metadata::FlushWaterMark()
+{
+    std::lock_guard<std::mutex> lockGuard(metadataLock_);
+    return FlushWaterMarkInner();
+}
+
 int Metadata::GetMetaDataValue(const DeviceID &deviceId, const DeviceID &userId, MetaDataValue &outValue,
     bool isNeedHash)
 {
@@ -370,14 +444,8 @@ void Metadata::GetHashDeviceId(const DeviceID &deviceId, const DeviceID &userId,
         hashDeviceId = DBConstant::DEVICEID_PREFIX_KEY + deviceId + DBConstant::USERID_PREFIX_KEY + userId;
         return;
     }
-    DeviceSyncTarget deviceInfo(deviceId, userId);
-    if (deviceIdToHashDeviceIdMap_.count(deviceInfo) == 0) {
-        hashDeviceId = DBConstant::DEVICEID_PREFIX_KEY + DBCommon::TransferHashString(deviceId) +
-            DBConstant::USERID_PREFIX_KEY + userId;
-        deviceIdToHashDeviceIdMap_.insert(std::pair<DeviceSyncTarget, DeviceID>(deviceInfo, hashDeviceId));
-    } else {
-        hashDeviceId = deviceIdToHashDeviceIdMap_[deviceInfo];
-    }
+    hashDeviceId = DBConstant::DEVICEID_PREFIX_KEY + HashIdentifierCache::GetInstance().GetHashString(deviceId) +
+        DBConstant::USERID_PREFIX_KEY + userId;
 }
 
 int Metadata::GetRecvQueryWaterMark(const std::string &queryIdentify,
@@ -689,6 +757,10 @@ int Metadata::ClearAllMetaDataValue(uint32_t innerClearAction)
     }
 
     std::lock_guard<std::mutex> lockGuard(metadataLock_);
+    // watermark in memory might not be saved in db yet
+    for (auto &pending : pendingMetaData_) {
+        ClearMetaDataValue(innerClearAction, pending.second);
+    }
     for (const auto &deviceId : metaDataKeys) {
         if (!IsMetaDataKey(deviceId, DBConstant::DEVICEID_PREFIX_KEY)) {
             continue;
@@ -718,6 +790,8 @@ int Metadata::ClearAllMetaDataValue(uint32_t innerClearAction)
             LOGW("[Metadata][ClearAllMetaDataValue] action %" PRIu32 " save meta data failed %d", innerClearAction,
                 innerErrCode);
             errCode = errCode == E_OK ? innerErrCode : errCode;
+        } else {
+            pendingMetaData_.erase(deviceId);
         }
     }
     if (errCode == E_OK) {
@@ -997,6 +1071,11 @@ int Metadata::GetMetaDataValueFromDB(const std::string &deviceId, const std::str
 
 int Metadata::GetMetaDataValueFromDB(const Key &key, MetaDataValue &metaDataValue)
 {
+    auto iter = pendingMetaData_.find(key);
+    if (iter != pendingMetaData_.end()) {
+        metaDataValue = iter->second;
+        return E_OK;
+    }
     std::vector<uint8_t> value;
     int errCode = GetMetadataFromDb(key, value);
     if (errCode != E_OK) {
@@ -1016,12 +1095,7 @@ int Metadata::GetMetaDataFromDBByPrefixKey(const std::string &deviceId, bool isN
 
     std::map<Key, Value> data;
     int errCode = GetMetadataFromDbByPrefixKey(keyPrefix, data);
-    if (errCode != E_OK) {
-        if (errCode == -E_NOT_FOUND) {
-            MetaDataValue oneMetaData;
-            metaData[keyPrefix] = oneMetaData;
-            return E_OK;
-        }
+    if (errCode != E_OK && errCode != -E_NOT_FOUND) {
         LOGE("[Metadata] Get metadata from db by prefix key failed %d", errCode);
         return errCode;
     }
@@ -1034,6 +1108,18 @@ int Metadata::GetMetaDataFromDBByPrefixKey(const std::string &deviceId, bool isN
         }
         metaData[oneData.first] = metaDataValue;
     }
+    // watermark in memory is newer than db
+    for (auto iter = pendingMetaData_.lower_bound(keyPrefix); iter != pendingMetaData_.end(); ++iter) {
+        if (iter->first.size() < keyPrefix.size() ||
+            !std::equal(keyPrefix.begin(), keyPrefix.end(), iter->first.begin())) {
+            break;
+        }
+        metaData[iter->first] = iter->second;
+    }
+    if (metaData.empty()) {
+        MetaDataValue oneMetaData;
+        metaData[keyPrefix] = oneMetaData;
+    }
     return E_OK;
 }
 
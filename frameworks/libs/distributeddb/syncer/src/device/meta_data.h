@@ -182,11 +182,24 @@ public:
     uint64_t GetRemoteSoftwareVersion(const std::string &deviceId, const std::string &userId);
 
     int SetRemoteSoftwareVersion(const std::string &deviceId, const std::string &userId, uint64_t version);
+
+    // Local and peer watermark are kept in memory and saved into db in one transaction after threshold updates,
+    // 0 means save every update into db directly. After crash the watermark in db may be older than the data,
+    // which only cause data resend.
+    void SetWaterMarkFlushThreshold(uint32_t threshold);
+
+    // Save the watermark kept in memory into db
+    int FlushWaterMark();
 private:
 
     int SaveMetaDataValue(const DeviceID &deviceId, const DeviceID &userId, const MetaDataValue &inValue,
         bool isNeedHash = true);
 
+    // only the advance of watermark is kept in memory when write behind is enabled, others are saved into db
+    int SaveWaterMarkValue(const Key &key, const MetaDataValue &inValue, bool isAdvance);
+
+    int FlushWaterMarkInner();
+
     // sync module need hash devices id
     int GetMetaDataValue(const DeviceID &deviceId, const DeviceID &userId, MetaDataValue &outValue, bool isNeedHash);
 
@@ -257,7 +270,10 @@ private:
     // if changed, it should be locked from save-to-db to change-in-memory.save to db must be first,
     // if save to db fail, it will not be changed in memory.
     mutable std::mutex metadataLock_;
-    std::map<DeviceSyncTarget, DeviceID> deviceIdToHashDeviceIdMap_;
+    // watermark not saved into db yet, guarded by metadataLock_
+    std::map<Key, MetaDataValue> pendingMetaData_;
+    uint32_t pendingUpdateCount_ = 0;
+    uint32_t waterMarkFlushThreshold_ = 0;
 
     // store localTimeOffset in ram, used to make timestamp increase
     mutable std::mutex lastLocalTimeLock_;
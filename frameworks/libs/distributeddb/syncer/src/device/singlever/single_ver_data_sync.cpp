@@ -18,6 +18,7 @@
 #include "db_common.h"
 #include "db_types.h"
 #include "generic_single_ver_kv_entry.h"
+#include "hash_identifier_cache.h"
 #include "intercepted_data_impl.h"
 #include "log_print.h"
 #include "message_transform.h"
@@ -299,7 +300,7 @@ int SingleVerDataSync::GetData(SingleVerSyncTaskContext *context, size_t packetS
         LOGD("[DataSync][GetData] not finished.");
     }
     if (SingleVerDataSyncUtils::IsGetDataSuccessfully(errCode)) {
-        std::string localHashName = DBCommon::TransferHashString(GetLocalDeviceName());
+        std::string localHashName = HashIdentifierCache::GetInstance().GetHashString(GetLocalDeviceName());
         SingleVerDataSyncUtils::TransDbDataItemToSendDataItem(localHashName, outData);
     }
     return errCode;
@@ -413,7 +414,7 @@ int SingleVerDataSync::SaveData(const SingleVerSyncTaskContext *context, const s
         performance->StepTimeRecordStart(PT_TEST_RECORDS::RECORD_SAVE_DATA);
     }
     const auto localDeviceName = GetLocalDeviceName();
-    const std::string localHashName = DBCommon::TransferHashString(localDeviceName);
+    const std::string localHashName = HashIdentifierCache::GetInstance().GetHashString(localDeviceName);
     SingleVerDataSyncUtils::TransSendDataItemToLocal(context, localHashName, inData);
     std::vector<SendDataItem> copyData = inData;
     int errCode = storage_->InterceptData(copyData, GetDeviceId(), localDeviceName, false);
@@ -1034,6 +1035,9 @@ int SingleVerDataSync::DataRequestRecvInner(SingleVerSyncTaskContext *context, c
     RemotePushFinished(packet->GetSendCode(), packet->GetMode(), message->GetSessionId(),
         context->GetRequestSessionId());
     UpdatePeerWaterMarkInner(*packet, dataTime, isUpdateWaterMark, context);
+    if (packet->IsLastSequence() && metadata_ != nullptr) {
+        (void)metadata_->FlushWaterMark();
+    }
     context->RefreshSaveTime(packet->IsLastSequence());
     if (errCode != E_OK) {
         return errCode;
@@ -277,6 +277,9 @@ void SingleVerSyncStateMachine::AbortInner()
         dataSync_->ClearDataMsg();
     }
     dataSync_->ClearSyncStatus();
+    if (metadata_ != nullptr) {
+        (void)metadata_->FlushWaterMark();
+    }
     ContinueToken token;
     context_->GetContinueToken(token);
     if (token != nullptr) {
@@ -559,6 +562,9 @@ Event SingleVerSyncStateMachine::DoSyncTaskFinished()
         return TransformErrCodeToEvent(-E_OUT_OF_MEMORY);
     }
     dataSync_->ClearSyncStatus();
+    if (metadata_ != nullptr) {
+        (void)metadata_->FlushWaterMark();
+    }
     auto timeout = communicator_->GetTimeout(syncContext_->GetDeviceId());
     RefObject::AutoLock lock(syncContext_);
     int errCode = ExecNextTask(timeout);
@@ -425,7 +425,8 @@ std::set<CompressAlgorithm> SingleVerSyncTaskContext::GetRemoteCompressAlgo() co
 
 std::string SingleVerSyncTaskContext::GetRemoteCompressAlgoStr() const
 {
-    static std::map<CompressAlgorithm, std::string> algoMap = {{CompressAlgorithm::ZLIB, "zlib"}};
+    static std::map<CompressAlgorithm, std::string> algoMap = {
+        {CompressAlgorithm::ZLIB, "zlib"}, {CompressAlgorithm::LZ4, "lz4"}, {CompressAlgorithm::ZSTD, "zstd"}};
     std::set<CompressAlgorithm> remoteCompressAlgoSet = GetRemoteCompressAlgo();
     if (remoteCompressAlgoSet.empty()) {
         return "none";
@@ -471,6 +472,14 @@ CompressAlgorithm SingleVerSyncTaskContext::ChooseCompressAlgo() const
     if (algoIntersection.empty()) {
         return CompressAlgorithm::NONE;
     }
+    // Prefer the faster one, compression usually costs more time than sending on the sync thread
+    static const std::vector<CompressAlgorithm> algoPriority = {
+        CompressAlgorithm::LZ4, CompressAlgorithm::ZSTD, CompressAlgorithm::ZLIB};
+    for (const auto &algo : algoPriority) {
+        if (algoIntersection.count(algo) != 0) {
+            return algo;
+        }
+    }
     return *(algoIntersection.begin());
 }
 
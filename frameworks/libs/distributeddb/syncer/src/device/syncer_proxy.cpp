@@ -264,6 +264,14 @@ int SyncerProxy::UpgradeSchemaVerInMeta()
     return syncer_->UpgradeSchemaVerInMeta();
 }
 
+int SyncerProxy::SetWaterMarkFlushThreshold(uint32_t threshold)
+{
+    if (syncer_ == nullptr) {
+        return -E_NOT_INIT;
+    }
+    return syncer_->SetWaterMarkFlushThreshold(threshold);
+}
+
 void SyncerProxy::ResetSyncStatus()
 {
     if (syncer_ == nullptr) {
@@ -31,6 +31,7 @@ namespace {
     constexpr int64_t MAX_TIME_OFFSET_NOISE = 1 * 1000 * 10000; // 1 second in 100-nanosecond units
     constexpr int64_t MAX_TIME_RTT_NOISE = 1 * 1000 * 10000; // 1 second in 100-nanosecond units
     constexpr uint64_t RTT_NOISE_CHECK_INTERVAL = 30 * 60 * 1000 * 10000u; // 30 minute in 100-nanosecond units
+    constexpr uint64_t DEVICE_TIME_INFO_TTL = 24 * 60 * 60 * 1000 * 10000ull; // 24h in 100-nanosecond units
 }
 
 // Class TimeSyncPacket
@@ -513,6 +514,10 @@ int TimeSync::TimeSyncDriver(TimerId timerId)
     if (!isOnline_) {
         return E_OK;
     }
+    if (IsDeviceTimeInfoValid()) {
+        LOGD("[TimeSync][TimeSyncDriver] offset is synced by other db, skip, dev=%.3s", deviceId_.c_str());
+        return E_OK;
+    }
     std::lock_guard<std::mutex> lock(timeDriverLock_);
     if (timeDriverTaskId_ != DBConstant::INVALID_TASK_ID) {
         LOGI("[TimeSync][TimeSyncDriver] task pending ID:%" PRIu64, timeDriverTaskId_);
@@ -783,6 +788,10 @@ bool TimeSync::CheckSkipTimeSync(const DeviceTimeInfo &info)
         return false;
     }
     uint64_t interval = timeHelper_->GetSysCurrentTime() - info.recordTime;
+    if (interval > DEVICE_TIME_INFO_TTL) {
+        LOGI("[TimeSync] offset cache is expired, interval is %" PRIu64, interval);
+        return false;
+    }
     if (info.rtt < MAX_TIME_RTT_NOISE) {
         return true;
     }
@@ -811,7 +820,9 @@ void TimeSync::SetTimeSyncFinishIfNeed()
     }
     int64_t systemTimeOffset = metadata_->GetSystemTimeOffset(deviceId_, userId_);
     LOGD("[TimeSync] Check db offset %" PRId64 " cache offset %" PRId64, systemTimeOffset, info.systemTimeOffset);
-    if (!CheckSkipTimeSync(info) || (IsNeedSync() &&
+    // the cache is cleared whenever the offset is found invalid, so it is newer than the offset in db,
+    // high version remote check the offset in data packet, other db in this process can reuse it without time sync
+    if (!CheckSkipTimeSync(info) || (IsNeedSync() && IsRemoteLowVersion(SOFTWARE_VERSION_RELEASE_9_0) &&
         std::abs(systemTimeOffset - info.systemTimeOffset) >= MAX_TIME_OFFSET_NOISE)) {
         SetTimeSyncFinishInner(false);
         return;
@@ -828,6 +839,15 @@ void TimeSync::SetTimeSyncFinishIfNeed()
     LOGI("[TimeSync] Mark time sync finish success");
 }
 
+bool TimeSync::IsDeviceTimeInfoValid()
+{
+    if (IsRemoteLowVersion(SOFTWARE_VERSION_RELEASE_9_0)) {
+        return false;
+    }
+    auto [errCode, info] = RuntimeContext::GetInstance()->GetDeviceTimeInfo(deviceId_);
+    return errCode == E_OK && CheckSkipTimeSync(info);
+}
+
 void TimeSync::ClearTimeSyncFinish()
 {
     RuntimeContext::GetInstance()->ClearDeviceTimeInfo(deviceId_);
@@ -147,6 +147,9 @@ protected:
 
     bool CheckSkipTimeSync(const DeviceTimeInfo &info);
 
+    // offset of remote is synced by any db in this process recently
+    bool IsDeviceTimeInfoValid();
+
     void SetTimeSyncFinishInner(bool finish);
 
     static TimeOffset CalculateRawTimeOffset(const TimeSyncPacket &timeSyncInfo, TimeOffset deltaTime);
@@ -19,14 +19,20 @@ const AbilityItem SyncConfig::DATABASE_COMPRESSION_ZLIB = {0, 1};
 const AbilityItem SyncConfig::ALLPREDICATEQUERY = {1, 1}; // 0b10 {1: start at second bit, 1: 1 bit len}
 const AbilityItem SyncConfig::SUBSCRIBEQUERY = {2, 1}; //   0b100
 const AbilityItem SyncConfig::INKEYS_QUERY = {3, 1}; //    0b1000
+const AbilityItem SyncConfig::DATABASE_COMPRESSION_LZ4 = {4, 1}; //   0b10000
+const AbilityItem SyncConfig::DATABASE_COMPRESSION_ZSTD = {5, 1}; //  0b100000
 
 const std::vector<AbilityItem> SyncConfig::ABILITYBITS = {
     DATABASE_COMPRESSION_ZLIB,
     ALLPREDICATEQUERY,
     SUBSCRIBEQUERY,
-    INKEYS_QUERY};
+    INKEYS_QUERY,
+    DATABASE_COMPRESSION_LZ4,
+    DATABASE_COMPRESSION_ZSTD};
 
 const std::map<const uint8_t, const AbilityItem> SyncConfig::COMPRESSALGOMAP = {
     {static_cast<uint8_t>(CompressAlgorithm::ZLIB), DATABASE_COMPRESSION_ZLIB},
+    {static_cast<uint8_t>(CompressAlgorithm::LZ4), DATABASE_COMPRESSION_LZ4},
+    {static_cast<uint8_t>(CompressAlgorithm::ZSTD), DATABASE_COMPRESSION_ZSTD},
 };
 } // DistributedDB
\ No newline at end of file
@@ -30,8 +30,10 @@ using AbilityItem = std::pair<uint32_t, uint32_t>;
 /*
 if need to add new ability, just add append to the last ability
 current ability format:
-|first bit|second bit|third bit|
-|DATABASE_COMPRESSION_ZLIB|ALLPREDICATEQUERY|SUBSCRIBEQUERY|
+|first bit|second bit|third bit|fourth bit|
+|DATABASE_COMPRESSION_ZLIB|ALLPREDICATEQUERY|SUBSCRIBEQUERY|INKEYS_QUERY|
+|fifth bit|sixth bit|
+|DATABASE_COMPRESSION_LZ4|DATABASE_COMPRESSION_ZSTD|
 */
 class SyncConfig final {
 public:
@@ -39,6 +41,8 @@ public:
     static const AbilityItem ALLPREDICATEQUERY;
     static const AbilityItem SUBSCRIBEQUERY;
     static const AbilityItem INKEYS_QUERY;
+    static const AbilityItem DATABASE_COMPRESSION_LZ4;
+    static const AbilityItem DATABASE_COMPRESSION_ZSTD;
     static const std::vector<AbilityItem> ABILITYBITS;
     static const std::map<const uint8_t, const AbilityItem> COMPRESSALGOMAP;
 };
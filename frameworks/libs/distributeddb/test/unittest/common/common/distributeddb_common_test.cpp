@@ -20,6 +20,7 @@
 #include "db_errno.h"
 #include "db_common.h"
 #include "data_compression.h"
+#include "hash_identifier_cache.h"
 #include "distributeddb_data_generate_unit_test.h"
 #include "kvdb_manager.h"
 #include "kvdb_properties.h"
@@ -775,22 +776,30 @@ HWTEST_F(DistributedDBCommonTest, LockStatusObserverTest, TestSize.Level1)
 HWTEST_F(DistributedDBCommonTest, TaskQueueTest, TestSize.Level1)
 {
     /**
-     * @tc.steps: step1. Create TaskQueue object whose para is true.
-     * @tc.expected: step1. Create success.
+     * @tc.steps: step1. Create TaskQueue object and put empty task.
+     * @tc.expected: step1. Empty task is ignored.
      */
-    TaskQueue taskObj1(true);
+    TaskQueue taskObj1;
     const Task task1;
-    taskObj1.PutTask(task1);
-    EXPECT_EQ(taskObj1.IsEmptyAndUnlocked(), true);
-    EXPECT_EQ(taskObj1.CanGetTask(), false);
+    EXPECT_EQ(taskObj1.PutTask(task1), false);
+    EXPECT_EQ(taskObj1.IsEmptyAndIdle(), true);
+    EXPECT_EQ(taskObj1.GetTask().task, nullptr);
 
     /**
-     * @tc.steps: step2. Create TaskQueue object whose para is false.
-     * @tc.expected: step2. Create success.
+     * @tc.steps: step2. Put two tasks and run them one by one.
+     * @tc.expected: step2. Only the first put need schedule the queue, queue become idle after all tasks finished.
      */
-    TaskQueue taskObj2(false);
-    EXPECT_EQ(taskObj2.IsEmptyAndUnlocked(), true);
-    EXPECT_EQ(taskObj2.CanGetTask(), false);
+    TaskQueue taskObj2;
+    const Task task2 = []() {};
+    EXPECT_EQ(taskObj2.PutTask(task2), true);
+    EXPECT_EQ(taskObj2.PutTask(task2), false);
+    EXPECT_EQ(taskObj2.GetTaskCount(), 2u);
+    EXPECT_NE(taskObj2.GetTask().task, nullptr);
+    EXPECT_EQ(taskObj2.FinishTask(), true);
+    EXPECT_NE(taskObj2.GetTask().task, nullptr);
+    EXPECT_EQ(taskObj2.IsEmptyAndIdle(), false);
+    EXPECT_EQ(taskObj2.FinishTask(), false);
+    EXPECT_EQ(taskObj2.IsEmptyAndIdle(), true);
 }
 
 /**
@@ -1380,4 +1389,92 @@ HWTEST_F(DistributedDBCommonTest, CleanConcurrent001, TestSize.Level0)
     }
     RuntimeConfig::Clean();
 }
+
+/**
+ * @tc.name: HashIdentifierCache001
+ * @tc.desc: Test hash identifier cache only calculate hash once for each identifier
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommonTest, HashIdentifierCache001, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. get hash of 3 devices for 4000 times
+     * @tc.expected: step1. result is same as TransferHashString
+     */
+    auto &cache = HashIdentifierCache::GetInstance();
+    cache.Clear();
+    const std::vector<std::string> devices = {"DEVICE_A", "DEVICE_B", "DEVICE_C"};
+    const int itemCount = 4000;
+    for (int i = 0; i < itemCount; ++i) {
+        const std::string &device = devices[i % devices.size()];
+        EXPECT_EQ(cache.GetHashString(device), DBCommon::TransferHashString(device));
+    }
+    EXPECT_EQ(cache.GetHashString(""), "");
+    /**
+     * @tc.steps: step2. check statistics
+     * @tc.expected: step2. hash is calculated once for each device
+     */
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    cache.GetStatistics(hitCount, missCount);
+    EXPECT_EQ(missCount, devices.size());
+    EXPECT_EQ(hitCount, itemCount - devices.size());
+    cache.Clear();
+}
+
+/**
+ * @tc.name: CalcValueHashBatch001
+ * @tc.desc: Test batch hash result is same as scalar hash, and compare the cost of 128 entries batch
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommonTest, CalcValueHashBatch001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. calc hash of 128 keys with batch api and scalar api
+     * @tc.expected: step1. result is same, nullptr get empty hash
+     */
+    const size_t batchSize = 128;
+    std::vector<Key> keys;
+    for (size_t i = 0; i < batchSize; ++i) {
+        std::string keyStr = "KEY_" + std::to_string(i);
+        keys.emplace_back(keyStr.begin(), keyStr.end());
+    }
+    std::vector<const Key *> keyPtrs;
+    for (const auto &key : keys) {
+        keyPtrs.push_back(&key);
+    }
+    keyPtrs.push_back(nullptr);
+    std::vector<Key> hashKeys;
+    EXPECT_EQ(DBCommon::CalcValueHashBatch(keyPtrs, hashKeys), E_OK);
+    ASSERT_EQ(hashKeys.size(), batchSize + 1);
+    for (size_t i = 0; i < batchSize; ++i) {
+        Key hashKey;
+        EXPECT_EQ(DBCommon::CalcValueHash(keys[i], hashKey), E_OK);
+        EXPECT_EQ(hashKeys[i], hashKey);
+    }
+    EXPECT_TRUE(hashKeys[batchSize].empty());
+    keyPtrs.pop_back();
+    /**
+     * @tc.steps: step2. compare the cost of batch api and scalar api
+     * @tc.expected: step2. both succeed
+     */
+    const int loopCount = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loopCount; ++loop) {
+        for (const auto &key : keys) {
+            Key hashKey;
+            EXPECT_EQ(DBCommon::CalcValueHash(key, hashKey), E_OK);
+        }
+    }
+    auto scalarCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loopCount; ++loop) {
+        EXPECT_EQ(DBCommon::CalcValueHashBatch(keyPtrs, hashKeys), E_OK);
+    }
+    auto batchCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    LOGI("[CalcValueHashBatch001] %zu entries * %d, scalar cost %" PRId64 "us, batch cost %" PRId64 "us", batchSize,
+        loopCount, static_cast<int64_t>(scalarCost.count()), static_cast<int64_t>(batchCost.count()));
+}
 }
\ No newline at end of file
@@ -18,9 +18,17 @@
 
 #include "distributeddb_tools_unit_test.h"
 #include "data_compression.h"
+#include "generic_single_ver_kv_entry.h"
+#include "version.h"
 #ifndef OMIT_ZLIB
 #include "zlib_compression.h"
 #endif
+#ifdef USE_DISTRIBUTEDDB_LZ4
+#include "lz4_compression.h"
+#endif
+#ifdef USE_DISTRIBUTEDDB_ZSTD
+#include "zstd_compression.h"
+#endif
 
 using namespace testing::ext;
 using namespace DistributedDB;
@@ -86,6 +94,18 @@ void DistributedDBDataCompressionTest::SetUpTestCase(void)
         zlibComp.reset(new ZlibCompression());
     }
 #endif
+#ifdef USE_DISTRIBUTEDDB_LZ4
+    static std::unique_ptr<Lz4Compression> lz4Comp;
+    if (DataCompression::GetInstance(CompressAlgorithm::LZ4) == nullptr) {
+        lz4Comp.reset(new Lz4Compression());
+    }
+#endif
+#ifdef USE_DISTRIBUTEDDB_ZSTD
+    static std::unique_ptr<ZstdCompression> zstdComp;
+    if (DataCompression::GetInstance(CompressAlgorithm::ZSTD) == nullptr) {
+        zstdComp.reset(new ZstdCompression());
+    }
+#endif
 }
 
 void DistributedDBDataCompressionTest::TearDownTestCase(void)
@@ -213,3 +233,100 @@ HWTEST_F(DistributedDBDataCompressionTest, DataCompression3, TestSize.Level1)
         compressedData, uncompressedData, incorrectLen), -E_INVALID_ARGS);
 #endif // OMIT_ZLIB
 }
+
+/**
+  * @tc.name: DataCompression4
+  * @tc.desc: To test the data compressed by stream piece by piece can be uncompressed by all algorithms.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBDataCompressionTest, DataCompression4, TestSize.Level1)
+{
+#ifndef OMIT_ZLIB
+    vector<uint8_t> srcData(g_srcStr, g_srcStr + sizeof(g_srcStr));
+    std::set<CompressAlgorithm> algorithmSet;
+    DataCompression::GetCompressionAlgo(algorithmSet);
+    EXPECT_FALSE(algorithmSet.empty());
+    for (const auto &algo : algorithmSet) {
+        auto *instance = DataCompression::GetInstance(algo);
+        ASSERT_NE(instance, nullptr);
+        /**
+         * @tc.steps:step1. Compress the source data by stream with 64 bytes each time.
+         * @tc.expected: step1. Compress successfully. Compressed data length is less than srcLen.
+         */
+        auto stream = instance->CreateCompressionStream(srcData.size());
+        ASSERT_NE(stream, nullptr);
+        const uint32_t pieceLen = 64;
+        for (uint32_t pos = 0; pos < srcData.size(); pos += pieceLen) {
+            uint32_t len = std::min(pieceLen, static_cast<uint32_t>(srcData.size() - pos));
+            EXPECT_EQ(stream->Append(srcData.data() + pos, len), E_OK);
+        }
+        vector<uint8_t> compressedData;
+        EXPECT_EQ(stream->Finish(compressedData), E_OK);
+        EXPECT_LT(compressedData.size(), srcData.size());
+
+        /**
+         * @tc.steps:step2. Uncompress the stream result and the result compressed at once.
+         * @tc.expected: step2. Uncompress successfully. Uncompressed data equals to source data.
+         */
+        vector<uint8_t> uncompressedData;
+        EXPECT_EQ(instance->Uncompress(compressedData, uncompressedData, srcData.size()), E_OK);
+        EXPECT_EQ(srcData, uncompressedData);
+        compressedData.clear();
+        uncompressedData.clear();
+        EXPECT_EQ(instance->Compress(srcData, compressedData), E_OK);
+        EXPECT_EQ(instance->Uncompress(compressedData, uncompressedData, srcData.size()), E_OK);
+        EXPECT_EQ(srcData, uncompressedData);
+    }
+#endif // OMIT_ZLIB
+}
+
+/**
+  * @tc.name: DataCompression5
+  * @tc.desc: To test the sync entries compressed while serializing can be uncompressed by all algorithms.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBDataCompressionTest, DataCompression5, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. Prepare the entries with different key and value length.
+     */
+    const int entryCount = 10;
+    std::vector<SingleVerKvEntry *> kvEntries;
+    for (int i = 0; i < entryCount; i++) {
+        auto entry = new (std::nothrow) GenericSingleVerKvEntry();
+        ASSERT_NE(entry, nullptr);
+        DataItem dataItem;
+        dataItem.key.assign(i + 1, 'k');
+        dataItem.value.assign((i + 1) * 10, 'v'); // 10 times length of key
+        dataItem.timestamp = static_cast<Timestamp>(i);
+        dataItem.origDev = "device" + std::to_string(i);
+        entry->SetEntryData(std::move(dataItem));
+        kvEntries.push_back(entry);
+    }
+    std::set<CompressAlgorithm> algorithmSet;
+    DataCompression::GetCompressionAlgo(algorithmSet);
+    for (const auto &algo : algorithmSet) {
+        /**
+         * @tc.steps:step2. Compress the entries and uncompress them.
+         * @tc.expected: step2. Uncompress successfully. The entries are the same as before.
+         */
+        CompressInfo compressInfo = { algo, SOFTWARE_VERSION_CURRENT };
+        std::vector<uint8_t> compressedData;
+        EXPECT_EQ(GenericSingleVerKvEntry::Compress(kvEntries, compressedData, compressInfo), E_OK);
+        uint32_t srcLen = GenericSingleVerKvEntry::CalculateLens(kvEntries, SOFTWARE_VERSION_CURRENT);
+        std::vector<SingleVerKvEntry *> uncompressedEntries;
+        EXPECT_EQ(GenericSingleVerKvEntry::Uncompress(compressedData, uncompressedEntries, srcLen, algo), E_OK);
+        ASSERT_EQ(uncompressedEntries.size(), kvEntries.size());
+        for (size_t i = 0; i < kvEntries.size(); i++) {
+            EXPECT_EQ(uncompressedEntries[i]->GetKey(), kvEntries[i]->GetKey());
+            EXPECT_EQ(uncompressedEntries[i]->GetValue(), kvEntries[i]->GetValue());
+            EXPECT_EQ(uncompressedEntries[i]->GetOrigDevice(), kvEntries[i]->GetOrigDevice());
+        }
+        SingleVerKvEntry::Release(uncompressedEntries);
+    }
+    SingleVerKvEntry::Release(kvEntries);
+}
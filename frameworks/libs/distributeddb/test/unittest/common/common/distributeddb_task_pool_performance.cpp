@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "db_errno.h"
+#include "distributeddb_tools_unit_test.h"
+#include "log_print.h"
+#include "task_pool.h"
+
+using namespace testing::ext;
+using namespace DistributedDB;
+using namespace DistributedDBUnitTest;
+
+namespace {
+    const int MAX_THREADS = 10;
+    const int MIN_THREADS = 1;
+    const int TASK_COUNT_PER_PRODUCER = 10000;
+    const int QUEUE_TAG_COUNT = 4;
+    const std::vector<int> PRODUCER_COUNTS = {1, 2, 4, 8, 16, 32};
+
+    void WaitTasksFinished(const std::atomic<int> &finishedCount, int expectCount)
+    {
+        while (finishedCount < expectCount) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+class DistributedDBTaskPoolPerfTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp();
+    void TearDown();
+protected:
+    TaskPool *taskPool_ = nullptr;
+};
+
+void DistributedDBTaskPoolPerfTest::SetUp()
+{
+    DistributedDBToolsUnitTest::PrintTestCaseInfo();
+    int errCode = E_OK;
+    taskPool_ = TaskPool::Create(MAX_THREADS, MIN_THREADS, errCode);
+    ASSERT_NE(taskPool_, nullptr);
+    ASSERT_EQ(taskPool_->Start(), E_OK);
+}
+
+void DistributedDBTaskPoolPerfTest::TearDown()
+{
+    if (taskPool_ != nullptr) {
+        taskPool_->Stop();
+        TaskPool::Release(taskPool_);
+    }
+}
+
+/**
+ * @tc.name: QueuedTaskOrder001
+ * @tc.desc: Test tasks with the same tag run one by one in schedule order when scheduled concurrently.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBTaskPoolPerfTest, QueuedTaskOrder001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. schedule tasks with several tags and generic tasks from several threads.
+     * @tc.expected: step1. tasks of one tag never run at the same time and keep the schedule order.
+     */
+    std::atomic<int> finishedCount = 0;
+    std::atomic<bool> isOrdered = true;
+    std::vector<std::atomic<int>> runningCount(QUEUE_TAG_COUNT);
+    std::vector<int> lastIndex(QUEUE_TAG_COUNT, -1);
+    std::vector<std::thread> producers;
+    for (int tag = 0; tag < QUEUE_TAG_COUNT; ++tag) {
+        producers.emplace_back([&, tag]() {
+            for (int i = 0; i < TASK_COUNT_PER_PRODUCER; ++i) {
+                EXPECT_EQ(taskPool_->Schedule(std::to_string(tag), [&, tag, i]() {
+                    if (runningCount[tag]++ != 0 || lastIndex[tag] + 1 != i) {
+                        isOrdered = false;
+                    }
+                    lastIndex[tag] = i;
+                    runningCount[tag]--;
+                    finishedCount++;
+                }), E_OK);
+                EXPECT_EQ(taskPool_->Schedule([&finishedCount]() {
+                    finishedCount++;
+                }), E_OK);
+            }
+        });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    WaitTasksFinished(finishedCount, QUEUE_TAG_COUNT * TASK_COUNT_PER_PRODUCER * 2); // 2 tasks each loop
+    EXPECT_TRUE(isOrdered);
+
+    /**
+     * @tc.steps: step2. check the counters.
+     * @tc.expected: step2. all tasks are counted and no task is waiting.
+     */
+    TaskPoolStatistic statistic;
+    taskPool_->GetStatistic(statistic);
+    EXPECT_EQ(statistic.executedTaskCount, static_cast<uint64_t>(finishedCount.load()));
+    EXPECT_EQ(statistic.genericTaskDepth, 0);
+    EXPECT_EQ(statistic.queuedTaskDepth, 0);
+    EXPECT_GE(statistic.totalWaitTimeUs, statistic.maxWaitTimeUs);
+}
+
+/**
+ * @tc.name: ScheduleThroughput001
+ * @tc.desc: Test tasks per second of the task pool with 1 to 32 producers.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBTaskPoolPerfTest, ScheduleThroughput001, TestSize.Level4)
+{
+    for (int producerCount : PRODUCER_COUNTS) {
+        /**
+         * @tc.steps: step1. schedule generic and queued tasks from producers concurrently.
+         * @tc.expected: step1. all tasks finished.
+         */
+        std::atomic<int> finishedCount = 0;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> producers;
+        for (int i = 0; i < producerCount; ++i) {
+            producers.emplace_back([this, i, &finishedCount]() {
+                std::string tag = std::to_string(i % QUEUE_TAG_COUNT);
+                for (int j = 0; j < TASK_COUNT_PER_PRODUCER; ++j) {
+                    auto task = [&finishedCount]() {
+                        finishedCount++;
+                    };
+                    EXPECT_EQ((j % 2 == 0) ? taskPool_->Schedule(task) : taskPool_->Schedule(tag, task), E_OK);
+                }
+            });
+        }
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        int totalCount = producerCount * TASK_COUNT_PER_PRODUCER;
+        WaitTasksFinished(finishedCount, totalCount);
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        /**
+         * @tc.steps: step2. print tasks per second and counters.
+         * @tc.expected: step2. print success.
+         */
+        TaskPoolStatistic statistic;
+        taskPool_->GetStatistic(statistic);
+        double tasksPerSecond = (cost.count() > 0) ? (totalCount * 1000000.0 / cost.count()) : 0;
+        LOGI("[TaskPoolPerf] producers:%d, tasks:%d, cost:%" PRId64 "us, tasks/sec:%.0f, threads:%d, stolen:%" PRIu64
+            ", avgWait:%" PRIu64 "us, maxWait:%" PRIu64 "us", producerCount, totalCount,
+            static_cast<int64_t>(cost.count()), tasksPerSecond, statistic.curThreads, statistic.stolenTaskCount,
+            statistic.executedTaskCount == 0 ? 0 : statistic.totalWaitTimeUs / statistic.executedTaskCount,
+            statistic.maxWaitTimeUs);
+    }
+}
@@ -13,9 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 #include "db_errno.h"
 #include "distributeddb_tools_unit_test.h"
@@ -61,6 +63,22 @@ EventTime TimerTester::GetCurrentTime()
     return now / 1000; // 1 ms equals to 1000 us
 }
 
+std::thread StartLoopThread()
+{
+    std::atomic<bool> running(false);
+    std::thread loopThread([&running]() {
+            running = true;
+            g_loop->Run();
+        });
+    int tryCounter = 1;
+    while (!running && tryCounter <= MAX_RETRY_TIMES) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(TIME_PIECE_1));
+        tryCounter++;
+    }
+    EXPECT_EQ(running, true);
+    return loopThread;
+}
+
 class DistributedDBEventLoopTimerTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -773,4 +791,107 @@ HWTEST_F(DistributedDBEventLoopTimerTest, EventTest008, TestSize.Level0)
     EXPECT_EQ(eventImpl->Dispatch(), -E_INVALID_ARGS);
     DistributedDB::RefObject::KillAndDecObjRef(eventImpl);
 }
+
+/**
+ * @tc.name: EventLoopTimerTest008
+ * @tc.desc: Test the timers are dispatched by their latest timeout point.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBEventLoopTimerTest, EventLoopTimerTest008, TestSize.Level1)
+{
+    ASSERT_NE(g_loop, nullptr);
+    std::thread loopThread = StartLoopThread();
+    /**
+     * @tc.steps: step1. Add two long timers, shorten the first one and detach the second one.
+     * @tc.expected: step1. Only the first timer is dispatched.
+     */
+    int errCode = E_OK;
+    IEvent *shortenTimer = IEvent::CreateEvent(TIME_PIECE_10000, errCode);
+    ASSERT_NE(shortenTimer, nullptr);
+    IEvent *detachTimer = IEvent::CreateEvent(TIME_PIECE_10000, errCode);
+    ASSERT_NE(detachTimer, nullptr);
+    std::atomic<int> shortenCounter(0);
+    std::atomic<int> detachCounter(0);
+    EXPECT_EQ(shortenTimer->SetAction([&shortenCounter](EventsMask revents) -> int {
+        ++shortenCounter;
+        return -E_STALE;
+    }, nullptr), E_OK);
+    EXPECT_EQ(detachTimer->SetAction([&detachCounter](EventsMask revents) -> int {
+        ++detachCounter;
+        return E_OK;
+    }, nullptr), E_OK);
+    EXPECT_EQ(g_loop->Add(shortenTimer), E_OK);
+    EXPECT_EQ(g_loop->Add(detachTimer), E_OK);
+    EXPECT_EQ(shortenTimer->SetTimeout(TIME_PIECE_10), E_OK);
+    EXPECT_EQ(detachTimer->Detach(true), E_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIME_PIECE_100 + TIME_INACCURACY));
+    EXPECT_EQ(shortenCounter, 1);
+    EXPECT_EQ(detachCounter, 0);
+    g_loop->KillObj();
+    loopThread.join();
+    RefObject::DecObjRef(shortenTimer);
+    RefObject::DecObjRef(detachTimer);
+}
+
+/**
+ * @tc.name: EventLoopTimerPerf001
+ * @tc.desc: Test the wake up latency of 10k concurrent timers.
+ * @tc.type: PERF
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBEventLoopTimerTest, EventLoopTimerPerf001, TestSize.Level4)
+{
+    ASSERT_NE(g_loop, nullptr);
+    std::thread loopThread = StartLoopThread();
+    /**
+     * @tc.steps: step1. Add 10k one-shot timers expired in 10ms to 1s.
+     * @tc.expected: step1. All the timers are dispatched.
+     */
+    const int timerCount = 10000; // 10k timers
+    const std::vector<EventTime> bucketBounds = {1, 2, 5, 10, 50}; // latency bucket bounds in ms
+    std::vector<std::atomic<int>> histogram(bucketBounds.size() + 1);
+    std::atomic<int> firedCount(0);
+    std::vector<IEvent *> timers;
+    for (int i = 0; i < timerCount; i++) {
+        EventTime timeout = TIME_PIECE_10 + i % TIME_PIECE_1000;
+        int errCode = E_OK;
+        IEvent *timer = IEvent::CreateEvent(timeout, errCode);
+        ASSERT_NE(timer, nullptr);
+        EventTime expected = TimerTester::GetCurrentTime() + timeout;
+        errCode = timer->SetAction([expected, &bucketBounds, &histogram, &firedCount](EventsMask revents) -> int {
+            EventTime latency = TimerTester::GetCurrentTime() - expected;
+            auto iter = std::upper_bound(bucketBounds.begin(), bucketBounds.end(), latency);
+            ++histogram[iter - bucketBounds.begin()];
+            ++firedCount;
+            return -E_STALE;
+        }, nullptr);
+        EXPECT_EQ(errCode, E_OK);
+        EXPECT_EQ(g_loop->Add(timer), E_OK);
+        timers.push_back(timer);
+    }
+    int tryCounter = 0;
+    while (firedCount < timerCount && tryCounter++ < MAX_RETRY_TIMES) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(TIME_PIECE_10));
+    }
+    EXPECT_EQ(firedCount, timerCount);
+    /**
+     * @tc.steps: step2. Print the latency histogram.
+     * @tc.expected: step2. OK.
+     */
+    for (size_t i = 0; i < histogram.size(); i++) {
+        if (i < bucketBounds.size()) {
+            LOGI("[EventLoopTimerPerf001] latency < %" PRId64 "ms: %d", bucketBounds[i], histogram[i].load());
+        } else {
+            LOGI("[EventLoopTimerPerf001] latency >= %" PRId64 "ms: %d", bucketBounds.back(), histogram[i].load());
+        }
+    }
+    g_loop->KillObj();
+    loopThread.join();
+    for (auto timer : timers) {
+        RefObject::DecObjRef(timer);
+    }
+}
 }
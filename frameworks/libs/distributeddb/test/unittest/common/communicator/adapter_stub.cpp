@@ -15,6 +15,7 @@
 
 #include "adapter_stub.h"
 #include <memory>
+#include <thread>
 #include "db_errno.h"
 #include "endian_convert.h"
 #include "frame_header.h"
@@ -81,6 +82,7 @@ int AdapterStub::SendBytes(const std::string &dstTarget, const uint8_t *bytes, u
 {
     LOGI("[UT][Stub][Send] Send length=%" PRIu32 " to dstTarget=%s begin.", length, dstTarget.c_str());
     ApplySendBlock();
+    ApplySendDelay(dstTarget);
 
     (void)totalLength;
     {
@@ -307,6 +309,16 @@ void AdapterStub::SimulateTriggerSendableCallback(const std::string &dstTarget,
     }
 }
 
+void AdapterStub::SimulateSendDelay(const std::string &dstTarget, uint32_t delayTimeMs)
+{
+    std::lock_guard<std::mutex> delayLockGuard(delayMutex_);
+    if (delayTimeMs == 0) {
+        targetDelayMap_.erase(dstTarget);
+        return;
+    }
+    targetDelayMap_[dstTarget] = delayTimeMs;
+}
+
 void AdapterStub::SimulateSendPartialLoss()
 {
     isPartialLossSimulated_ = true;
@@ -377,6 +389,20 @@ void AdapterStub::ApplySendBlock()
     LOGI("[UT][Stub][ApplyBlock] After Lock&UnLock.");
 }
 
+void AdapterStub::ApplySendDelay(const std::string &dstTarget)
+{
+    uint32_t delayTimeMs = 0;
+    {
+        std::lock_guard<std::mutex> delayLockGuard(delayMutex_);
+        auto iter = targetDelayMap_.find(dstTarget);
+        if (iter == targetDelayMap_.end()) {
+            return;
+        }
+        delayTimeMs = iter->second;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayTimeMs));
+}
+
 bool AdapterStub::QuerySendRetry(const std::string &dstTarget)
 {
     std::lock_guard<std::mutex> retryLockGuard(retryMutex_);
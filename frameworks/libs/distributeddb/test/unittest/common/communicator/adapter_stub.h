@@ -74,6 +74,9 @@ public:
     void SimulateSendRetryClear(const std::string &dstTarget, int deviceCommErrCode = E_OK);
     void SimulateTriggerSendableCallback(const std::string &dstTarget, int deviceCommErrCode = E_OK);
 
+    // Each packet send to dstTarget cost delayTimeMs, 0 means no delay
+    void SimulateSendDelay(const std::string &dstTarget, uint32_t delayTimeMs);
+
     void SimulateSendPartialLoss();
     void SimulateSendPartialLossClear();
 
@@ -99,6 +102,7 @@ private:
     void DeliverBytes(const std::string &srcTarget, const uint8_t *bytes, uint32_t length);
 
     void ApplySendBlock();
+    void ApplySendDelay(const std::string &dstTarget);
     bool QuerySendRetry(const std::string &dstTarget);
     bool QuerySendPartialLoss();
     bool QuerySendTotalLoss();
@@ -123,6 +127,9 @@ private:
     std::mutex retryMutex_;
     std::set<std::string> targetRetrySet_;
 
+    std::mutex delayMutex_;
+    std::map<std::string, uint32_t> targetDelayMap_;
+
     std::atomic<bool> isPartialLossSimulated_{false};
     std::atomic<uint64_t> countForPartialLoss_{0};
 
@@ -28,6 +28,7 @@
 #include "protocol_proto.h"
 #include "res_finalizer.h"
 #include "serial_buffer.h"
+#include "serial_buffer_pool.h"
 
 using namespace std;
 using namespace testing::ext;
@@ -1315,6 +1316,117 @@ HWTEST_F(DistributedDBCommunicatorDeepTest, SetExternalBuffTest003, TestSize.Lev
     externalBuff = nullptr;
 }
 
+/**
+ * @tc.name: SerialBufferPoolTest001
+ * @tc.desc: Test freed buffer is reused by next alloc of the same size class, and returned zeroed
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommunicatorDeepTest, SerialBufferPoolTest001, TestSize.Level2)
+{
+    /**
+     * @tc.steps: step1. alloc a buffer and fill it with non zero bytes, then release it
+     * @tc.expected: step1. alloc ok
+     */
+    SerialBufferPool::GetInstance().Clear();
+    uint32_t payloadLen = 3000; // 3000 bytes fall into the 4 KB class
+    uint32_t headerLen = 20;
+    auto *buffer = new (std::nothrow) SerialBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->AllocBufferByPayloadLength(payloadLen, headerLen), E_OK);
+    auto bytesLen = buffer->GetWritableBytesForEntireBuffer();
+    EXPECT_EQ(memset_s(bytesLen.first, bytesLen.second, 0xFF, bytesLen.second), EOK);
+    delete buffer;
+    buffer = nullptr;
+    SerialBufferPoolStat statBefore = SerialBufferPool::GetInstance().GetStat();
+    EXPECT_GT(statBefore.cachedBytes, 0u);
+
+    /**
+     * @tc.steps: step2. alloc a buffer of a near size
+     * @tc.expected: step2. the freed buffer is reused and all bytes are zero
+     */
+    SerialBuffer reusedBuffer;
+    ASSERT_EQ(reusedBuffer.AllocBufferByPayloadLength(payloadLen - 1, headerLen), E_OK);
+    SerialBufferPoolStat statAfter = SerialBufferPool::GetInstance().GetStat();
+    EXPECT_GT(statAfter.reuseCount, statBefore.reuseCount);
+    auto reusedBytesLen = reusedBuffer.GetReadOnlyBytesForEntireBuffer();
+    for (uint32_t i = 0; i < reusedBytesLen.second; i++) {
+        ASSERT_EQ(reusedBytesLen.first[i], 0u);
+    }
+}
+
+/**
+ * @tc.name: FragmentPacketTest001
+ * @tc.desc: Test fragments built lazily into a reused packet are the same as built one by one into new packets,
+ *     and they can be combined into the original frame, padding of last fragment included
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommunicatorDeepTest, FragmentPacketTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build a frame which is split into fragments and the last fragment needs padding
+     * @tc.expected: step1. build ok
+     */
+    const uint32_t mtu = 1024; // 1024 bytes mtu
+    const uint32_t payloadLen = 9765; // 9765 bytes payload makes all fragments not aligned by 8 bytes
+    SerialBuffer frame;
+    ASSERT_EQ(frame.AllocBufferByPayloadLength(payloadLen, sizeof(CommPhyHeader)), E_OK);
+    auto payloadBytesLen = frame.GetWritableBytesForPayload();
+    for (uint32_t i = 0; i < payloadBytesLen.second; i++) {
+        payloadBytesLen.first[i] = static_cast<uint8_t>(i % 251); // 251 makes bytes differ among fragments
+    }
+    PhyHeaderInfo info{1u, 1u, FrameType::APPLICATION_MESSAGE, false};
+    ASSERT_EQ(ProtocolProto::SetPhyHeader(&frame, info), E_OK);
+    uint16_t fragCount = 0;
+    ASSERT_EQ(ProtocolProto::GetFragmentCount(&frame, mtu, fragCount), E_OK);
+    ASSERT_GE(fragCount, 2u); // at least 2 fragments
+    uint32_t lastFragLen = payloadLen / fragCount + payloadLen % fragCount;
+    ASSERT_NE(BYTE_8_ALIGN(lastFragLen), lastFragLen);
+    /**
+     * @tc.steps: step2. build every fragment into a new packet, and into one reused packet filled with dirty bytes
+     * @tc.expected: step2. packets are byte-identical
+     */
+    std::vector<std::vector<uint8_t>> eagerPackets(fragCount);
+    for (uint16_t fragNo = 0; fragNo < fragCount; fragNo++) {
+        ASSERT_EQ(ProtocolProto::BuildFragmentPacket(&frame, fragCount, fragNo, eagerPackets[fragNo]), E_OK);
+    }
+    std::vector<uint8_t> reusedPacket(mtu, 0xFF); // 0xFF is dirty byte
+    for (uint16_t fragNo = 0; fragNo < fragCount; fragNo++) {
+        ASSERT_EQ(ProtocolProto::BuildFragmentPacket(&frame, fragCount, fragNo, reusedPacket), E_OK);
+        EXPECT_EQ(reusedPacket, eagerPackets[fragNo]);
+    }
+    /**
+     * @tc.steps: step3. parse every packet and combine them into a new frame
+     * @tc.expected: step3. sum check ok and combined frame is the same as original frame
+     */
+    SerialBuffer combinedFrame;
+    auto frameBytesLen = frame.GetReadOnlyBytesForEntireFrame();
+    ASSERT_EQ(combinedFrame.AllocBufferByTotalLength(frameBytesLen.second, sizeof(CommPhyHeader)), E_OK);
+    for (uint16_t fragNo = 0; fragNo < fragCount; fragNo++) {
+        const std::vector<uint8_t> &packet = eagerPackets[fragNo];
+        ParseResult result;
+        ASSERT_EQ(ProtocolProto::CheckAndParsePacket(DEVICE_NAME_A, packet.data(), packet.size(), result), E_OK);
+        EXPECT_TRUE(result.IsFragment());
+        EXPECT_EQ(result.GetFragNo(), fragNo);
+        EXPECT_EQ(result.GetFrameLen(), frameBytesLen.second);
+        uint32_t fragLen = 0;
+        uint32_t analyzedLastFragLen = 0;
+        ASSERT_EQ(ProtocolProto::AnalyzeSplitStructure(result, fragLen, analyzedLastFragLen), E_OK);
+        EXPECT_EQ(analyzedLastFragLen, lastFragLen);
+        uint32_t thisFragLen = (fragNo == fragCount - 1) ? analyzedLastFragLen : fragLen;
+        EXPECT_EQ(result.GetPaddingLen(), BYTE_8_ALIGN(thisFragLen) - thisFragLen);
+        ASSERT_EQ(ProtocolProto::CombinePacketIntoFrame(&combinedFrame, packet.data(), packet.size(),
+            fragLen * fragNo, thisFragLen), E_OK);
+    }
+    auto combinedBytesLen = combinedFrame.GetReadOnlyBytesForEntireFrame();
+    ASSERT_EQ(combinedBytesLen.second, frameBytesLen.second);
+    EXPECT_EQ(memcmp(combinedBytesLen.first + sizeof(CommPhyHeader), frameBytesLen.first + sizeof(CommPhyHeader),
+        frameBytesLen.second - sizeof(CommPhyHeader)), 0);
+}
+
 /**
  * @tc.name: SerialBufferCloneTest001
  * @tc.desc: Test invalid args of Clone function
@@ -1613,4 +1725,143 @@ HWTEST_F(DistributedDBCommunicatorDeepTest, SendFailed002, TestSize.Level0)
     EXPECT_EQ(aggregator->GetRetryCount(DEVICE_NAME_B, true), 0);
     EXPECT_EQ(aggregator->GetRetryCount(DEVICE_NAME_B, false), 0);
 }
+
+/**
+ * @tc.name: ParallelSendLane001
+ * @tc.desc: Test slow target not block send to other target
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommunicatorDeepTest, ParallelSendLane001, TestSize.Level2)
+{
+    // Preset
+    std::atomic<int> countForBB = 0;
+    g_commBB->RegOnMessageCallback([&countForBB](const std::string &srcTarget, Message *inMsg) {
+        countForBB++;
+        delete inMsg;
+        return E_OK;
+    }, nullptr);
+    std::atomic<int> countForCA = 0;
+    g_commCA->RegOnMessageCallback([&countForCA](const std::string &srcTarget, Message *inMsg) {
+        countForCA++;
+        delete inMsg;
+        return E_OK;
+    }, nullptr);
+
+    /**
+     * @tc.steps: step1. connect device A with device B and device C
+     */
+    AdapterStub::ConnectAdapterStub(g_envDeviceA.adapterHandle, g_envDeviceB.adapterHandle);
+    AdapterStub::ConnectAdapterStub(g_envDeviceA.adapterHandle, g_envDeviceC.adapterHandle);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200)); // Wait 200 ms to make sure quiet
+
+    /**
+     * @tc.steps: step2. device A simulate each send to device B cost 1s
+     */
+    g_envDeviceA.adapterHandle->SimulateSendDelay(DEVICE_NAME_B, 1000); // 1000 ms delay
+
+    /**
+     * @tc.steps: step3. device A send message to device B first, then send message to device C
+     * @tc.expected: step3. communicator CA received message before communicator BB
+     */
+    SendConfig conf = {true, false, true, 0};
+    Message *msgForAB = BuildRegedTinyMessage();
+    ASSERT_NE(msgForAB, nullptr);
+    EXPECT_EQ(g_commAB->SendMessage(DEVICE_NAME_B, msgForAB, conf), E_OK);
+    Message *msgForAA = BuildRegedTinyMessage();
+    ASSERT_NE(msgForAA, nullptr);
+    EXPECT_EQ(g_commAA->SendMessage(DEVICE_NAME_C, msgForAA, conf), E_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200)); // Wait 200 ms
+    EXPECT_EQ(countForCA, 1);
+    EXPECT_EQ(countForBB, 0);
+
+    /**
+     * @tc.steps: step4. wait send to device B finish
+     * @tc.expected: step4. communicator BB received the message
+     */
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000)); // Wait 1000 ms
+    EXPECT_EQ(countForBB, 1);
+
+    // CleanUp
+    g_envDeviceA.adapterHandle->SimulateSendDelay(DEVICE_NAME_B, 0);
+    g_commBB->RegOnMessageCallback(nullptr, nullptr);
+    g_commCA->RegOnMessageCallback(nullptr, nullptr);
+    AdapterStub::DisconnectAdapterStub(g_envDeviceA.adapterHandle, g_envDeviceB.adapterHandle);
+    AdapterStub::DisconnectAdapterStub(g_envDeviceA.adapterHandle, g_envDeviceC.adapterHandle);
+}
+
+/**
+ * @tc.name: ManyPeerSendThroughput001
+ * @tc.desc: Test send throughput when many peers online and each link is slow
+ * @tc.type: PERF
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCommunicatorDeepTest, ManyPeerSendThroughput001, TestSize.Level4)
+{
+    const int peerNum = 16;
+    const int msgNumPerPeer = 20;
+    const uint32_t linkDelayMs = 5;
+    std::vector<EnvHandle> peerEnvs(peerNum);
+    std::vector<ICommunicator *> peerComms(peerNum, nullptr);
+    std::mutex receiveMutex;
+    std::condition_variable receiveCv;
+    int receiveCount = 0;
+    /**
+     * @tc.steps: step1. set up peers and connect them with device A, each link cost 5ms per packet
+     */
+    for (int i = 0; i < peerNum; ++i) {
+        std::string peerName = "Peer_" + std::to_string(i);
+        ASSERT_TRUE(SetUpEnv(peerEnvs[i], peerName));
+        int errorNo = E_OK;
+        peerComms[i] = peerEnvs[i].commAggrHandle->AllocCommunicator(LABEL_A, errorNo);
+        ASSERT_NOT_NULL_AND_ACTIVATE(peerComms[i], "");
+        peerComms[i]->RegOnMessageCallback([&](const std::string &srcTarget, Message *inMsg) {
+            delete inMsg;
+            std::lock_guard<std::mutex> autoLock(receiveMutex);
+            receiveCount++;
+            receiveCv.notify_all();
+            return E_OK;
+        }, nullptr);
+        AdapterStub::ConnectAdapterStub(g_envDeviceA.adapterHandle, peerEnvs[i].adapterHandle);
+        g_envDeviceA.adapterHandle->SimulateSendDelay(peerName, linkDelayMs);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500)); // Wait 500 ms to make sure quiet
+
+    /**
+     * @tc.steps: step2. device A send messages to all peers
+     * @tc.expected: step2. all messages received and cost less than sending them one by one
+     */
+    SendConfig conf = {true, false, true, 0};
+    auto beginTime = std::chrono::steady_clock::now();
+    for (int j = 0; j < msgNumPerPeer; ++j) {
+        for (int i = 0; i < peerNum; ++i) {
+            Message *msg = BuildRegedTinyMessage();
+            ASSERT_NE(msg, nullptr);
+            EXPECT_EQ(g_commAA->SendMessage(peerEnvs[i].adapterHandle->GetLocalTarget(), msg, conf), E_OK);
+        }
+    }
+    {
+        std::unique_lock<std::mutex> uniqueLock(receiveMutex);
+        receiveCv.wait_for(uniqueLock, std::chrono::seconds(30), [&receiveCount]() { // wait max 30s
+            return receiveCount == peerNum * msgNumPerPeer;
+        });
+        EXPECT_EQ(receiveCount, peerNum * msgNumPerPeer);
+    }
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+        beginTime).count();
+    int64_t serialCostMs = static_cast<int64_t>(peerNum) * msgNumPerPeer * linkDelayMs;
+    LOGI("[ManyPeerSendThroughput001] peers=%d, msgs=%d, cost=%" PRId64 "ms, serial cost=%" PRId64 "ms",
+        peerNum, peerNum * msgNumPerPeer, static_cast<int64_t>(costMs), serialCostMs);
+    EXPECT_LT(costMs, serialCostMs);
+
+    // CleanUp
+    for (int i = 0; i < peerNum; ++i) {
+        g_envDeviceA.adapterHandle->SimulateSendDelay(peerEnvs[i].adapterHandle->GetLocalTarget(), 0);
+        AdapterStub::DisconnectAdapterStub(g_envDeviceA.adapterHandle, peerEnvs[i].adapterHandle);
+        peerEnvs[i].commAggrHandle->ReleaseCommunicator(peerComms[i]);
+        TearDownEnv(peerEnvs[i]);
+    }
+}
 #endif
@@ -990,6 +990,122 @@ HWTEST_F(DistributedDBCloudInterfacesRelationalExtClientTest, TriggerObserverTes
     EXPECT_EQ(sqlite3_close_v2(db), E_OK);
 }
 
+/**
+ * @tc.name: TriggerObserverTest009
+ * @tc.desc: Test changes are collected by each handle and notified when the handle commits
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudInterfacesRelationalExtClientTest, TriggerObserverTest009, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. prepare data and register client observer by handle1
+     * @tc.expected: step1. return ok.
+     */
+    const std::string tableName1 = "sync_data1";
+    const std::string tableName2 = "sync_data2";
+    PrepareData({tableName1, tableName2}, false, DistributedDB::CLOUD_COOPERATION, false);
+    sqlite3 *db1 = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db1, nullptr);
+    ClientObserver clientObserver = std::bind(&DistributedDBCloudInterfacesRelationalExtClientTest::ClientObserverFunc,
+        this, std::placeholders::_1);
+    EXPECT_EQ(RegisterClientObserver(db1, clientObserver), OK);
+    RegisterDbHook(db1);
+
+    /**
+     * @tc.steps:step2. insert many rows in one transaction by handle2
+     * @tc.expected: step2. observer triggered once with table1 only.
+     */
+    sqlite3 *db2 = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db2, nullptr);
+    RegisterDbHook(db2);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db2, "begin;"), E_OK);
+    int dataCounts = 1000; // 1000 is count of insert options.
+    for (int i = 1; i <= dataCounts; i++) {
+        std::string sql = "insert into " + tableName1 + " VALUES(" + std::to_string(i) + ", 'zhangsan');";
+        EXPECT_EQ(RelationalTestUtils::ExecSql(db2, sql), E_OK);
+    }
+    std::unique_lock<std::mutex> lock(g_mutex);
+    ExecSqlAndWaitForObserver(db2, "commit;", lock);
+    ASSERT_EQ(triggerTableData_.size(), 1u);
+    EXPECT_EQ(triggerTableData_.begin()->first, tableName1);
+    EXPECT_TRUE(triggerTableData_.begin()->second.isCloudSyncDataChange);
+    EXPECT_EQ(triggeredCount_, 1);
+
+    /**
+     * @tc.steps:step3. close handle2 and insert by a new handle
+     * @tc.expected: step3. observer triggered with table2 only.
+     */
+    EXPECT_EQ(sqlite3_close_v2(db2), E_OK);
+    triggerTableData_.clear();
+    sqlite3 *db3 = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db3, nullptr);
+    RegisterDbHook(db3);
+    ExecSqlAndWaitForObserver(db3, "insert into " + tableName2 + " VALUES(1, 'lisi');", lock);
+    ASSERT_EQ(triggerTableData_.size(), 1u);
+    EXPECT_EQ(triggerTableData_.begin()->first, tableName2);
+    EXPECT_EQ(triggeredCount_, 2); // 2 is trigger count
+    EXPECT_EQ(sqlite3_close_v2(db3), E_OK);
+    EXPECT_EQ(UnRegisterClientObserver(db1), OK);
+    EXPECT_EQ(sqlite3_close_v2(db1), E_OK);
+}
+
+/**
+ * @tc.name: TriggerObserverTest010
+ * @tc.desc: Test changes of handle without db hook are notified by handle with db hook, and rollback drops changes
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudInterfacesRelationalExtClientTest, TriggerObserverTest010, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. prepare data, register client observer and db hook by handle1
+     * @tc.expected: step1. return ok.
+     */
+    const std::string tableName1 = "sync_data1";
+    const std::string tableName2 = "sync_data2";
+    PrepareData({tableName1, tableName2}, false, DistributedDB::CLOUD_COOPERATION, false);
+    sqlite3 *db1 = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db1, nullptr);
+    ClientObserver clientObserver = std::bind(&DistributedDBCloudInterfacesRelationalExtClientTest::ClientObserverFunc,
+        this, std::placeholders::_1);
+    EXPECT_EQ(RegisterClientObserver(db1, clientObserver), OK);
+    RegisterDbHook(db1);
+
+    /**
+     * @tc.steps:step2. insert table1 by handle2 without db hook, then insert table2 by handle1
+     * @tc.expected: step2. observer triggered once with both tables.
+     */
+    sqlite3 *db2 = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db2, nullptr);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db2, "insert into " + tableName1 + " VALUES(1, 'zhangsan');"), E_OK);
+    EXPECT_EQ(triggeredCount_, 0);
+    std::unique_lock<std::mutex> lock(g_mutex);
+    ExecSqlAndWaitForObserver(db1, "insert into " + tableName2 + " VALUES(1, 'lisi');", lock);
+    EXPECT_EQ(triggerTableData_.size(), 2u); // 2 is table count
+    EXPECT_EQ(triggerTableData_.count(tableName1), 1u);
+    EXPECT_EQ(triggerTableData_.count(tableName2), 1u);
+    EXPECT_EQ(triggeredCount_, 1);
+    EXPECT_EQ(sqlite3_close_v2(db2), E_OK);
+
+    /**
+     * @tc.steps:step3. insert table1 in a transaction by handle1 and rollback, then insert table2
+     * @tc.expected: step3. observer triggered with table2 only.
+     */
+    triggerTableData_.clear();
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db1, "begin;"), E_OK);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db1, "insert into " + tableName1 + " VALUES(2, 'zhangsan');"), E_OK);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db1, "rollback;"), E_OK);
+    ExecSqlAndWaitForObserver(db1, "insert into " + tableName2 + " VALUES(2, 'lisi');", lock);
+    ASSERT_EQ(triggerTableData_.size(), 1u);
+    EXPECT_EQ(triggerTableData_.begin()->first, tableName2);
+    EXPECT_EQ(triggeredCount_, 2); // 2 is trigger count
+    EXPECT_EQ(UnRegisterClientObserver(db1), OK);
+    EXPECT_EQ(sqlite3_close_v2(db1), E_OK);
+}
+
 void InitLogicDeleteData(sqlite3 *&db, const std::string &tableName, uint64_t num)
 {
     for (size_t i = 0; i < num; ++i) {
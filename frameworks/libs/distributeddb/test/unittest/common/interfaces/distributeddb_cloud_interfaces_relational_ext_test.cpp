@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <cinttypes>
 #include <sys/time.h>
 #include <gtest/gtest.h>
 
@@ -385,6 +386,268 @@ HWTEST_F(DistributedDBCloudInterfacesRelationalExtTest, InsertTriggerTest003, Te
     EXPECT_EQ(sqlite3_close_v2(db), E_OK);
 }
 
+/**
+ * @tc.name: InsertTriggerTest004
+ * @tc.desc: Test insert trigger keeps cloud info when re-insert a deleted row
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudInterfacesRelationalExtTest, InsertTriggerTest004, TestSize.Level1)
+{
+    /**
+    * @tc.steps:step1. prepare data.
+    * @tc.expected: step1. return ok.
+    */
+    const std::string tableName = "sync_data";
+    PrepareData({tableName}, true, DistributedDB::CLOUD_COOPERATION);
+
+    /**
+     * @tc.steps:step2. insert data, set cloud info in log table, then delete and insert it again.
+     * @tc.expected: step2. return ok.
+     */
+    sqlite3 *db = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    EXPECT_NE(db, nullptr);
+    std::string sql = "insert into " + tableName + " VALUES(1, 1, 'zhangsan');";
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql), E_OK);
+    std::string gid = "test_gid";
+    std::string version = "test_version";
+    sql = "update " + DBCommon::GetLogTableName(tableName) + " set cloud_gid = '" + gid + "', version = '" +
+        version + "'";
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql), E_OK);
+    sql = "delete from " + tableName + ";";
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql), E_OK);
+    sql = "insert into " + tableName + " VALUES(1, 1, 'lisi');";
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql), E_OK);
+
+    /**
+     * @tc.steps:step3. select data from log table.
+     * @tc.expected: step3. only one log with cloud info kept and flag reset to local.
+     */
+    sql = "select data_key, flag, cloud_gid, version from " + DBCommon::GetLogTableName(tableName);
+    int resultCount = 0;
+    int errCode = RelationalTestUtils::ExecSql(db, sql, nullptr, [&resultCount, &gid, &version] (sqlite3_stmt *stmt) {
+        EXPECT_EQ(sqlite3_column_int64(stmt, 0), 1); // 1 is row id
+        EXPECT_EQ(sqlite3_column_int(stmt, 1), 0x02|0x20); // 1 is column index flag == 0x02|0x20
+        std::string gidStr;
+        EXPECT_EQ(SQLiteUtils::GetColumnTextValue(stmt, 2, gidStr), E_OK); // 2 is column index
+        EXPECT_EQ(gid, gidStr);
+        std::string versionStr;
+        EXPECT_EQ(SQLiteUtils::GetColumnTextValue(stmt, 3, versionStr), E_OK); // 3 is column index
+        EXPECT_EQ(version, versionStr);
+        resultCount++;
+        return E_OK;
+    });
+    EXPECT_EQ(errCode, SQLITE_OK);
+    EXPECT_EQ(resultCount, 1);
+    EXPECT_EQ(sqlite3_close_v2(db), E_OK);
+}
+
+std::string GetInsertTriggerSql(sqlite3 *db, const std::string &tableName)
+{
+    std::string sql = "SELECT sql FROM sqlite_master WHERE type = 'trigger' AND name = 'naturalbase_rdb_" +
+        tableName + "_ON_INSERT';";
+    std::string triggerSql;
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql, nullptr, [&triggerSql] (sqlite3_stmt *stmt) {
+        return SQLiteUtils::GetColumnTextValue(stmt, 0, triggerSql);
+    }), E_OK);
+    return triggerSql;
+}
+
+// Restore the insert trigger before log table version 5.11, which calculates the hash of primary key in each reference
+std::string GetOldInsertTriggerSql(const std::string &triggerSql)
+{
+    const std::string fromPrefix = " FROM (SELECT ";
+    const std::string fromSuffix = " AS hash_value) AS naturalbase_rdb_pk WHERE true";
+    const std::string hashKeyRef = "naturalbase_rdb_pk.hash_value";
+    std::string oldSql = triggerSql;
+    size_t fromPos = oldSql.find(fromPrefix);
+    size_t suffixPos = oldSql.find(fromSuffix, fromPos);
+    if (fromPos == std::string::npos || suffixPos == std::string::npos) {
+        return "";
+    }
+    std::string hashKeyExpr = oldSql.substr(fromPos + fromPrefix.size(), suffixPos - fromPos - fromPrefix.size());
+    oldSql.replace(fromPos, suffixPos + fromSuffix.size() - fromPos, ")");
+    const std::string selectRow = " SELECT new._rowid_";
+    size_t selectPos = oldSql.find(selectRow);
+    if (selectPos == std::string::npos) {
+        return "";
+    }
+    oldSql.replace(selectPos, selectRow.size(), " VALUES (new._rowid_");
+    for (size_t pos = oldSql.find(hashKeyRef); pos != std::string::npos; pos = oldSql.find(hashKeyRef, pos)) {
+        oldSql.replace(pos, hashKeyRef.size(), hashKeyExpr);
+        pos += hashKeyExpr.size();
+    }
+    return oldSql;
+}
+
+std::vector<std::string> GetLogRows(sqlite3 *db, const std::string &tableName)
+{
+    std::string sql = "SELECT data_key, flag, hex(hash_key), cloud_gid, hex(extend_field), cursor, version, "
+        "sharing_resource, status FROM " + DBCommon::GetLogTableName(tableName) + " ORDER BY hash_key;";
+    std::vector<std::string> rows;
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql, nullptr, [&rows] (sqlite3_stmt *stmt) {
+        std::string row;
+        for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
+            std::string column;
+            EXPECT_EQ(SQLiteUtils::GetColumnTextValue(stmt, i, column), E_OK);
+            row += column + "|";
+        }
+        rows.push_back(row);
+        return E_OK;
+    }), E_OK);
+    return rows;
+}
+
+/**
+ * @tc.name: InsertTriggerTest005
+ * @tc.desc: Test insert trigger which calculates hash once generates same log as the old one and upgrade recreates it
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudInterfacesRelationalExtTest, InsertTriggerTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. prepare two tables, restore the old insert trigger on one of them.
+     * @tc.expected: step1. return ok.
+     */
+    const std::string newTable = "sync_data_new";
+    const std::string oldTable = "sync_data_old";
+    PrepareData({newTable, oldTable}, true, DistributedDB::CLOUD_COOPERATION);
+    sqlite3 *db = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db, nullptr);
+    std::string oldTriggerSql = GetOldInsertTriggerSql(GetInsertTriggerSql(db, oldTable));
+    ASSERT_FALSE(oldTriggerSql.empty());
+    EXPECT_EQ(oldTriggerSql.find("naturalbase_rdb_pk"), std::string::npos);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, "DROP TRIGGER naturalbase_rdb_" + oldTable + "_ON_INSERT;"), E_OK);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, oldTriggerSql), E_OK);
+
+    /**
+     * @tc.steps:step2. insert, set cloud info, delete and re-insert the same data in both tables.
+     * @tc.expected: step2. return ok.
+     */
+    for (const auto &tableName : {newTable, oldTable}) {
+        std::string logTableName = DBCommon::GetLogTableName(tableName);
+        std::vector<std::string> sqls = {
+            "insert into " + tableName + " VALUES(1, 1, 'zhangsan');",
+            "insert into " + tableName + " VALUES(2, 2, 'lisi');",
+            "insert into " + tableName + " VALUES(3, 3, 'wangwu');",
+            "update " + logTableName + " set cloud_gid = 'gid2', version = 'version2' where data_key = 2;",
+            "delete from " + tableName + " where rowid = 2;",
+            "insert into " + tableName + " VALUES(2, 2, 'lisi2');",
+            "insert or replace into " + tableName + " VALUES(3, 3, 'wangwu2');"
+        };
+        for (const auto &sql : sqls) {
+            EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql), E_OK);
+        }
+    }
+
+    /**
+     * @tc.steps:step3. compare log rows of the two tables.
+     * @tc.expected: step3. log rows are same except timestamp.
+     */
+    std::vector<std::string> newRows = GetLogRows(db, newTable);
+    EXPECT_EQ(newRows.size(), 3u); // 3 rows are inserted
+    EXPECT_EQ(newRows, GetLogRows(db, oldTable));
+
+    /**
+     * @tc.steps:step4. set log table version to 5.10 and reopen store.
+     * @tc.expected: step4. insert trigger of old table is recreated.
+     */
+    std::string sql = "UPDATE " + std::string(DBConstant::RELATIONAL_PREFIX) + "metadata SET value = ? WHERE key = ?;";
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql, [] (sqlite3_stmt *stmt) {
+        Value verVal;
+        DBCommon::StringToVector(DBConstant::LOG_TABLE_VERSION_5_10, verVal);
+        Key verKey;
+        DBCommon::StringToVector(DBConstant::LOG_TABLE_VERSION_KEY, verKey);
+        EXPECT_EQ(SQLiteUtils::BindBlobToStatement(stmt, 1, verVal, false), E_OK);
+        return SQLiteUtils::BindBlobToStatement(stmt, 2, verKey, false); // 2 is bind index of key
+    }, nullptr), E_OK);
+    RelationalStoreDelegate *delegate = nullptr;
+    EXPECT_EQ(g_mgr.OpenStore(g_dbDir + STORE_ID + DB_SUFFIX, STORE_ID, {}, delegate), OK);
+    ASSERT_NE(delegate, nullptr);
+    EXPECT_EQ(g_mgr.CloseStore(delegate), OK);
+    EXPECT_NE(GetInsertTriggerSql(db, oldTable).find("naturalbase_rdb_pk"), std::string::npos);
+    EXPECT_EQ(sqlite3_close_v2(db), E_OK);
+}
+
+int64_t InsertRowsAndGetCost(sqlite3 *db, const std::string &tableName, int beginId, int rowCount)
+{
+    std::string sql = "insert into " + tableName + " VALUES(?, ?, 'name');";
+    sqlite3_stmt *stmt = nullptr;
+    EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, "BEGIN IMMEDIATE;"), E_OK);
+    for (int i = beginId; i < beginId + rowCount; i++) {
+        EXPECT_EQ(sqlite3_bind_int(stmt, 1, i), SQLITE_OK);
+        EXPECT_EQ(sqlite3_bind_int(stmt, 2, i), SQLITE_OK); // 2 is bind index of id
+        EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+        EXPECT_EQ(sqlite3_reset(stmt), SQLITE_OK);
+    }
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, "COMMIT;"), E_OK);
+    auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    sqlite3_finalize(stmt);
+    return static_cast<int64_t>(costUs);
+}
+
+/**
+ * @tc.name: InsertTriggerPerf001
+ * @tc.desc: Test insert throughput of the old insert trigger and the one which calculates hash once
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudInterfacesRelationalExtTest, InsertTriggerPerf001, TestSize.Level2)
+{
+    /**
+     * @tc.steps:step1. prepare two tables, restore the old insert trigger on one of them.
+     * @tc.expected: step1. return ok.
+     */
+    const std::string newTable = "sync_data_new";
+    const std::string oldTable = "sync_data_old";
+    PrepareData({newTable, oldTable}, true, DistributedDB::CLOUD_COOPERATION);
+    sqlite3 *db = RelationalTestUtils::CreateDataBase(g_dbDir + STORE_ID + DB_SUFFIX);
+    ASSERT_NE(db, nullptr);
+    std::string oldTriggerSql = GetOldInsertTriggerSql(GetInsertTriggerSql(db, oldTable));
+    ASSERT_FALSE(oldTriggerSql.empty());
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, "DROP TRIGGER naturalbase_rdb_" + oldTable + "_ON_INSERT;"), E_OK);
+    EXPECT_EQ(RelationalTestUtils::ExecSql(db, oldTriggerSql), E_OK);
+
+    /**
+     * @tc.steps:step2. insert the same rows into both tables in rounds, alternate the order to even out warm up.
+     * @tc.expected: step2. return ok and both tables have the same count of log.
+     */
+    const int rounds = 4;
+    const int rowsPerRound = 5000;
+    int64_t newCostUs = 0;
+    int64_t oldCostUs = 0;
+    for (int round = 0; round < rounds; round++) {
+        int beginId = round * rowsPerRound + 1; // rowid starts from 1
+        if (round % 2 == 0) { // 2 is used to alternate the order
+            newCostUs += InsertRowsAndGetCost(db, newTable, beginId, rowsPerRound);
+            oldCostUs += InsertRowsAndGetCost(db, oldTable, beginId, rowsPerRound);
+        } else {
+            oldCostUs += InsertRowsAndGetCost(db, oldTable, beginId, rowsPerRound);
+            newCostUs += InsertRowsAndGetCost(db, newTable, beginId, rowsPerRound);
+        }
+    }
+    const int totalRows = rounds * rowsPerRound;
+    for (const auto &tableName : {newTable, oldTable}) {
+        std::string sql = "select count(*) from " + DBCommon::GetLogTableName(tableName) + ";";
+        EXPECT_EQ(RelationalTestUtils::ExecSql(db, sql, nullptr, [totalRows] (sqlite3_stmt *stmt) {
+            EXPECT_EQ(sqlite3_column_int(stmt, 0), totalRows);
+            return E_OK;
+        }), E_OK);
+    }
+    LOGI("[InsertTriggerPerf001] rows:%d, old trigger cost:%" PRId64 "us, rows/sec:%.0f, new trigger cost:%" PRId64
+        "us, rows/sec:%.0f", totalRows, oldCostUs,
+        static_cast<double>(totalRows) * 1000000.0 / static_cast<double>(oldCostUs + 1), newCostUs,
+        static_cast<double>(totalRows) * 1000000.0 / static_cast<double>(newCostUs + 1));
+    EXPECT_EQ(sqlite3_close_v2(db), E_OK);
+}
+
 void UpdateTriggerTest(bool primaryKeyIsRowId)
 {
     /**
@@ -1482,5 +1482,65 @@ HWTEST_F(DistributedDBInterfacesImportAndExportTest, CheckSecurityLabel002, Test
     RuntimeContext::GetInstance()->SetProcessSystemApiAdapter(nullptr);
     g_junkFilesList.push_back(singleFileName);
 }
+
+/**
+  * @tc.name: ExportPerfTest001
+  * @tc.desc: Test the cost of exporting a non-encrypted store by page copy and with password by records.
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBInterfacesImportAndExportTest, ExportPerfTest001, TestSize.Level4)
+{
+    /**
+     * @tc.steps: step1. put 10k records with 1k value into a non-encrypted store
+     * @tc.expected: step1. OK
+     */
+    std::string singleStoreId = "distributed_ExportPerf_001";
+    KvStoreNbDelegate::Option option = {true, false, false};
+    g_mgr.GetKvStore(singleStoreId, option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    EXPECT_TRUE(g_kvDelegateStatus == OK);
+    const int recordCount = 10000; // 10k records
+    const size_t batchCount = 100; // put 100 records each batch
+    std::vector<Entry> entries;
+    for (int i = 0; i < recordCount; i++) {
+        std::string keyStr = "key_" + std::to_string(i);
+        entries.push_back({Key(keyStr.begin(), keyStr.end()), Value(1024, 'v')}); // 1k value
+        if (entries.size() == batchCount) {
+            ASSERT_EQ(g_kvNbDelegatePtr->PutBatch(entries), OK);
+            entries.clear();
+        }
+    }
+    /**
+     * @tc.steps: step2. export the store without and with password
+     * @tc.expected: step2. OK
+     */
+    std::string pageCopyFileName = g_exportFileDir + "/ExportPerfTest001_page.$$";
+    std::string recordFileName = g_exportFileDir + "/ExportPerfTest001_record.$$";
+    CipherPassword passwd;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(g_kvNbDelegatePtr->Export(pageCopyFileName, passwd), OK);
+    auto pageCopyCost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(g_kvNbDelegatePtr->Export(recordFileName, g_passwd1), OK);
+    auto recordCost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    LOGI("[ExportPerfTest001] page copy: %" PRId64 "ms, record: %" PRId64 "ms", static_cast<int64_t>(pageCopyCost),
+        static_cast<int64_t>(recordCost));
+    /**
+     * @tc.steps: step3. import the file exported by page copy
+     * @tc.expected: step3. OK and all records exist
+     */
+    EXPECT_EQ(g_kvNbDelegatePtr->Import(pageCopyFileName, passwd), OK);
+    std::vector<Entry> resultEntries;
+    EXPECT_EQ(g_kvNbDelegatePtr->GetEntries(Key(), resultEntries), OK);
+    EXPECT_EQ(resultEntries.size(), static_cast<size_t>(recordCount));
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    EXPECT_EQ(g_mgr.DeleteKvStore(singleStoreId), OK);
+    g_junkFilesList.push_back(pageCopyFileName);
+    g_junkFilesList.push_back(recordFileName);
+}
 #endif // OMIT_ENCRYPT
 #endif
@@ -1596,4 +1596,63 @@ HWTEST_F(DistributedDBInterfacesNBDelegateExtendTest, RemoveLocalDataByKeyPatter
     VerifyLocalDataCorrect(keys, value);
     CloseAndDeleteKvStoreForRemoveTest("RemoveLocalByKeyPattern009");
 }
+
+/**
+  * @tc.name: ConcurrentGetPerf001
+  * @tc.desc: Test point reads from 1 to 16 threads and log the throughput of each round
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBInterfacesNBDelegateExtendTest, ConcurrentGetPerf001, TestSize.Level4)
+{
+    /**
+     * @tc.steps:step1. Put 1000 records.
+     * @tc.expected: step1. put ok.
+     */
+    KvStoreNbDelegate::Option option;
+    g_mgr.GetKvStore("ConcurrentGetPerf001", option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    const int recordCount = 1000;
+    std::vector<Entry> entries;
+    for (int i = 0; i < recordCount; i++) {
+        std::string keyStr = "key_" + std::to_string(i);
+        entries.push_back({Key(keyStr.begin(), keyStr.end()), Value(keyStr.begin(), keyStr.end())});
+    }
+    EXPECT_EQ(g_kvNbDelegatePtr->PutBatch(entries), OK);
+    /**
+     * @tc.steps:step2. Get from 1, 2, 4, 8 and 16 threads concurrently.
+     * @tc.expected: step2. every get returns the value that was put.
+     */
+    const int getPerThread = 2000;
+    const int maxThreadNum = 16;
+    for (int threadNum = 1; threadNum <= maxThreadNum; threadNum *= 2) { // 2 is the step of thread number
+        std::atomic<int> failCount = 0;
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < threadNum; t++) {
+            threads.emplace_back([&entries, &failCount, t]() {
+                Value value;
+                for (int i = 0; i < getPerThread; i++) {
+                    const Entry &entry = entries[(i + t) % recordCount];
+                    if (g_kvNbDelegatePtr->Get(entry.key, value) != OK || value != entry.value) {
+                        failCount++;
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto costUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+            start).count();
+        EXPECT_EQ(failCount.load(), 0);
+        LOGI("[ConcurrentGetPerf001] threads:%d, gets:%d, cost:%" PRId64 "us, gets/sec:%.0f", threadNum,
+            threadNum * getPerThread, static_cast<int64_t>(costUs),
+            static_cast<double>(threadNum * getPerThread) * 1000000.0 / static_cast<double>(costUs + 1));
+    }
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    g_kvNbDelegatePtr = nullptr;
+    EXPECT_EQ(g_mgr.DeleteKvStore("ConcurrentGetPerf001"), OK);
+}
 }
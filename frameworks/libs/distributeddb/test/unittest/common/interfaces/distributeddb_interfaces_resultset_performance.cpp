@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include <thread>
 #include "distributeddb_tools_unit_test.h"
@@ -38,6 +39,11 @@ namespace {
     const int ENTRY_VALUE_SIZE = 3000;
     const int BATCH_ENTRY_NUMBER = 100;
 
+    const int PREFIX_MATCH_NUMBER = 100;
+    const int PREFIX_VALUE_SIZE = 100;
+    const int PREFIX_BATCH_NUMBER = 128;
+    const std::vector<int> PREFIX_STORE_SIZES = {10000, 100000, 1000000};
+
     DBStatus g_kvDelegateStatus = INVALID_ARGS;
     KvStoreNbDelegate *g_kvNbDelegatePtr = nullptr;
 
@@ -75,6 +81,32 @@ namespace {
 
         std::this_thread::sleep_for(std::chrono::seconds(2)); // sleep 2 s for the cache.
     }
+
+    // Fill the store up to storeSize entries, only PREFIX_MATCH_NUMBER of them start with g_keyPrefix.
+    void FillPrefixStore(int begin, int storeSize)
+    {
+        std::vector<Entry> entries;
+        for (int i = begin; i < storeSize; i++) {
+            Entry entry;
+            std::string strIndex = std::to_string(i);
+            entry.key = (i < PREFIX_MATCH_NUMBER) ? g_keyPrefix : Key {'Z'};
+            entry.key.insert(entry.key.end(), strIndex.begin(), strIndex.end());
+            entry.value.assign(PREFIX_VALUE_SIZE, 'v');
+            entries.push_back(std::move(entry));
+            if (entries.size() == PREFIX_BATCH_NUMBER) {
+                ASSERT_EQ(g_kvNbDelegatePtr->PutBatch(entries), OK);
+                entries.clear();
+            }
+        }
+        if (!entries.empty()) {
+            ASSERT_EQ(g_kvNbDelegatePtr->PutBatch(entries), OK);
+        }
+    }
+
+    int64_t GetElapsedMicroseconds(const std::chrono::steady_clock::time_point &start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
 }
 class DistributedDBInterfacesNBResultsetPerfTest : public testing::Test {
 public:
@@ -168,4 +200,63 @@ HWTEST_F(DistributedDBInterfacesNBResultsetPerfTest, ResultSetPerfTest001, TestS
     EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
     EXPECT_EQ(g_mgr.DeleteKvStore("resultset_perf_test"), OK);
     g_kvNbDelegatePtr = nullptr;
-}
\ No newline at end of file
+}
+/**
+  * @tc.name: PrefixScanPerfTest001
+  * @tc.desc: Test the latency of prefix GetEntries/GetCount/GetResultSet versus the store size.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBInterfacesNBResultsetPerfTest, PrefixScanPerfTest001, TestSize.Level4)
+{
+    /**
+     * @tc.steps: step1. open a store.
+     * @tc.expected: step1. Success.
+     */
+    KvStoreNbDelegate::Option option = {true, false, false};
+    g_mgr.GetKvStore("prefix_scan_perf_test", option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    EXPECT_TRUE(g_kvDelegateStatus == OK);
+
+    int currentSize = 0;
+    for (int storeSize : PREFIX_STORE_SIZES) {
+        /**
+         * @tc.steps: step2. grow the store, the count of entries matching the prefix stays the same.
+         * @tc.expected: step2. Success.
+         */
+        FillPrefixStore(currentSize, storeSize);
+        currentSize = storeSize;
+
+        /**
+         * @tc.steps: step3. get entries, count and result set by prefix and record the latency.
+         * @tc.expected: step3. Only the matched entries are returned and the latency does not grow with the store.
+         */
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Entry> entries;
+        EXPECT_EQ(g_kvNbDelegatePtr->GetEntries(g_keyPrefix, entries), OK);
+        int64_t getEntriesCost = GetElapsedMicroseconds(start);
+        EXPECT_EQ(entries.size(), static_cast<size_t>(PREFIX_MATCH_NUMBER));
+
+        start = std::chrono::steady_clock::now();
+        int count = 0;
+        EXPECT_EQ(g_kvNbDelegatePtr->GetCount(Query::Select().PrefixKey(g_keyPrefix), count), OK);
+        int64_t getCountCost = GetElapsedMicroseconds(start);
+        EXPECT_EQ(count, PREFIX_MATCH_NUMBER);
+
+        start = std::chrono::steady_clock::now();
+        KvStoreResultSet *resultSet = nullptr;
+        EXPECT_EQ(g_kvNbDelegatePtr->GetEntries(Query::Select().PrefixKey(g_keyPrefix), resultSet), OK);
+        ASSERT_TRUE(resultSet != nullptr);
+        EXPECT_EQ(resultSet->GetCount(), PREFIX_MATCH_NUMBER);
+        int64_t resultSetCost = GetElapsedMicroseconds(start);
+        EXPECT_EQ(g_kvNbDelegatePtr->CloseResultSet(resultSet), OK);
+
+        LOGI("######## store size:%d, GetEntries:%" PRId64 "us, GetCount:%" PRId64 "us, ResultSet:%" PRId64 "us",
+            storeSize, getEntriesCost, getCountCost, resultSetCost);
+    }
+
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    EXPECT_EQ(g_mgr.DeleteKvStore("prefix_scan_perf_test"), OK);
+    g_kvNbDelegatePtr = nullptr;
+}
@@ -47,6 +47,9 @@ namespace {
     const int BUFFER_SIZE = 4096;
     const int DEVICE_ID_LEN = 32;
     const vector<uint8_t> DIVICE_ID = {'a', 'e', 'i', 'o', 'u'};
+    const uint32_t CHECKSUM_OFFSET = 20; // magic 16 bytes and version 4 bytes
+    const uint32_t CHECKSUM_LEN = 32;
+    const uint32_t CHECKSUM_BLOCK_SIZE = 64;
 
     void RemovePath(const string &path)
     {
@@ -361,4 +364,58 @@ HWTEST_F(DistributedDBFilePackageTest, GetPackageVersionTest001, TestSize.Level0
     errCode = PackageFile::GetPackageVersion(g_packageResultPath + SECURE_FILE, version);
     EXPECT_EQ(errCode, -E_EKEYREVOKED);
     errno = oldErr;
-}
\ No newline at end of file
+}
+
+/**
+  * @tc.name: PackageFileTest009
+  * @tc.desc: Test the checksum calculated while packing is same as reading the package in padded blocks.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBFilePackageTest, PackageFileTest009, TestSize.Level1)
+{
+    string sourcePath = g_testPath + "/checksum_source/";
+    // the header and file context make the content aligned with block when file len is 0 or 64
+    for (size_t fileLen : {0, 1, 63, 64, 5000}) {
+        /**
+         * @tc.steps: step1. package a file with fileLen bytes
+         * @tc.expected: step1. E_OK
+         */
+        (void)OS::MakeDBDirectory(sourcePath);
+        ofstream sourceFile(sourcePath + FILE_NAME_2, ios::out | ios::binary | ios::trunc);
+        ASSERT_TRUE(sourceFile.is_open());
+        sourceFile.write(string(fileLen, 'a').c_str(), fileLen);
+        sourceFile.close();
+        string packageFile = g_packageResultPath + PACKAGE_RESULT_FILE_NAME;
+        ASSERT_EQ(PackageFile::PackageFiles(sourcePath, packageFile, g_fileInfo), E_OK);
+        /**
+         * @tc.steps: step2. calculate checksum of the content after checksum field which is padded with zero block
+         * @tc.expected: step2. checksum is same as the package header
+         */
+        ifstream fileIn(packageFile, ios::in | ios::binary);
+        ASSERT_TRUE(fileIn.is_open());
+        vector<uint8_t> package((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+        fileIn.close();
+        ASSERT_GT(package.size(), static_cast<size_t>(CHECKSUM_OFFSET + CHECKSUM_LEN));
+        vector<uint8_t> content(package.begin() + CHECKSUM_OFFSET + CHECKSUM_LEN, package.end());
+        content.resize((content.size() / CHECKSUM_BLOCK_SIZE + 1) * CHECKSUM_BLOCK_SIZE, 0);
+        ValueHashCalc calc;
+        ASSERT_EQ(calc.Initialize(), E_OK);
+        ASSERT_EQ(calc.Update(content), E_OK);
+        vector<uint8_t> checksum;
+        ASSERT_EQ(calc.GetResult(checksum), E_OK);
+        EXPECT_EQ(checksum, vector<uint8_t>(package.begin() + CHECKSUM_OFFSET,
+            package.begin() + CHECKSUM_OFFSET + CHECKSUM_LEN));
+        /**
+         * @tc.steps: step3. unpack the package
+         * @tc.expected: step3. E_OK and the file is same as source
+         */
+        FileInfo fileInfo;
+        EXPECT_EQ(PackageFile::UnpackFile(packageFile, g_unpackResultPath, fileInfo), E_OK);
+        ComparePath(sourcePath, g_unpackResultPath);
+        RemovePath(sourcePath);
+        RemovePath(g_unpackResultPath);
+        (void)OS::MakeDBDirectory(g_unpackResultPath);
+    }
+}
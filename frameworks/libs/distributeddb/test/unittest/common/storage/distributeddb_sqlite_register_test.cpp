@@ -38,6 +38,12 @@ namespace {
         WHERE JSON_EXTRACT_BY_PATH(VALUE, '.populationWrong', 0) > 800000";
     const char * const SQL_JSON_WRONG_ARGS = "SELECT * FROM ADDRESS_TEST \
         WHERE JSON_EXTRACT_BY_PATH(VALUE, '$.population') > 800000";
+    const char * const SQL_JSON_MULTI_PREDICATES = "SELECT KEY FROM ADDRESS_TEST \
+        WHERE JSON_EXTRACT_BY_PATH(VALUE, '$.population', 0) > 800000 \
+        AND JSON_EXTRACT_BY_PATH(VALUE, '$.province', 0) != 'hunan' \
+        AND JSON_EXTRACT_BY_PATH(VALUE, 'city', 0) = 'nanjing'";
+    const char * const SQL_JSON_VARIABLE_PATH = "SELECT JSON_EXTRACT_BY_PATH(VALUE, \
+        CASE WHEN KEY = '12' THEN 'city' ELSE 'province' END, 0) FROM ADDRESS_TEST ORDER BY KEY";
 #endif
     const char * const SQL_CREATE_TABLE = "CREATE TABLE IF NOT EXISTS ADDRESS_TEST("  \
         "KEY    BLOB    NOT NULL    PRIMARY KEY,"  \
@@ -180,6 +186,42 @@ HWTEST_F(DistributedDBSqliteRegisterTest, JsonExtract003, TestSize.Level1)
     }
     ASSERT_NE(errCode, SQLITE_OK);
 }
+
+/**
+  * @tc.name: JsonExtract004
+  * @tc.desc: test json_extract_by_path function with several predicates and variable path in one statement
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBSqliteRegisterTest, JsonExtract004, TestSize.Level1)
+{
+    ASSERT_NE(g_sqliteDb, nullptr);
+    /**
+     * @tc.steps: step1. query with several predicates on different path of the same value
+     * @tc.expected: step1. only the row matches all predicates is returned
+     */
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(g_sqliteDb, SQL_JSON_MULTI_PREDICATES, -1, &stmt, nullptr), SQLITE_OK);
+    std::vector<std::string> keys;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        keys.emplace_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    }
+    sqlite3_finalize(stmt);
+    EXPECT_EQ(keys, std::vector<std::string>({"12"}));
+
+    /**
+     * @tc.steps: step2. query with the path changed between rows
+     * @tc.expected: step2. the path of each row is used
+     */
+    ASSERT_EQ(sqlite3_prepare_v2(g_sqliteDb, SQL_JSON_VARIABLE_PATH, -1, &stmt, nullptr), SQLITE_OK);
+    std::vector<std::string> results;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        results.emplace_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)));
+    }
+    sqlite3_finalize(stmt);
+    EXPECT_EQ(results, std::vector<std::string>({"hunan", "nanjing", "guangdong"}));
+}
 #endif
 /**
   * @tc.name: CalcHashValue001
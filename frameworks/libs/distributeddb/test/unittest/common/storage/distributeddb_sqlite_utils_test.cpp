@@ -24,6 +24,7 @@
 #include "sqlite_import.h"
 #include "sqlite_log_table_manager.h"
 #include "sqlite_local_storage_executor.h"
+#include "sqlite_statement_cache.h"
 #include "sqlite_utils.h"
 
 using namespace testing::ext;
@@ -774,4 +775,152 @@ HWTEST_F(DistributedDBSqliteUtilsTest, AttachSQLiteTest001, TestSize.Level0)
     EXPECT_FALSE(OS::CheckPathExistence(g_dbDir + "test2.db-wal"));
     ret = SQLiteUtils::AttachNewDatabase(nullptr, CipherType::DEFAULT, {}, g_dbDir + "testxx.db");
     EXPECT_EQ(ret, -E_INVALID_DB);
-}
\ No newline at end of file
+}
+/**
+ * @tc.name: PrefixKeyRangeTest001
+ * @tc.desc: Test the half-open prefix key range only matches the keys start with the prefix
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBSqliteUtilsTest, PrefixKeyRangeTest001, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. check the upper bound of the prefix
+     * @tc.expected: step1. trailing 0xFF is carried and no prefix get a bound longer than max key size
+     */
+    EXPECT_EQ(SQLiteUtils::GetPrefixKeyUpperBound({'a', 'b'}), Key({'a', 'c'}));
+    EXPECT_EQ(SQLiteUtils::GetPrefixKeyUpperBound({'a', 0xFF, 0xFF}), Key({'b'}));
+    EXPECT_EQ(SQLiteUtils::GetPrefixKeyUpperBound({0xFF}).size(), DBConstant::MAX_KEY_SIZE + 1);
+    EXPECT_EQ(SQLiteUtils::GetPrefixKeyUpperBound({}).size(), DBConstant::MAX_KEY_SIZE + 1);
+
+    /**
+     * @tc.steps: step2. query keys by prefix with the half-open range
+     * @tc.expected: step2. the count is equal to the keys start with the prefix
+     */
+    NativeSqlite::ExecSql(g_db, "CREATE TABLE IF NOT EXISTS t2 (key BLOB);");
+    std::vector<Key> keys = {{'a'}, {'a', 'b'}, {'a', 'b', 0xFF}, {'a', 'c'}, {'a', 0xFF}, {'b'}, {0xFF, 0xFF}};
+    for (const auto &key : keys) {
+        NativeSqlite::ExecSql(g_db, "INSERT INTO t2 VALUES(?)", [&key](sqlite3_stmt *stmt) {
+            return SQLiteUtils::BindBlobToStatement(stmt, 1, key);
+        }, nullptr);
+    }
+    std::vector<std::pair<Key, int>> expects = {{{'a'}, 5}, {{'a', 'b'}, 2}, {{'a', 0xFF}, 1}, {{0xFF}, 1}, {{}, 7}};
+    for (const auto &[prefix, expectCount] : expects) {
+        int count = 0;
+        NativeSqlite::ExecSql(g_db, "SELECT count(*) FROM t2 WHERE key>=? AND key<?", [&prefix](sqlite3_stmt *stmt) {
+            return SQLiteUtils::BindPrefixKey(stmt, 1, prefix);
+        }, [&count](sqlite3_stmt *stmt) {
+            count = sqlite3_column_int(stmt, 0);
+            return E_OK;
+        });
+        EXPECT_EQ(count, expectCount);
+    }
+}
+
+/**
+ * @tc.name: StatementCacheTest001
+ * @tc.desc: Test the prepared statement is reused after finalized when the handle is registered to the cache
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBSqliteUtilsTest, StatementCacheTest001, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. register the handle and get the same select statement twice
+     * @tc.expected: step1. the second one is the first one which is taken back by the cache with bindings cleared
+     */
+    auto &cache = SQLiteStatementCache::GetInstance();
+    cache.RegisterHandle(g_db, 1); // only cache 1 statement
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    cache.GetStatistics(hitCount, missCount);
+    const std::string selectSql = "SELECT value FROM data WHERE key=?;";
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, selectSql, stmt), E_OK);
+    sqlite3_stmt *firstStmt = stmt;
+    EXPECT_EQ(SQLiteUtils::BindBlobToStatement(stmt, 1, {'k'}), E_OK);
+    EXPECT_EQ(SQLiteUtils::StepWithRetry(stmt), SQLiteUtils::MapSQLiteErrno(SQLITE_DONE));
+    int errCode = E_OK;
+    SQLiteUtils::ResetStatement(stmt, true, errCode);
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(stmt, nullptr);
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, selectSql, stmt), E_OK);
+    EXPECT_EQ(stmt, firstStmt);
+    EXPECT_EQ(sqlite3_bind_parameter_count(stmt), 1);
+    EXPECT_EQ(sqlite3_sql(stmt), selectSql);
+
+    /**
+     * @tc.steps: step2. get the same sql while the cached one is in use, and get another sql
+     * @tc.expected: step2. a new statement is prepared, and the lru one is finalized when the cache is full
+     */
+    sqlite3_stmt *sameSqlStmt = nullptr;
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, selectSql, sameSqlStmt), E_OK);
+    EXPECT_NE(sameSqlStmt, firstStmt);
+    SQLiteUtils::ResetStatement(sameSqlStmt, true, errCode);
+    SQLiteUtils::ResetStatement(stmt, true, errCode);
+    EXPECT_EQ(errCode, E_OK);
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, "SELECT count(*) FROM data;", stmt), E_OK);
+    SQLiteUtils::ResetStatement(stmt, true, errCode);
+    uint64_t newHitCount = 0;
+    uint64_t newMissCount = 0;
+    cache.GetStatistics(newHitCount, newMissCount);
+    EXPECT_EQ(newHitCount - hitCount, 1u);
+    EXPECT_EQ(newMissCount - missCount, 3u);
+
+    /**
+     * @tc.steps: step3. execute ddl and unregister the handle
+     * @tc.expected: step3. ddl is not cached and the handle can be closed after unregister
+     */
+    EXPECT_EQ(SQLiteUtils::ExecuteRawSQL(g_db, "CREATE TABLE IF NOT EXISTS t3 (key BLOB);"), E_OK);
+    cache.GetStatistics(hitCount, missCount);
+    EXPECT_EQ(missCount, newMissCount);
+    cache.UnregisterHandle(g_db);
+    EXPECT_EQ(sqlite3_close(g_db), SQLITE_OK);
+    g_db = nullptr;
+}
+
+/**
+ * @tc.name: StatementCacheTest002
+ * @tc.desc: Test the statement which failed to reset keeps the error and is not cached
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBSqliteUtilsTest, StatementCacheTest002, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. register the handle and step an insert statement which breaks the primary key constraint
+     * @tc.expected: step1. step return error
+     */
+    auto &cache = SQLiteStatementCache::GetInstance();
+    cache.RegisterHandle(g_db);
+    EXPECT_EQ(SQLiteUtils::ExecuteRawSQL(g_db, "CREATE TABLE IF NOT EXISTS t4 (key BLOB PRIMARY KEY);"), E_OK);
+    EXPECT_EQ(SQLiteUtils::ExecuteRawSQL(g_db, "INSERT INTO t4 VALUES(x'6b');"), E_OK);
+    const std::string insertSql = "INSERT INTO t4 VALUES(?);";
+    sqlite3_stmt *stmt = nullptr;
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, insertSql, stmt), E_OK);
+    EXPECT_EQ(SQLiteUtils::BindBlobToStatement(stmt, 1, {'k'}), E_OK);
+    int stepErr = SQLiteUtils::StepWithRetry(stmt);
+    EXPECT_NE(stepErr, SQLiteUtils::MapSQLiteErrno(SQLITE_DONE));
+
+    /**
+     * @tc.steps: step2. reset the statement without finalize, then get the same sql again
+     * @tc.expected: step2. the reset error is returned, the statement is finalized and not taken by the cache
+     */
+    int errCode = E_OK;
+    SQLiteUtils::ResetStatement(stmt, false, errCode);
+    EXPECT_EQ(errCode, stepErr);
+    EXPECT_EQ(stmt, nullptr);
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    cache.GetStatistics(hitCount, missCount);
+    ASSERT_EQ(SQLiteUtils::GetStatement(g_db, insertSql, stmt), E_OK);
+    uint64_t newHitCount = 0;
+    uint64_t newMissCount = 0;
+    cache.GetStatistics(newHitCount, newMissCount);
+    EXPECT_EQ(newHitCount, hitCount);
+    EXPECT_EQ(newMissCount - missCount, 1u);
+    errCode = E_OK;
+    SQLiteUtils::ResetStatement(stmt, true, errCode);
+    EXPECT_EQ(errCode, E_OK);
+    cache.UnregisterHandle(g_db);
+}
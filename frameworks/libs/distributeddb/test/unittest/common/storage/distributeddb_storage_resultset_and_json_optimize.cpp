@@ -451,4 +451,129 @@ HWTEST_F(DistributedDBStorageResultAndJsonOptimizeTest, ResultSetTest002, TestSi
     EXPECT_EQ(resultSet2->GetEntry(entry), -E_NO_SUCH_ENTRY);
     resultSet2->Close();
 }
+
+/**
+  * @tc.name: ResultSetPagedMode001
+  * @tc.desc: Check the resultSet of CACHE_ENTRY_PAGED mode move in different direction and count lazily
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageResultAndJsonOptimizeTest, ResultSetPagedMode001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Put 300 records with same prefix, which is more than two pages of 128 entries
+     */
+    const int pagedNumber = 300;
+    const Key keyPrefix = {'p'};
+    IOption option;
+    option.dataType = IOption::SYNC_DATA;
+    ASSERT_EQ(g_connection->StartTransaction(), E_OK);
+    for (int i = 0; i < pagedNumber; i++) {
+        Key insertKey = keyPrefix;
+        insertKey.push_back(static_cast<uint8_t>(i >> 8)); // 8 is the bit of one byte
+        insertKey.push_back(static_cast<uint8_t>(i & 0xFF));
+        ASSERT_EQ(g_connection->Put(option, insertKey, VALUE_1), E_OK);
+    }
+    ASSERT_EQ(g_connection->Commit(), E_OK);
+
+    /**
+     * @tc.steps: step2. Open resultSet with paged mode and move forward one by one
+     * @tc.expected: step2. Entries are in key order and the last move beyond result return -E_INVALID_ARGS.
+     */
+    const SQLiteSingleVerResultSet::Option pagedOption = {ResultSetCacheMode::CACHE_ENTRY_PAGED, 1};
+    auto resultSet = std::make_unique<SQLiteSingleVerResultSet>(g_store, keyPrefix, pagedOption);
+    ASSERT_EQ(resultSet->Open(false), E_OK);
+    Entry entry;
+    for (int i = 0; i < pagedNumber; i++) {
+        ASSERT_EQ(resultSet->MoveTo(i), E_OK);
+        ASSERT_EQ(resultSet->GetEntry(entry), E_OK);
+        EXPECT_EQ(entry.key[2], static_cast<uint8_t>(i & 0xFF)); // 2 is the index of low byte
+    }
+    EXPECT_EQ(resultSet->Move(1), -E_INVALID_ARGS);
+    EXPECT_EQ(resultSet->GetPosition(), pagedNumber);
+    EXPECT_EQ(resultSet->GetEntry(entry), -E_NO_SUCH_ENTRY);
+
+    /**
+     * @tc.steps: step3. Move backward and random access
+     * @tc.expected: step3. Get the right entry.
+     */
+    const std::vector<int> positions = {pagedNumber - 1, 130, 127, 5, 260, 0};
+    for (int position : positions) {
+        ASSERT_EQ(resultSet->MoveTo(position), E_OK);
+        ASSERT_EQ(resultSet->GetEntry(entry), E_OK);
+        EXPECT_EQ(entry.key[1], static_cast<uint8_t>(position >> 8)); // 8 is the bit of one byte
+        EXPECT_EQ(entry.key[2], static_cast<uint8_t>(position & 0xFF)); // 2 is the index of low byte
+    }
+    EXPECT_EQ(resultSet->GetCount(), pagedNumber);
+    EXPECT_EQ(resultSet->MoveToLast(), E_OK);
+    EXPECT_TRUE(resultSet->IsLast());
+    resultSet->Close();
+
+    /**
+     * @tc.steps: step4. Open resultSet with paged mode and get count before move
+     * @tc.expected: step4. Count is right.
+     */
+    resultSet = std::make_unique<SQLiteSingleVerResultSet>(g_store, keyPrefix, pagedOption);
+    ASSERT_EQ(resultSet->Open(false), E_OK);
+    EXPECT_EQ(resultSet->GetCount(), pagedNumber);
+    EXPECT_EQ(resultSet->MoveTo(pagedNumber), -E_INVALID_ARGS);
+    resultSet->Close();
+
+    /**
+     * @tc.steps: step5. Open resultSet with paged mode on empty result
+     * @tc.expected: step5. Count is 0 and move return -E_RESULT_SET_EMPTY.
+     */
+    resultSet = std::make_unique<SQLiteSingleVerResultSet>(g_store, Key{'q'}, pagedOption);
+    ASSERT_EQ(resultSet->Open(false), E_OK);
+    EXPECT_EQ(resultSet->GetCount(), 0);
+    EXPECT_EQ(resultSet->MoveToFirst(), -E_RESULT_SET_EMPTY);
+    resultSet->Close();
+}
+
+/**
+  * @tc.name: ResultSetPagedMode002
+  * @tc.desc: Check IsLast of CACHE_ENTRY_PAGED mode when result is exactly full pages
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageResultAndJsonOptimizeTest, ResultSetPagedMode002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Put 256 records with same prefix, which is exactly two pages of 128 entries
+     */
+    const int pagedNumber = 256;
+    const Key keyPrefix = {'r'};
+    IOption option;
+    option.dataType = IOption::SYNC_DATA;
+    ASSERT_EQ(g_connection->StartTransaction(), E_OK);
+    for (int i = 0; i < pagedNumber; i++) {
+        Key insertKey = keyPrefix;
+        insertKey.push_back(static_cast<uint8_t>(i >> 8)); // 8 is the bit of one byte
+        insertKey.push_back(static_cast<uint8_t>(i & 0xFF));
+        ASSERT_EQ(g_connection->Put(option, insertKey, VALUE_1), E_OK);
+    }
+    ASSERT_EQ(g_connection->Commit(), E_OK);
+
+    /**
+     * @tc.steps: step2. Open resultSet with paged mode and check IsLast while move forward
+     * @tc.expected: step2. Only the last entry of the second page is the last one.
+     */
+    const SQLiteSingleVerResultSet::Option pagedOption = {ResultSetCacheMode::CACHE_ENTRY_PAGED, 1};
+    auto resultSet = std::make_unique<SQLiteSingleVerResultSet>(g_store, keyPrefix, pagedOption);
+    ASSERT_EQ(resultSet->Open(false), E_OK);
+    EXPECT_FALSE(resultSet->IsLast());
+    const std::vector<int> positions = {0, 127, 128, 254};
+    for (int position : positions) {
+        ASSERT_EQ(resultSet->MoveTo(position), E_OK);
+        EXPECT_FALSE(resultSet->IsLast());
+    }
+    ASSERT_EQ(resultSet->MoveTo(pagedNumber - 1), E_OK);
+    EXPECT_TRUE(resultSet->IsLast());
+    EXPECT_EQ(resultSet->GetCount(), pagedNumber);
+    EXPECT_EQ(resultSet->Move(1), -E_INVALID_ARGS);
+    EXPECT_TRUE(resultSet->IsAfterLast());
+    resultSet->Close();
+}
 #endif
\ No newline at end of file
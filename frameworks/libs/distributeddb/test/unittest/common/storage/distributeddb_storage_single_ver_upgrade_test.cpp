@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "db_common.h"
@@ -258,6 +259,72 @@ namespace {
         EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
         g_kvNbDelegatePtr = nullptr;
     }
+
+    int GetDevIndexCount(const std::string &dbPath)
+    {
+        sqlite3 *db = nullptr;
+        OpenDbProperties property = {dbPath, true, false};
+        EXPECT_EQ(SQLiteUtils::OpenDatabase(property, db), E_OK);
+        if (db == nullptr) {
+            return -1;
+        }
+        int count = -1;
+        EXPECT_EQ(SQLiteUtils::GetCountBySql(db,
+            "SELECT COUNT(*) FROM sqlite_master WHERE type='index' AND name='dev_index';", count), E_OK);
+        (void)sqlite3_close_v2(db);
+        return count;
+    }
+
+    void PutForLayout(bool isReducedSyncIndex, int count, int64_t &costUs, uint64_t &fileSize)
+    {
+        KvStoreNbDelegate::Option option = {true, false, false};
+        option.isReducedSyncIndex = isReducedSyncIndex;
+        g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+        ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+        Value value(100, 'v'); // 100 bytes value
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++) {
+            std::string keyStr = "key_" + std::to_string(i);
+            EXPECT_EQ(g_kvNbDelegatePtr->Put(Key(keyStr.begin(), keyStr.end()), value), OK);
+        }
+        costUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+            start).count();
+        EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+        g_kvNbDelegatePtr = nullptr;
+        EXPECT_EQ(OS::CalFileSize(g_maindbPath, fileSize), E_OK);
+        EXPECT_EQ(g_mgr.DeleteKvStore("TestUpgradeNb"), OK);
+    }
+
+    int ExecuteOnMainDb(const std::string &execSql, const std::string &countSql, int &count)
+    {
+        sqlite3 *db = nullptr;
+        OpenDbProperties property = {g_maindbPath, true, false};
+        int errCode = SQLiteUtils::OpenDatabase(property, db);
+        if (db == nullptr) {
+            return errCode;
+        }
+        if (!execSql.empty()) {
+            errCode = SQLiteUtils::ExecuteRawSQL(db, execSql);
+        }
+        if (errCode == E_OK) {
+            errCode = SQLiteUtils::GetCountBySql(db, countSql, count);
+        }
+        (void)sqlite3_close_v2(db);
+        return errCode;
+    }
+
+    void OpenForLatency(bool isFastOpen, int64_t &costUs)
+    {
+        KvStoreNbDelegate::Option option = {true, false, false};
+        option.isFastOpen = isFastOpen;
+        auto start = std::chrono::steady_clock::now();
+        g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+        costUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+            start).count();
+        ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+        EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+        g_kvNbDelegatePtr = nullptr;
+    }
 }
 
 class DistributedDBStorageSingleVerUpgradeTest : public testing::Test {
@@ -629,4 +696,181 @@ HWTEST_F(DistributedDBStorageSingleVerUpgradeTest, UpgradeErrTest001, TestSize.L
     EXPECT_FALSE(OS::CheckPathExistence(dbPath));
     (void)sqlite3_close_v2(db);
     EXPECT_EQ(g_mgr.DeleteKvStore("TestUpgradeNb"), OK);
-}
\ No newline at end of file
+}
+
+/**
+  * @tc.name: ReducedSyncIndex001
+  * @tc.desc: Test sync_data index layout follows the open option and migrates both ways.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSingleVerUpgradeTest, ReducedSyncIndex001, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. Create a new store with reduced sync index and put data.
+     * @tc.expected: step1. dev_index is not created and data can be read and removed by device.
+     */
+    KvStoreNbDelegate::Option option = {true, false, false};
+    option.isReducedSyncIndex = true;
+    GetKvStoreProcess(option, true, false, SecurityOption());
+    EXPECT_EQ(GetDevIndexCount(g_maindbPath), 0);
+    g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    EXPECT_EQ(g_kvNbDelegatePtr->RemoveDeviceData("remote_device"), OK);
+    Value valueRead;
+    EXPECT_EQ(g_kvNbDelegatePtr->Get({'1'}, valueRead), OK);
+    /**
+     * @tc.steps:step2. Open the same store again with the default layout while it is still open.
+     * @tc.expected: step2. Returns INVALID_ARGS.
+     */
+    KvStoreNbDelegate *delegate = nullptr;
+    DBStatus status = OK;
+    g_mgr.GetKvStore("TestUpgradeNb", {true, false, false},
+        [&delegate, &status](DBStatus s, KvStoreNbDelegate *kvStore) {
+            status = s;
+            delegate = kvStore;
+        });
+    EXPECT_EQ(status, INVALID_ARGS);
+    EXPECT_EQ(delegate, nullptr);
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    g_kvNbDelegatePtr = nullptr;
+    /**
+     * @tc.steps:step3. Reopen with the default layout, then with the reduced layout.
+     * @tc.expected: step3. dev_index is rebuilt, then dropped again, data is kept.
+     */
+    GetKvStoreProcess({true, false, false}, true, false, SecurityOption());
+    EXPECT_EQ(GetDevIndexCount(g_maindbPath), 1);
+    GetKvStoreProcess(option, true, false, SecurityOption());
+    EXPECT_EQ(GetDevIndexCount(g_maindbPath), 0);
+    /**
+     * @tc.steps:step4. Reopen with the same layout.
+     * @tc.expected: step4. dev_index is neither dropped nor created, schema is not changed.
+     */
+    int schemaVersion = 0;
+    EXPECT_EQ(ExecuteOnMainDb("", "PRAGMA schema_version;", schemaVersion), E_OK);
+    GetKvStoreProcess(option, true, false, SecurityOption());
+    int reopenSchemaVersion = 0;
+    EXPECT_EQ(ExecuteOnMainDb("", "PRAGMA schema_version;", reopenSchemaVersion), E_OK);
+    EXPECT_EQ(reopenSchemaVersion, schemaVersion);
+    EXPECT_EQ(GetDevIndexCount(g_maindbPath), 0);
+    EXPECT_EQ(g_mgr.DeleteKvStore("TestUpgradeNb"), OK);
+}
+
+/**
+  * @tc.name: ReducedSyncIndexPerf001
+  * @tc.desc: Compare file size and put cost between default and reduced sync index layout.
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSingleVerUpgradeTest, ReducedSyncIndexPerf001, TestSize.Level4)
+{
+    /**
+     * @tc.steps:step1. Put the same data into a default store and a reduced index store.
+     * @tc.expected: step1. Reduced index store is not larger than the default one.
+     */
+    const int putCount = 5000;
+    int64_t defaultCost = 0;
+    uint64_t defaultSize = 0;
+    PutForLayout(false, putCount, defaultCost, defaultSize);
+    int64_t reducedCost = 0;
+    uint64_t reducedSize = 0;
+    PutForLayout(true, putCount, reducedCost, reducedSize);
+    LOGI("[ReducedSyncIndexPerf001] default: %" PRId64 "us %" PRIu64 "bytes, reduced: %" PRId64 "us %" PRIu64
+        "bytes", defaultCost, defaultSize, reducedCost, reducedSize);
+    EXPECT_LE(reducedSize, defaultSize);
+}
+
+/**
+  * @tc.name: FastOpen001
+  * @tc.desc: Test the local data upgraded without timestamp is repaired once, also with the fast open option.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSingleVerUpgradeTest, FastOpen001, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. Put local data, then clear its timestamp and the repaired flag as the old version upgraded.
+     * @tc.expected: step1. OK.
+     */
+    KvStoreNbDelegate::Option option = {true, false, false};
+    g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    EXPECT_EQ(g_kvNbDelegatePtr->PutLocal({'k'}, {'v'}), OK);
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    g_kvNbDelegatePtr = nullptr;
+    const std::string flagSql = "SELECT COUNT(*) FROM meta_data WHERE key=CAST('localDataTimestampInited' AS BLOB);";
+    int count = 0;
+    EXPECT_EQ(ExecuteOnMainDb("", flagSql, count), E_OK);
+    EXPECT_EQ(count, 1);
+    const std::string resetSql = "UPDATE local_data SET timestamp=0;"
+        "DELETE FROM meta_data WHERE key=CAST('localDataTimestampInited' AS BLOB);";
+    const std::string zeroTimeSql = "SELECT COUNT(*) FROM local_data WHERE timestamp=0;";
+    EXPECT_EQ(ExecuteOnMainDb(resetSql, zeroTimeSql, count), E_OK);
+    EXPECT_EQ(count, 1);
+    /**
+     * @tc.steps:step2. Reopen with fast open and wait for the background repair.
+     * @tc.expected: step2. The timestamp is repaired and the local data can be read.
+     */
+    option.isFastOpen = true;
+    g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+    ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+    const int maxWaitCount = 100;
+    const int waitIntervalMs = 10;
+    count = 0;
+    for (int i = 0; i < maxWaitCount && count == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(waitIntervalMs));
+        EXPECT_EQ(ExecuteOnMainDb("", flagSql, count), E_OK);
+    }
+    EXPECT_EQ(count, 1);
+    Value valueRead;
+    EXPECT_EQ(g_kvNbDelegatePtr->GetLocal({'k'}, valueRead), OK);
+    EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+    g_kvNbDelegatePtr = nullptr;
+    EXPECT_EQ(ExecuteOnMainDb("", zeroTimeSql, count), E_OK);
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(ExecuteOnMainDb("", flagSql, count), E_OK);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(g_mgr.DeleteKvStore("TestUpgradeNb"), OK);
+}
+
+/**
+  * @tc.name: FastOpenPerf001
+  * @tc.desc: Compare the reopen cost between default and fast open with different data size.
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSingleVerUpgradeTest, FastOpenPerf001, TestSize.Level4)
+{
+    /**
+     * @tc.steps:step1. Put data and reopen the store with and without fast open.
+     * @tc.expected: step1. OK.
+     */
+    for (int dataCount : {0, 1000, 10000}) { // 0, 1000, 10000 records
+        KvStoreNbDelegate::Option option = {true, false, false};
+        g_mgr.GetKvStore("TestUpgradeNb", option, g_kvNbDelegateCallback);
+        ASSERT_TRUE(g_kvNbDelegatePtr != nullptr);
+        std::vector<Entry> entries;
+        Value value(100, 'v'); // 100 bytes value
+        for (int i = 0; i < dataCount; i++) {
+            std::string keyStr = "key_" + std::to_string(i);
+            entries.push_back({Key(keyStr.begin(), keyStr.end()), value});
+            EXPECT_EQ(g_kvNbDelegatePtr->PutLocal(Key(keyStr.begin(), keyStr.end()), value), OK);
+        }
+        if (!entries.empty()) {
+            EXPECT_EQ(g_kvNbDelegatePtr->PutBatch(entries), OK);
+        }
+        EXPECT_EQ(g_mgr.CloseKvStore(g_kvNbDelegatePtr), OK);
+        g_kvNbDelegatePtr = nullptr;
+        int64_t defaultCost = 0;
+        OpenForLatency(false, defaultCost);
+        int64_t fastCost = 0;
+        OpenForLatency(true, fastCost);
+        LOGI("[FastOpenPerf001] count: %d, default: %" PRId64 "us, fast: %" PRId64 "us", dataCount, defaultCost,
+            fastCost);
+        EXPECT_EQ(g_mgr.DeleteKvStore("TestUpgradeNb"), OK);
+    }
+}
@@ -12,12 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <chrono>
 #include <cstdint>
 #include <gtest/gtest.h>
 
 #include "db_constant.h"
 #include "db_common.h"
 #include "distributeddb_storage_single_ver_natural_store_testcase.h"
+#include "kv_store_changed_data_impl.h"
 #include "kvdb_pragma.h"
 #include "storage_engine_manager.h"
 #include "sqlite_meta_executor.h"
@@ -1396,3 +1398,108 @@ HWTEST_F(DistributedDBStorageSQLiteSingleVerNaturalExecutorTest, AbnormalSqlExec
     ret = obj.AddSubscribeTrigger(query, "");
     EXPECT_EQ(ret, -E_EKEYREVOKED);
 }
+
+/**
+  * @tc.name: CommitNotifyData001
+  * @tc.desc: Test the changes of the same key are merged and the entries are shared by observers.
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSQLiteSingleVerNaturalExecutorTest, CommitNotifyData001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Insert, update and delete a new key, update and delete an existed key.
+     * @tc.expected: step1. The new key is not notified, the existed key is notified as deleted.
+     */
+    auto data = new (std::nothrow) SingleVerNaturalStoreCommitNotifyData();
+    ASSERT_NE(data, nullptr);
+    Key hashKey1;
+    Key hashKey2;
+    EXPECT_EQ(DBCommon::CalcValueHash(KEY_1, hashKey1), E_OK);
+    EXPECT_EQ(DBCommon::CalcValueHash(KEY_2, hashKey2), E_OK);
+    data->InitKeyPropRecord(hashKey1, ExistStatus::NONE);
+    data->InitKeyPropRecord(hashKey2, ExistStatus::EXIST);
+    EXPECT_EQ(data->InsertCommittedData({KEY_1, VALUE_1}, DataType::INSERT, true), E_OK);
+    EXPECT_EQ(data->InsertCommittedData({KEY_2, VALUE_1}, DataType::UPDATE, true, hashKey2), E_OK);
+    EXPECT_EQ(data->InsertCommittedData({KEY_1, VALUE_2}, DataType::UPDATE, true, hashKey1), E_OK);
+    EXPECT_EQ(data->InsertCommittedData({KEY_1, VALUE_2}, DataType::DELETE, true), E_OK);
+    EXPECT_EQ(data->InsertCommittedData({KEY_2, VALUE_2}, DataType::DELETE, true), E_OK);
+    int errCode = E_OK;
+    EXPECT_TRUE(data->GetInsertedEntries(errCode).empty());
+    EXPECT_TRUE(data->GetUpdatedEntries(errCode).empty());
+    ASSERT_EQ(data->GetDeletedEntries(errCode).size(), 1u);
+    EXPECT_EQ(data->GetDeletedEntries(errCode).front().key, KEY_2);
+    /**
+     * @tc.steps: step2. Get the deleted entries by two observers.
+     * @tc.expected: step2. The entries are the same object and can not be changed any more.
+     */
+    KvStoreChangedDataImpl changedData1(data);
+    KvStoreChangedDataImpl changedData2(data);
+    EXPECT_EQ(&changedData1.GetEntriesDeleted(), &changedData2.GetEntriesDeleted());
+    EXPECT_TRUE(changedData1.GetEntriesInserted().empty());
+    EXPECT_EQ(data->InsertCommittedData({KEY_3, VALUE_1}, DataType::INSERT), -E_NOT_SUPPORT);
+    /**
+     * @tc.steps: step3. Filter the entries by key.
+     * @tc.expected: step3. Only the entries of the filter key are got.
+     */
+    data->SetFilterKey(KEY_1);
+    EXPECT_TRUE(data->IsChangedDataEmpty());
+    data->SetFilterKey(KEY_2);
+    EXPECT_FALSE(data->IsChangedDataEmpty());
+    RefObject::DecObjRef(data);
+}
+
+/**
+  * @tc.name: CommitNotifyDataPerf001
+  * @tc.desc: Test the cost of merging 100k changes and notifying them to 8 observers.
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSQLiteSingleVerNaturalExecutorTest, CommitNotifyDataPerf001, TestSize.Level4)
+{
+    /**
+     * @tc.steps: step1. Put 100k changes on 50k keys which each key is changed twice.
+     * @tc.expected: step1. 50k entries are notified as inserted.
+     */
+    const int changeCount = 100000; // 100k changes
+    const int keyCount = changeCount / 2; // each key is changed twice
+    const int observerCount = 8;
+    auto data = new (std::nothrow) SingleVerNaturalStoreCommitNotifyData();
+    ASSERT_NE(data, nullptr);
+    std::vector<Key> keys;
+    std::vector<Key> hashKeys;
+    for (int i = 0; i < keyCount; i++) {
+        std::string keyStr = "key_" + std::to_string(i);
+        keys.emplace_back(keyStr.begin(), keyStr.end());
+        Key hashKey;
+        EXPECT_EQ(DBCommon::CalcValueHash(keys.back(), hashKey), E_OK);
+        data->InitKeyPropRecord(hashKey, ExistStatus::NONE);
+        hashKeys.push_back(std::move(hashKey));
+    }
+    Value value(100, 'v'); // 100 bytes value
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < changeCount; i++) {
+        EXPECT_EQ(data->InsertCommittedData({keys[i % keyCount], value}, DataType::INSERT, true,
+            hashKeys[i % keyCount]), E_OK);
+    }
+    auto mergeCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    /**
+     * @tc.steps: step2. Read the changes by 8 observers.
+     * @tc.expected: step2. Each observer gets all the inserted entries.
+     */
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < observerCount; i++) {
+        data->SetFilterKey({});
+        ASSERT_FALSE(data->IsChangedDataEmpty());
+        KvStoreChangedDataImpl changedData(data);
+        EXPECT_EQ(changedData.GetEntriesInserted().size(), static_cast<size_t>(keyCount));
+    }
+    auto notifyCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    LOGI("[CommitNotifyDataPerf001] merge: %" PRId64 "us, notify: %" PRId64 "us", static_cast<int64_t>(mergeCost),
+        static_cast<int64_t>(notifyCost));
+    RefObject::DecObjRef(data);
+}
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 
 #include "db_constant.h"
@@ -1197,4 +1198,73 @@ HWTEST_F(DistributedDBStorageSQLiteSingleVerNaturalStoreTest, GetSecurityOptionT
     EXPECT_EQ(g_store->Export(g_testDir, password), -E_NOT_SUPPORT);
     EXPECT_EQ(g_store->Import(g_testDir, password, false), -E_NOT_SUPPORT);
 }
+
+/**
+  * @tc.name: PutSyncDataBatch001
+  * @tc.desc: Save a 4000-item sync packet and check the conflict result is the same as saving one by one.
+  * @tc.type: PERF
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSQLiteSingleVerNaturalStoreTest, PutSyncDataBatch001, TestSize.Level4)
+{
+    /**
+     * @tc.steps: step1. Put 2000 local records.
+     */
+    const int localNumber = 2000;
+    const int packetNumber = 4000;
+    IOption option;
+    option.dataType = IOption::SYNC_DATA;
+    auto getKey = [](int index) {
+        std::string keyStr = "batch_key_" + std::to_string(index);
+        return Key(keyStr.begin(), keyStr.end());
+    };
+    const Value localValue = {'l'};
+    const Value remoteValue = {'r'};
+    Timestamp timeBegin = 0;
+    g_store->GetMaxTimestamp(timeBegin);
+    ASSERT_EQ(g_connection->StartTransaction(), E_OK);
+    for (int i = 0; i < localNumber; i++) {
+        ASSERT_EQ(g_connection->Put(option, getKey(i), localValue), E_OK);
+    }
+    ASSERT_EQ(g_connection->Commit(), E_OK);
+    Timestamp timeEnd = 0;
+    g_store->GetMaxTimestamp(timeEnd);
+
+    /**
+     * @tc.steps: step2. Put a 4000-item packet from deviceB, the odd items of first 2000 are older than local,
+     *  and the first key appears twice in the packet.
+     * @tc.expected: step2. Return OK.
+     */
+    std::vector<DataItem> dataItems;
+    for (int i = 0; i < packetNumber; i++) {
+        DataItem item;
+        item.key = getKey(i);
+        item.value = remoteValue;
+        item.timestamp = (i < localNumber && i % 2 == 1) ? timeBegin : timeEnd + 1 + static_cast<Timestamp>(i);
+        item.flag = 0;
+        dataItems.push_back(item);
+    }
+    DataItem duplicateItem = dataItems[0];
+    duplicateItem.value = {'d'};
+    duplicateItem.timestamp = timeEnd + packetNumber + 1;
+    dataItems.push_back(duplicateItem);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(DistributedDBToolsUnitTest::PutSyncDataTest(g_store, dataItems, "deviceB"), E_OK);
+    auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LOGI("[PutSyncDataBatch001] save %zu items cost %" PRId64 " ms", dataItems.size(),
+        static_cast<int64_t>(cost.count()));
+
+    /**
+     * @tc.steps: step3. Check the value of each key.
+     * @tc.expected: step3. The older items are defeated, and the later duplicate item wins.
+     */
+    Value valueRead;
+    EXPECT_EQ(g_connection->Get(option, getKey(0), valueRead), E_OK);
+    EXPECT_EQ(valueRead, duplicateItem.value);
+    for (int i = 1; i < packetNumber; i++) {
+        ASSERT_EQ(g_connection->Get(option, getKey(i), valueRead), E_OK);
+        EXPECT_EQ(valueRead, (i < localNumber && i % 2 == 1) ? localValue : remoteValue);
+    }
+}
 }
\ No newline at end of file
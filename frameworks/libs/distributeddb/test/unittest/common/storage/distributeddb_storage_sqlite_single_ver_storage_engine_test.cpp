@@ -620,6 +620,39 @@ HWTEST_F(DistributedDBStorageSQLiteSingleVerStorageEngineTest, ExecutorTest010,
     engine->Release();
 }
 
+/**
+  * @tc.name: ExecutorTest011
+  * @tc.desc: Test find read executor after operate abort when idle handle exists
+  * @tc.type: FUNC
+  * @tc.require:
+  * @tc.author: test
+  */
+HWTEST_F(DistributedDBStorageSQLiteSingleVerStorageEngineTest, ExecutorTest011, TestSize.Level0)
+{
+    ASSERT_NO_FATAL_FAILURE(PrepareEnv());
+    auto [errCode, engine] = GetVirtualEngine(2); // max read is 2
+    ASSERT_EQ(errCode, E_OK);
+    /**
+     * @tc.steps:step1. create new handle and recycle it to idle list
+     * @tc.expected: step1. create ok.
+     */
+    auto executor0 = engine->FindExecutor(false, OperatePerm::NORMAL_PERM, errCode);
+    ASSERT_NE(executor0, nullptr);
+    engine->Recycle(executor0);
+    /**
+     * @tc.steps:step2. mark operate abort and get read handle with and without wait
+     * @tc.expected: step2. get failed by busy although idle handle exists.
+     */
+    engine->Abort();
+    auto executor1 = engine->FindExecutor(false, OperatePerm::NORMAL_PERM, errCode, false, 0);
+    EXPECT_EQ(executor1, nullptr);
+    EXPECT_EQ(errCode, -E_BUSY);
+    executor1 = engine->FindExecutor(false, OperatePerm::NORMAL_PERM, errCode);
+    EXPECT_EQ(executor1, nullptr);
+    EXPECT_EQ(errCode, -E_BUSY);
+    engine->Release();
+}
+
 /**
   * @tc.name: ReleaseStorageEngineTest001
   * @tc.desc: Test ReleaseStorageEngine func
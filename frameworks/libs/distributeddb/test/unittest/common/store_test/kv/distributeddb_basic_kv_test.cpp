@@ -727,4 +727,118 @@ HWTEST_F(DistributedDBBasicKVTest, GetKvStore008, TestSize.Level4)
     }
 }
 #endif
+/**
+ * @tc.name: ValueCache001
+ * @tc.desc: Test the hot key value cache is invalidated by local writes.
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBBasicKVTest, ValueCache001, TestSize.Level0)
+{
+    auto storeInfo1 = GetStoreInfo1();
+    auto store1 = GetDelegate(storeInfo1);
+    ASSERT_NE(store1, nullptr);
+    /**
+     * @tc.steps: step1. set invalid cache size and enable the cache with 1 MB
+     * @tc.expected: step1. invalid size return INVALID_ARGS, valid size return OK.
+     */
+    int size = -1;
+    auto sizeData = static_cast<PragmaData>(&size);
+    EXPECT_EQ(store1->Pragma(VALUE_CACHE_MAX_SIZE, sizeData), INVALID_ARGS);
+    size = 17; // max is 16 MB
+    EXPECT_EQ(store1->Pragma(VALUE_CACHE_MAX_SIZE, sizeData), INVALID_ARGS);
+    size = 1;
+    EXPECT_EQ(store1->Pragma(VALUE_CACHE_MAX_SIZE, sizeData), OK);
+    /**
+     * @tc.steps: step2. get (k,v1) twice
+     * @tc.expected: step2. the second get hit the cache.
+     */
+    Key key = {'k'};
+    Value value1 = {'v', '1'};
+    EXPECT_EQ(store1->Put(key, value1), OK);
+    Value actualValue;
+    EXPECT_EQ(store1->Get(key, actualValue), OK);
+    EXPECT_EQ(store1->Get(key, actualValue), OK);
+    EXPECT_EQ(actualValue, value1);
+    ValueCacheStatistics statistics;
+    auto statisticsData = static_cast<PragmaData>(&statistics);
+    EXPECT_EQ(store1->Pragma(GET_VALUE_CACHE_STATISTICS, statisticsData), OK);
+    EXPECT_EQ(statistics.hitCount, 1u);
+    EXPECT_EQ(statistics.missCount, 1u);
+    /**
+     * @tc.steps: step3. update k by put and transaction, then delete it
+     * @tc.expected: step3. get always return the latest value.
+     */
+    Value value2 = {'v', '2'};
+    EXPECT_EQ(store1->Put(key, value2), OK);
+    EXPECT_EQ(store1->Get(key, actualValue), OK);
+    EXPECT_EQ(actualValue, value2);
+    Value value3 = {'v', '3'};
+    EXPECT_EQ(store1->StartTransaction(), OK);
+    EXPECT_EQ(store1->Put(key, value3), OK);
+    EXPECT_EQ(store1->Commit(), OK);
+    EXPECT_EQ(store1->Get(key, actualValue), OK);
+    EXPECT_EQ(actualValue, value3);
+    EXPECT_EQ(store1->Delete(key), OK);
+    EXPECT_EQ(store1->Get(key, actualValue), NOT_FOUND);
+    /**
+     * @tc.steps: step4. disable the cache
+     * @tc.expected: step4. get do not change the statistics.
+     */
+    size = 0;
+    EXPECT_EQ(store1->Pragma(VALUE_CACHE_MAX_SIZE, sizeData), OK);
+    EXPECT_EQ(store1->Pragma(GET_VALUE_CACHE_STATISTICS, statisticsData), OK);
+    ValueCacheStatistics newStatistics;
+    auto newStatisticsData = static_cast<PragmaData>(&newStatistics);
+    EXPECT_EQ(store1->Get(key, actualValue), NOT_FOUND);
+    EXPECT_EQ(store1->Pragma(GET_VALUE_CACHE_STATISTICS, newStatisticsData), OK);
+    EXPECT_EQ(newStatistics.hitCount, statistics.hitCount);
+    EXPECT_EQ(newStatistics.missCount, statistics.missCount);
+}
+
+#ifdef USE_DISTRIBUTEDDB_DEVICE
+/**
+ * @tc.name: ValueCache002
+ * @tc.desc: Test the hot key value cache is invalidated by remote sync data.
+ * @tc.type: FUNC
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBBasicKVTest, ValueCache002, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. dev2 enable the cache, get (k,v1) which synced from dev1
+     * @tc.expected: step1. get v1.
+     */
+    auto storeInfo1 = GetStoreInfo1();
+    auto storeInfo2 = GetStoreInfo2();
+    auto store1 = GetDelegate(storeInfo1);
+    ASSERT_NE(store1, nullptr);
+    auto store2 = GetDelegate(storeInfo2);
+    ASSERT_NE(store2, nullptr);
+    int size = 1;
+    auto sizeData = static_cast<PragmaData>(&size);
+    EXPECT_EQ(store2->Pragma(VALUE_CACHE_MAX_SIZE, sizeData), OK);
+    Key key = {'k'};
+    Value value1 = {'v', '1'};
+    EXPECT_EQ(store1->Put(key, value1), OK);
+    BlockPush(storeInfo1, storeInfo2);
+    Value actualValue;
+    EXPECT_EQ(store2->Get(key, actualValue), OK);
+    EXPECT_EQ(store2->Get(key, actualValue), OK);
+    EXPECT_EQ(actualValue, value1);
+    /**
+     * @tc.steps: step2. dev1 update k and sync to dev2
+     * @tc.expected: step2. dev2 get the new value.
+     */
+    Value value2 = {'v', '2'};
+    EXPECT_EQ(store1->Put(key, value2), OK);
+    BlockPush(storeInfo1, storeInfo2);
+    EXPECT_EQ(store2->Get(key, actualValue), OK);
+    EXPECT_EQ(actualValue, value2);
+    ValueCacheStatistics statistics;
+    auto statisticsData = static_cast<PragmaData>(&statistics);
+    EXPECT_EQ(store2->Pragma(GET_VALUE_CACHE_STATISTICS, statisticsData), OK);
+    EXPECT_EQ(statistics.hitCount + statistics.missCount, 3u);
+}
+#endif
 } // namespace DistributedDB
\ No newline at end of file
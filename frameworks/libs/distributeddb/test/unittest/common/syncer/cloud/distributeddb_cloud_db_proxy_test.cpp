@@ -14,6 +14,7 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <utility>
 #include "cloud/cloud_db_constant.h"
 #include "cloud/cloud_db_data_utils.h"
@@ -107,6 +108,21 @@ DBStatus Sync(CloudSyncer *cloudSyncer, int &callCount)
     return syncProcess.errCode;
 }
 
+void GenerateUploadData(int count, std::vector<VBucket> &records, std::vector<VBucket> &extends)
+{
+    TableSchema schema = {
+        .name = TABLE_NAME,
+        .sharedTableName = "",
+        .fields = GetFields()
+    };
+    records.clear();
+    extends.clear();
+    for (int i = 0; i < count; ++i) {
+        records.push_back(CloudDBDataUtils::GenerateRecord(schema, i));
+        extends.push_back({ { CloudDbConstant::DELETE_FIELD, false } });
+    }
+}
+
 class DistributedDBCloudDBProxyTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -1231,4 +1247,48 @@ HWTEST_F(DistributedDBCloudDBProxyTest, FillCloudErrorActionTest001, TestSize.Le
     CloudSyncUtils::FillCloudErrorActionFromExtend(extend3, info);
     EXPECT_EQ(info.innerCloudErrorInfo.cloudAction, CloudErrorAction::ACTION_RETRY_SYNC_TASK);
 }
+
+/**
+ * @tc.name: CloudDBProxyUploadPerf001
+ * @tc.desc: Test the cost of building and uploading 10k records by rows.
+ * @tc.type: PERF
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudDBProxyTest, CloudDBProxyUploadPerf001, TestSize.Level4)
+{
+    /**
+     * @tc.steps: step1. build 10k records which copy each field name into every record
+     * @tc.expected: step1. OK
+     */
+    const int recordCount = 10000; // 10k records each batch
+    std::vector<VBucket> records;
+    std::vector<VBucket> extends;
+    auto start = std::chrono::steady_clock::now();
+    GenerateUploadData(recordCount, records, extends);
+    auto buildCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    ASSERT_EQ(records.size(), static_cast<size_t>(recordCount));
+    /**
+     * @tc.steps: step2. upload the records by proxy
+     * @tc.expected: step2. OK and the gid of each record is filled
+     */
+    auto cloudDb = std::make_shared<VirtualCloudDb>();
+    CloudDBProxy proxy;
+    proxy.SetCloudDB(cloudDb);
+    Info uploadInfo;
+    uint32_t retryCount = 0;
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(proxy.BatchInsert(TABLE_NAME, records, extends, uploadInfo, retryCount), E_OK);
+    auto uploadCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        start).count();
+    ASSERT_EQ(extends.size(), static_cast<size_t>(recordCount));
+    for (const auto &extend : extends) {
+        EXPECT_EQ(extend.count(CloudDbConstant::GID_FIELD), 1u);
+    }
+    LOGI("[CloudDBProxyUploadPerf001] records:%d, build cost:%" PRId64 "us, upload cost:%" PRId64
+        "us, records/sec:%.0f", recordCount, static_cast<int64_t>(buildCost), static_cast<int64_t>(uploadCost),
+        uploadCost == 0 ? 0.0 : recordCount * 1000000.0 / uploadCost);
+    EXPECT_EQ(proxy.Close(), E_OK);
+}
 }
\ No newline at end of file
@@ -314,7 +314,7 @@ void WaitForSyncFinish(SyncProcess &syncProcess, const int64_t &waitTime)
 }
 
 void CallSync(const std::vector<std::string> &tableNames, SyncMode mode, DBStatus dbStatus, DBStatus errCode = OK,
-    bool isMerge = false)
+    bool isMerge = false, bool isPipeline = false)
 {
     g_syncProcess = {};
     Query query = Query::Select().FromTable(tableNames);
@@ -335,6 +335,7 @@ void CallSync(const std::vector<std::string> &tableNames, SyncMode mode, DBStatu
     option.waitTime = SYNC_WAIT_TIME;
     option.lockAction = static_cast<LockAction>(0xff); // lock all
     option.merge = isMerge;
+    option.pipelineDownload = isPipeline;
     ASSERT_EQ(g_delegate->Sync(option, callback), dbStatus);
 
     if (dbStatus == DBStatus::OK) {
@@ -3188,5 +3189,100 @@ HWTEST_F(DistributedDBCloudSyncerDownloadAssetsTest, ExpireCursor004, TestSize.L
     g_virtualCloudDb->ForkQueryAllGid(nullptr);
     g_virtualAssetLoader->SetRemoveLocalAssetsCallback(nullptr);
 }
+
+/**
+ * @tc.name: DownloadPipelineTest001
+ * @tc.desc: Test pipelined download overlap cloud query with save data and assets download
+ * @tc.type: PERF
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudSyncerDownloadAssetsTest, DownloadPipelineTest001, TestSize.Level4)
+{
+    /**
+     * @tc.steps:step1. insert 10 batches into cloud, each query cost 100ms and each asset download cost 1ms
+     * @tc.expected: step1. OK
+     */
+    const int cloudCount = 1000; // 1000 is num of cloud, 10 batches
+    const int batchNum = 10;
+    const int queryDelayMs = 100;
+    InsertCloudDBData(0, cloudCount, 0, ASSETS_TABLE_NAME);
+    g_virtualCloudDb->ForkQuery([queryDelayMs](const std::string &, VBucket &) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(queryDelayMs));
+    });
+    std::atomic<int> downloadCount = 0;
+    g_virtualAssetLoader->ForkDownload([&downloadCount](const std::string &, std::map<std::string, Assets> &) {
+        downloadCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    /**
+     * @tc.steps:step2. sync with pipeline download
+     * @tc.expected: step2. all data downloaded and cost less than query and download one by one
+     */
+    auto beginTime = std::chrono::steady_clock::now();
+    CallSync({ASSETS_TABLE_NAME}, SYNC_MODE_CLOUD_MERGE, DBStatus::OK, OK, false, true);
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+        beginTime).count();
+    int64_t serialCostMs = static_cast<int64_t>(batchNum) * queryDelayMs + downloadCount.load();
+    LOGI("[DownloadPipelineTest001] records=%d, cost=%" PRId64 "ms, serial query and download cost=%" PRId64 "ms",
+        cloudCount, static_cast<int64_t>(costMs), serialCostMs);
+    EXPECT_LT(costMs, serialCostMs);
+    std::string sql = "select count(*) from " + ASSETS_TABLE_NAME + ";";
+    CloudDBSyncUtilsTest::CheckCount(db, sql, cloudCount);
+
+    /**
+     * @tc.steps:step3. sync again
+     * @tc.expected: step3. cloud water mark is saved, nothing download again
+     */
+    int lastDownloadCount = downloadCount.load();
+    CallSync({ASSETS_TABLE_NAME}, SYNC_MODE_CLOUD_MERGE, DBStatus::OK, OK, false, true);
+    EXPECT_EQ(downloadCount.load(), lastDownloadCount);
+    CloudDBSyncUtilsTest::CheckCount(db, sql, cloudCount);
+
+    g_virtualCloudDb->ForkQuery(nullptr);
+    g_virtualAssetLoader->ForkDownload(nullptr);
+}
+
+/**
+ * @tc.name: DownloadPipelineTest002
+ * @tc.desc: Test close store when the prefetch of next batch is querying
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBCloudSyncerDownloadAssetsTest, DownloadPipelineTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps:step1. insert 10 batches into cloud, each query cost 200ms
+     * @tc.expected: step1. OK
+     */
+    const int cloudCount = 1000; // 1000 is num of cloud, 10 batches
+    const int queryDelayMs = 200;
+    InsertCloudDBData(0, cloudCount, 0, ASSETS_TABLE_NAME);
+    std::atomic<int> queryingCount = 0;
+    g_virtualCloudDb->ForkQuery([queryDelayMs, &queryingCount](const std::string &, VBucket &) {
+        queryingCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(queryDelayMs));
+        queryingCount--;
+    });
+
+    /**
+     * @tc.steps:step2. sync with pipeline download and close store after first batch queried
+     * @tc.expected: step2. close return OK and no prefetch is querying after close
+     */
+    CloudSyncOption option;
+    option.devices = {DEVICE_CLOUD};
+    option.mode = SYNC_MODE_CLOUD_MERGE;
+    option.query = Query::Select().FromTable({ASSETS_TABLE_NAME});
+    option.waitTime = SYNC_WAIT_TIME;
+    option.pipelineDownload = true;
+    ASSERT_EQ(g_delegate->Sync(option, nullptr), DBStatus::OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(queryDelayMs + queryDelayMs / 2));
+    EXPECT_EQ(g_mgr.CloseStore(g_delegate), DBStatus::OK);
+    g_delegate = nullptr;
+    EXPECT_EQ(queryingCount.load(), 0);
+    g_virtualCloudDb->ForkQuery(nullptr);
+}
 } // namespace
 #endif // RELATIONAL_STORE
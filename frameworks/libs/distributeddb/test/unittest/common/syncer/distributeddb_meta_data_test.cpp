@@ -887,4 +887,68 @@ HWTEST_F(DistributedDBMetaDataTest, MetadataTest019, TestSize.Level1)
     EXPECT_EQ(metadata_->GetSendDeleteSyncWaterMark("D3", USER_A, w), E_OK);
     EXPECT_EQ(w, 0u);
 }
+
+/**
+ * @tc.name: MetadataTest020
+ * @tc.desc: Test watermark is saved into db after the count of update reach flush threshold.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBMetaDataTest, MetadataTest020, TestSize.Level0)
+{
+    /**
+     * @tc.steps: step1. enable write behind and save local and peer watermark
+     * @tc.expected: step1. E_OK and only the current metadata get the latest value
+     */
+    metadata_->SetWaterMarkFlushThreshold(3u); // flush after 3 update
+    EXPECT_EQ(metadata_->SaveLocalWaterMark(DEVICE_A, "", 10u), E_OK);
+    EXPECT_EQ(metadata_->SavePeerWaterMark(DEVICE_A, "", 20u, true), E_OK);
+    WaterMark w = 0;
+    metadata_->GetLocalWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 10u);
+    metadata_->GetPeerWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 20u);
+    /**
+     * @tc.steps: step2. load metadata from db like restart after crash
+     * @tc.expected: step2. get the old watermark, data will be sent again but not lost
+     */
+    auto reloadMeta = std::make_shared<Metadata>();
+    ASSERT_EQ(reloadMeta->Initialize(storage_), E_OK);
+    reloadMeta->GetLocalWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 0u);
+    reloadMeta->GetPeerWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 0u);
+    /**
+     * @tc.steps: step3. update watermark until reach the threshold
+     * @tc.expected: step3. all watermark is saved into db
+     */
+    EXPECT_EQ(metadata_->SaveLocalWaterMark(DEVICE_A, "", 30u), E_OK);
+    reloadMeta = std::make_shared<Metadata>();
+    ASSERT_EQ(reloadMeta->Initialize(storage_), E_OK);
+    reloadMeta->GetLocalWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 30u);
+    reloadMeta->GetPeerWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 20u);
+    /**
+     * @tc.steps: step4. flush watermark manually
+     * @tc.expected: step4. watermark is saved into db
+     */
+    EXPECT_EQ(metadata_->SaveLocalWaterMark(DEVICE_A, "", 40u), E_OK);
+    EXPECT_EQ(metadata_->FlushWaterMark(), E_OK);
+    reloadMeta = std::make_shared<Metadata>();
+    ASSERT_EQ(reloadMeta->Initialize(storage_), E_OK);
+    reloadMeta->GetLocalWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 40u);
+    /**
+     * @tc.steps: step5. advance peer watermark and erase it
+     * @tc.expected: step5. erase is saved into db at once
+     */
+    EXPECT_EQ(metadata_->SavePeerWaterMark(DEVICE_A, "", 50u, true), E_OK);
+    EXPECT_EQ(metadata_->EraseDeviceWaterMark(DEVICE_A, true), E_OK);
+    reloadMeta = std::make_shared<Metadata>();
+    ASSERT_EQ(reloadMeta->Initialize(storage_), E_OK);
+    reloadMeta->GetPeerWaterMark(DEVICE_A, "", w);
+    EXPECT_EQ(w, 0u);
+}
 }
@@ -602,3 +602,70 @@ HWTEST_F(DistributedDBTimeSyncTest, TimeHelper002, TestSize.Level0)
     errTimeHelper = timeHelper.Initialize(g_syncInterfaceA, g_metadataA);
     EXPECT_EQ(errTimeHelper, -E_INVALID_TIME);
 }
+
+/**
+ * @tc.name: SharedTimeOffset001
+ * @tc.desc: Verify only the first db in process do time sync with the same device.
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.author: test
+ */
+HWTEST_F(DistributedDBTimeSyncTest, SharedTimeOffset001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. The first db do time sync with high version remote
+     * @tc.expected: step1. Time sync finish and offset is recorded in process
+     */
+    RuntimeContext::GetInstance()->ClearAllDeviceTimeInfo();
+    g_virtualCommunicator->SetRemoteVersion(SOFTWARE_VERSION_CURRENT);
+    EXPECT_EQ(g_metadataA->Initialize(g_syncInterfaceA), E_OK);
+    EXPECT_EQ(g_timeSyncA->Initialize(g_virtualCommunicator, g_metadataA, g_syncInterfaceA, DEVICE_B, ""), E_OK);
+    EXPECT_EQ(g_metadataB->Initialize(g_syncInterfaceB), E_OK);
+    EXPECT_EQ(g_timeSyncB->Initialize(g_virtualCommunicator, g_metadataB, g_syncInterfaceB, DEVICE_A, ""), E_OK);
+    g_syncTaskContext->Initialize({DEVICE_B, ""}, g_syncInterfaceA, g_metadataA, g_virtualCommunicator);
+    g_virtualCommunicator->SetTimeSync(g_timeSyncA.get(), g_timeSyncB.get(), DEVICE_A, g_syncTaskContext);
+    auto beginTime = std::chrono::steady_clock::now();
+    TimeOffset timeOffset = 0;
+    EXPECT_EQ(g_timeSyncA->GetTimeOffset(timeOffset, TIME_SYNC_WAIT_TIME), E_OK);
+    auto firstCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        beginTime).count();
+    EXPECT_FALSE(g_timeSyncA->IsNeedSync());
+    auto [errCode, info] = RuntimeContext::GetInstance()->GetDeviceTimeInfo(DEVICE_B);
+    ASSERT_EQ(errCode, E_OK);
+    /**
+     * @tc.steps: step2. Other db which record different offset start sync with the same device
+     * @tc.expected: step2. No need to time sync and the offset in process is saved
+     */
+    const int dbCount = 10;
+    for (int i = 0; i < dbCount; ++i) {
+        VirtualSingleVerSyncDBInterface storage;
+        auto metadata = std::make_shared<Metadata>();
+        ASSERT_EQ(metadata->Initialize(&storage), E_OK);
+        TimeOffset staleOffset = 100 * 1000 * 10000; // 100s in 100-nanosecond units
+        EXPECT_EQ(metadata->SetSystemTimeOffset(DEVICE_B, "", staleOffset), E_OK);
+        auto timeSync = std::make_shared<TimeSync>();
+        ASSERT_EQ(timeSync->Initialize(g_virtualCommunicator, metadata, &storage, DEVICE_B, ""), E_OK);
+        beginTime = std::chrono::steady_clock::now();
+        timeSync->SetTimeSyncFinishIfNeed();
+        EXPECT_FALSE(timeSync->IsNeedSync());
+        auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+            beginTime).count();
+        LOGI("[SharedTimeOffset001] db %d start cost %" PRId64 "us, first db cost %" PRId64 "us", i + 2,
+            static_cast<int64_t>(cost), static_cast<int64_t>(firstCost));
+        EXPECT_EQ(metadata->GetSystemTimeOffset(DEVICE_B, ""), info.systemTimeOffset);
+        timeSync->Close();
+    }
+    /**
+     * @tc.steps: step3. Local time changed and other db start sync
+     * @tc.expected: step3. Need time sync
+     */
+    RuntimeContext::GetInstance()->ClearAllDeviceTimeInfo();
+    VirtualSingleVerSyncDBInterface storage;
+    auto metadata = std::make_shared<Metadata>();
+    ASSERT_EQ(metadata->Initialize(&storage), E_OK);
+    auto timeSync = std::make_shared<TimeSync>();
+    ASSERT_EQ(timeSync->Initialize(g_virtualCommunicator, metadata, &storage, DEVICE_B, ""), E_OK);
+    timeSync->SetTimeSyncFinishIfNeed();
+    EXPECT_TRUE(timeSync->IsNeedSync());
+    timeSync->Close();
+}
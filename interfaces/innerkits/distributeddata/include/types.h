@@ -593,6 +593,11 @@ struct Options {
      * Set Whether the caller is application.
     */
     bool isApplication = false;
+    /**
+     * Whether the result set caches only one page of entries and reads the next page in key order.
+     * It is efficient when traversing a large result set sequentially. It is not enabled by default.
+    */
+    bool isPagedResultSet = false;
 };
 
 /**